@@ -0,0 +1,589 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ARENA_INCLUDED
+#define ETL_ARENA_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "nullptr.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+  #include <utility>
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "62"
+
+//*****************************************************************************
+///\defgroup arena arena
+/// A monotonic allocator over external buffers, for short lived scratch data.
+/// Everything allocated is freed at once by a reset or a rollback.
+///\ingroup memory
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for arena exceptions.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_exception : public etl::exception
+  {
+  public:
+
+    arena_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There is not enough space left in the arena.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_no_allocation : public etl::arena_exception
+  {
+  public:
+
+    arena_no_allocation(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:allocation", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A rollback to a checkpoint that is not in the arena's past.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_invalid_checkpoint : public etl::arena_exception
+  {
+  public:
+
+    arena_invalid_checkpoint(string_type file_name_, numeric_type line_number_)
+      : arena_exception(ETL_ERROR_TEXT("arena:checkpoint", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A monotonic 'bump' allocator over an external buffer, with an optional
+  /// overflow buffer that is used when the first is exhausted.
+  /// Objects created with create() that are not trivially destructible have
+  /// their destructors called, in reverse order, by reset() and rollback().
+  /// Storage for containers with external buffers, such as etl::vector<T, 0>,
+  /// may be taken with allocate_array().
+  ///\ingroup arena
+  //***************************************************************************
+  class arena
+  {
+  private:
+
+    //*************************************************************************
+    /// A registered destructor, stored in the arena before its object.
+    //*************************************************************************
+    struct destructor_node
+    {
+      void (*destroy)(void*);
+      void*            p_object;
+      destructor_node* p_next;
+    };
+
+  public:
+
+    //*************************************************************************
+    /// A position in the arena, to roll back to.
+    //*************************************************************************
+    class checkpoint
+    {
+    private:
+
+      friend class arena;
+
+      checkpoint(size_t segment_, char* p_next_, destructor_node* p_destructors_)
+        : segment(segment_),
+          p_next(p_next_),
+          p_destructors(p_destructors_)
+      {
+      }
+
+      size_t           segment;
+      char*            p_next;
+      destructor_node* p_destructors;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param p_buffer_ The buffer to allocate from.
+    ///\param size_     The size of the buffer in bytes.
+    //*************************************************************************
+    arena(void* p_buffer_, size_t size_)
+      : current(0U),
+        p_next(static_cast<char*>(p_buffer_)),
+        p_destructors(nullptr),
+        peak_size(0U)
+    {
+      set_segment(0U, p_buffer_, size_);
+      set_segment(1U, nullptr, 0U);
+    }
+
+    //*************************************************************************
+    /// Constructor, with an overflow buffer.
+    ///\param p_buffer_          The buffer to allocate from.
+    ///\param size_              The size of the buffer in bytes.
+    ///\param p_overflow_buffer_ The buffer to allocate from when the first is full.
+    ///\param overflow_size_     The size of the overflow buffer in bytes.
+    //*************************************************************************
+    arena(void* p_buffer_, size_t size_, void* p_overflow_buffer_, size_t overflow_size_)
+      : current(0U),
+        p_next(static_cast<char*>(p_buffer_)),
+        p_destructors(nullptr),
+        peak_size(0U)
+    {
+      set_segment(0U, p_buffer_, size_);
+      set_segment(1U, p_overflow_buffer_, overflow_size_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Destroys the objects created in the arena.
+    //*************************************************************************
+    ~arena()
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Allocates 'size' bytes aligned to 'alignment', which must be a power of
+    /// two. The default is the alignment of a double.
+    /// If the buffer is full the overflow buffer is used.
+    /// If there is not enough space and asserts or exceptions are enabled an
+    /// etl::arena_no_allocation is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    void* allocate(size_t size, size_t alignment = etl::alignment_of<double>::value)
+    {
+      char* p = allocate_in(current, size, alignment);
+
+      if ((p == nullptr) && (current == 0U) && (segments[1U].p_begin != nullptr))
+      {
+        p = allocate_in(1U, size, alignment);
+
+        if (p != nullptr)
+        {
+          current = 1U;
+        }
+      }
+
+      if (p == nullptr)
+      {
+        ETL_ASSERT(false, ETL_ERROR(arena_no_allocation));
+        return nullptr;
+      }
+
+      p_next = p + size;
+
+      if (this->size() > peak_size)
+      {
+        peak_size = this->size();
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if allocate(size, alignment) would succeed.
+    //*************************************************************************
+    bool can_allocate(size_t size, size_t alignment = etl::alignment_of<double>::value) const
+    {
+      return (allocate_in(current, size, alignment) != nullptr) ||
+             ((current == 0U) && (segments[1U].p_begin != nullptr) && (allocate_in(1U, size, alignment) != nullptr));
+    }
+
+    //*************************************************************************
+    /// Allocates uninitialised storage for 'n' objects of type T.
+    /// If there is not enough space and asserts or exceptions are enabled an
+    /// etl::arena_no_allocation is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* allocate_array(size_t n)
+    {
+      return static_cast<T*>(allocate(sizeof(T) * n, etl::alignment_of<T>::value));
+    }
+
+#if !ETL_CPP11_SUPPORTED || defined(ETL_STLPORT) || defined(ETL_NO_STL)
+    //*************************************************************************
+    /// Creates a default constructed object in the arena.
+    /// If there is not enough space and asserts or exceptions are enabled an
+    /// etl::arena_no_allocation is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T>
+    T* create()
+    {
+      destructor_node* p_node;
+      T* p = allocate_object<T>(p_node);
+
+      if (p)
+      {
+        ::new (p) T();
+        add_destructor(p_node, p);
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Creates an object in the arena, constructed with 1 parameter.
+    /// If there is not enough space and asserts or exceptions are enabled an
+    /// etl::arena_no_allocation is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename T1>
+    T* create(const T1& value1)
+    {
+      destructor_node* p_node;
+      T* p = allocate_object<T>(p_node);
+
+      if (p)
+      {
+        ::new (p) T(value1);
+        add_destructor(p_node, p);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2>
+    T* create(const T1& value1, const T2& value2)
+    {
+      destructor_node* p_node;
+      T* p = allocate_object<T>(p_node);
+
+      if (p)
+      {
+        ::new (p) T(value1, value2);
+        add_destructor(p_node, p);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3>
+    T* create(const T1& value1, const T2& value2, const T3& value3)
+    {
+      destructor_node* p_node;
+      T* p = allocate_object<T>(p_node);
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3);
+        add_destructor(p_node, p);
+      }
+
+      return p;
+    }
+
+    template <typename T, typename T1, typename T2, typename T3, typename T4>
+    T* create(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      destructor_node* p_node;
+      T* p = allocate_object<T>(p_node);
+
+      if (p)
+      {
+        ::new (p) T(value1, value2, value3, value4);
+        add_destructor(p_node, p);
+      }
+
+      return p;
+    }
+#else
+    //*************************************************************************
+    /// Creates an object in the arena with variadic constructor parameters.
+    /// If there is not enough space and asserts or exceptions are enabled an
+    /// etl::arena_no_allocation is thrown, otherwise a nullptr is returned.
+    //*************************************************************************
+    template <typename T, typename... Args>
+    T* create(Args&&... args)
+    {
+      destructor_node* p_node;
+      T* p = allocate_object<T>(p_node);
+
+      if (p)
+      {
+        ::new (p) T(std::forward<Args>(args)...);
+        add_destructor(p_node, p);
+      }
+
+      return p;
+    }
+#endif
+
+    //*************************************************************************
+    /// Gets the current position, to roll back to later.
+    //*************************************************************************
+    checkpoint get_checkpoint() const
+    {
+      return checkpoint(current, p_next, p_destructors);
+    }
+
+    //*************************************************************************
+    /// Destroys the objects created since the checkpoint, in reverse order,
+    /// and frees everything allocated since.
+    /// If asserts or exceptions are enabled and the checkpoint is ahead of
+    /// the current position an etl::arena_invalid_checkpoint is thrown.
+    //*************************************************************************
+    void rollback(const checkpoint& cp)
+    {
+      const bool valid = (cp.segment < current) ||
+                         ((cp.segment == current) && (cp.p_next <= p_next));
+
+      ETL_ASSERT(valid, ETL_ERROR(arena_invalid_checkpoint));
+
+      if (valid)
+      {
+        destroy_until(cp.p_destructors);
+
+        current = cp.segment;
+        p_next  = cp.p_next;
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys every object created in the arena, in reverse order, and
+    /// frees everything.
+    //*************************************************************************
+    void reset()
+    {
+      destroy_until(nullptr);
+
+      current = 0U;
+      p_next  = segments[0U].p_begin;
+    }
+
+    //*************************************************************************
+    /// The number of bytes used, including alignment padding and any space
+    /// skipped at the end of the first buffer.
+    //*************************************************************************
+    size_t size() const
+    {
+      if (current == 0U)
+      {
+        return size_t(p_next - segments[0U].p_begin);
+      }
+      else
+      {
+        return segments[0U].size + size_t(p_next - segments[1U].p_begin);
+      }
+    }
+
+    //*************************************************************************
+    /// The total size of the buffers.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return segments[0U].size + segments[1U].size;
+    }
+
+    //*************************************************************************
+    /// The number of bytes left in the buffers.
+    //*************************************************************************
+    size_t available() const
+    {
+      return capacity() - size();
+    }
+
+    //*************************************************************************
+    /// The largest size() since construction or clear_peak().
+    //*************************************************************************
+    size_t peak() const
+    {
+      return peak_size;
+    }
+
+    //*************************************************************************
+    /// Sets the peak to the current size.
+    //*************************************************************************
+    void clear_peak()
+    {
+      peak_size = size();
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if allocations are being taken from the overflow buffer.
+    //*************************************************************************
+    bool is_overflowing() const
+    {
+      return current != 0U;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// A buffer to allocate from.
+    //*************************************************************************
+    struct segment
+    {
+      char*  p_begin;
+      size_t size;
+    };
+
+    //*************************************************************************
+    void set_segment(size_t index, void* p_buffer_, size_t size_)
+    {
+      segments[index].p_begin = static_cast<char*>(p_buffer_);
+      segments[index].size    = size_;
+    }
+
+    //*************************************************************************
+    /// Finds space in a segment, or returns nullptr.
+    //*************************************************************************
+    char* allocate_in(size_t index, size_t size, size_t alignment) const
+    {
+      const segment& s = segments[index];
+
+      char* p_start = (index == current) ? p_next : s.p_begin;
+
+      const size_t padding   = size_t(0U - reinterpret_cast<uintptr_t>(p_start)) & (alignment - 1U);
+      const size_t remaining = size_t((s.p_begin + s.size) - p_start);
+
+      if ((size > remaining) || (padding > (remaining - size)))
+      {
+        return nullptr;
+      }
+
+      return p_start + padding;
+    }
+
+    //*************************************************************************
+    /// Allocates storage for a T, and for its destructor if it has one.
+    //*************************************************************************
+    template <typename T>
+    T* allocate_object(destructor_node*& p_node)
+    {
+      p_node = nullptr;
+
+      if (!etl::is_trivially_destructible<T>::value)
+      {
+        p_node = static_cast<destructor_node*>(allocate(sizeof(destructor_node), etl::alignment_of<destructor_node>::value));
+
+        if (p_node == nullptr)
+        {
+          return nullptr;
+        }
+
+        p_node->destroy = &arena::destroy_object<T>;
+      }
+
+      return static_cast<T*>(allocate(sizeof(T), etl::alignment_of<T>::value));
+    }
+
+    //*************************************************************************
+    /// Registers the destructor of a newly created object.
+    //*************************************************************************
+    void add_destructor(destructor_node* p_node, void* p_object)
+    {
+      if (p_node != nullptr)
+      {
+        p_node->p_object = p_object;
+        p_node->p_next   = p_destructors;
+        p_destructors    = p_node;
+      }
+    }
+
+    //*************************************************************************
+    /// Destroys objects, newest first, until the destructor list is 'p_last'.
+    //*************************************************************************
+    void destroy_until(destructor_node* p_last)
+    {
+      while (p_destructors != p_last)
+      {
+        destructor_node* p_node = p_destructors;
+        p_destructors = p_node->p_next;
+        p_node->destroy(p_node->p_object);
+      }
+    }
+
+    //*************************************************************************
+    template <typename T>
+    static void destroy_object(void* p)
+    {
+      static_cast<T*>(p)->~T();
+    }
+
+    // Disable copy construction and assignment.
+    arena(const arena&);
+    arena& operator =(const arena&);
+
+    segment          segments[2];
+    size_t           current;
+    char*            p_next;
+    destructor_node* p_destructors;
+    size_t           peak_size;
+  };
+
+  //***************************************************************************
+  /// Rolls an arena back to where it was when the scope was entered.
+  ///\ingroup arena
+  //***************************************************************************
+  class arena_scope
+  {
+  public:
+
+    explicit arena_scope(etl::arena& arena_)
+      : a(arena_),
+        cp(arena_.get_checkpoint())
+    {
+    }
+
+    ~arena_scope()
+    {
+      a.rollback(cp);
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    arena_scope(const arena_scope&);
+    arena_scope& operator =(const arena_scope&);
+
+    etl::arena&            a;
+    etl::arena::checkpoint cp;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
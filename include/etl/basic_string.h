@@ -51,6 +51,9 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "exception.h"
 #include "memory.h"
+#include "nullptr.h"
+
+#include "private/string_search.h"
 
 #undef ETL_FILE
 #define ETL_FILE "27"
@@ -260,7 +263,7 @@ namespace etl
     bool            is_truncated;   ///< Set to true if the operation truncated the string.
     bool            clear_afer_use; ///< Set to true if the string must be cleared after use.
     size_type       current_size;   ///< The current number of elements in the string.
-    const size_type CAPACITY;       ///< The maximum number of elements in the string.
+    size_type       CAPACITY;       ///< The maximum number of elements in the string's current buffer.
   };
 
   //***************************************************************************
@@ -413,6 +416,8 @@ namespace etl
     //*********************************************************************
     void resize(size_t new_size, T value)
     {
+      ensure_capacity(new_size);
+
       if (new_size > CAPACITY)
       {
         is_truncated = true;
@@ -574,7 +579,7 @@ namespace etl
     {
       initialise();
 
-      while ((*other != 0) && (current_size < CAPACITY))
+      while ((*other != 0) && ((current_size < CAPACITY) || ensure_capacity(current_size + 1)))
       {
         p_buffer[current_size++] = *other++;
       }
@@ -593,6 +598,7 @@ namespace etl
     void assign(const_pointer other, size_t length_)
     {
       initialise();
+      ensure_capacity(length_);
 
       is_truncated = (length_ > CAPACITY);
 
@@ -621,7 +627,7 @@ namespace etl
 
       initialise();
 
-      while ((first != last) && (current_size != CAPACITY))
+      while ((first != last) && ((current_size != CAPACITY) || ensure_capacity(current_size + 1)))
       {
         p_buffer[current_size++] = *first++;
       }
@@ -640,6 +646,7 @@ namespace etl
     void assign(size_t n, T value)
     {
       initialise();
+      ensure_capacity(n);
 
       is_truncated = (n > CAPACITY);
 
@@ -665,7 +672,7 @@ namespace etl
     //*********************************************************************
     void push_back(T value)
     {
-      if (current_size != CAPACITY)
+      if ((current_size != CAPACITY) || ensure_capacity(current_size + 1))
       {
         p_buffer[current_size++] = value;
         p_buffer[current_size]   = 0;
@@ -770,13 +777,17 @@ namespace etl
     //*********************************************************************
     iterator insert(const_iterator position, T value)
     {
-      // Quick hack, as iterators are pointers.
-      iterator insert_position = const_cast<iterator>(position);
+      const size_t offset = std::distance(cbegin(), position);
+
+      ensure_capacity(current_size + 1);
+
+      // The buffer may have changed.
+      iterator insert_position = begin() + offset;
 
       if (current_size < CAPACITY)
       {
         // Not full yet.
-        if (position != end())
+        if (insert_position != end())
         {
           // Insert in the middle.
           ++current_size;
@@ -793,7 +804,7 @@ namespace etl
       else
       {
         // Already full.
-        if (position != end())
+        if (insert_position != end())
         {
           // Insert in the middle.
           std::copy_backward(insert_position, end() - 1, end());
@@ -821,10 +832,13 @@ namespace etl
         return;
       }
 
-      // Quick hack, as iterators are pointers.
-      iterator insert_position = const_cast<iterator>(position);
       const size_t start = std::distance(cbegin(), position);
 
+      ensure_capacity(current_size + n);
+
+      // The buffer may have changed.
+      iterator insert_position = begin() + start;
+
       // No effect.
       if (start >= CAPACITY)
       {
@@ -888,6 +902,11 @@ namespace etl
       const size_t start = std::distance(begin(), position);
       const size_t n = std::distance(first, last);
 
+      ensure_capacity(current_size + n);
+
+      // The buffer may have changed.
+      position = begin() + start;
+
       // No effect.
       if (start >= CAPACITY)
       {
@@ -1120,7 +1139,7 @@ namespace etl
         return npos;
       }
 
-      const_iterator iposition = std::search(begin() + pos, end(), str.begin(), str.end());
+      const_iterator iposition = etl::private_string_search::find_substring(begin() + pos, end(), str.data(), str.size());
 
       if (iposition == end())
       {
@@ -1146,7 +1165,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + etl::strlen(s));
+      const_iterator iposition = etl::private_string_search::find_substring(begin() + pos, end(), s, etl::strlen(s));
 
       if (iposition == end())
       {
@@ -1173,7 +1192,7 @@ namespace etl
       }
 #endif
 
-      const_iterator iposition = std::search(begin() + pos, end(), s, s + n);
+      const_iterator iposition = etl::private_string_search::find_substring(begin() + pos, end(), s, n);
 
       if (iposition == end())
       {
@@ -1192,7 +1211,12 @@ namespace etl
     //*********************************************************************
     size_t find(T c, size_t position = 0) const
     {
-      const_iterator i = std::find(begin() + position, end(), c);
+      if (position >= size())
+      {
+        return npos;
+      }
+
+      const_iterator i = etl::private_string_search::find_char(begin() + position, end(), c);
 
       if (i != end())
       {
@@ -1317,13 +1341,11 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
-
-      const_reverse_iterator i = std::find(rbegin() + position, rend(), c);
+      const_iterator i = etl::private_string_search::rfind_char(begin(), begin() + position, c);
 
-      if (i != rend())
+      if (i != (begin() + position))
       {
-        return size() - std::distance(rbegin(), i) - 1;
+        return std::distance(begin(), i);
       }
       else
       {
@@ -1643,15 +1665,11 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_t i = position; i < size(); ++i)
+        const_iterator i = etl::private_string_search::find_first_of(begin() + position, end(), s, n, true);
+
+        if (i != end())
         {
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
+          return std::distance(begin(), i);
         }
       }
 
@@ -1665,18 +1683,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_of(value_type c, size_t position = 0) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1714,23 +1721,17 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_iterator last = begin() + position + 1;
+      const_iterator i    = etl::private_string_search::find_last_of(begin(), last, s, n, true);
 
-      while (it != rend())
+      if (i == last)
       {
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
+        return npos;
+      }
+      else
+      {
+        return size_t(std::distance(begin(), i));
       }
-
-      return npos;
     }
 
     //*********************************************************************
@@ -1747,20 +1748,17 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_iterator last = begin() + position + 1;
+      const_iterator i    = etl::private_string_search::rfind_char(begin(), last, c);
 
-      while (it != rend())
+      if (i == last)
       {
-        if (p_buffer[position] == c)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
+        return npos;
+      }
+      else
+      {
+        return size_t(std::distance(begin(), i));
       }
-
-      return npos;
     }
 
     //*********************************************************************
@@ -1793,22 +1791,11 @@ namespace etl
     {
       if (position < size())
       {
-        for (size_t i = position; i < size(); ++i)
-        {
-          bool found = false;
+        const_iterator i = etl::private_string_search::find_first_of(begin() + position, end(), s, n, false);
 
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
+        if (i != end())
+        {
+          return std::distance(begin(), i);
         }
       }
 
@@ -1871,30 +1858,17 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_iterator last = begin() + position + 1;
+      const_iterator i    = etl::private_string_search::find_last_of(begin(), last, s, n, false);
 
-      while (it != rend())
+      if (i == last)
       {
-        bool found = false;
-
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
+        return npos;
+      }
+      else
+      {
+        return size_t(std::distance(begin(), i));
       }
-
-      return npos;
     }
 
     //*********************************************************************
@@ -1992,7 +1966,8 @@ namespace etl
     //*********************************************************************
     ibasic_string(T* p_buffer_, size_t MAX_SIZE_)
       : string_base(MAX_SIZE_),
-        p_buffer(p_buffer_)
+        p_buffer(p_buffer_),
+        p_grow(nullptr)
     {
     }
 
@@ -2015,8 +1990,46 @@ namespace etl
       p_buffer = p_buffer_;
     }
 
+    //*************************************************************************
+    /// Called when an operation needs more than the current capacity.
+    /// May move the contents to a larger buffer with set_buffer.
+    /// Returns true if the capacity is now at least new_size.
+    //*************************************************************************
+    typedef bool (*grow_function_t)(ibasic_string& str, size_t new_size);
+
+    //*************************************************************************
+    /// Sets the function to call when the string needs a larger buffer.
+    //*************************************************************************
+    void set_grow_function(grow_function_t p_grow_)
+    {
+      p_grow = p_grow_;
+    }
+
+    //*************************************************************************
+    /// Replaces the buffer. The contents must already have been copied.
+    //*************************************************************************
+    void set_buffer(T* p_buffer_, size_t capacity_)
+    {
+      p_buffer = p_buffer_;
+      CAPACITY = capacity_;
+    }
+
   private:
 
+    //*************************************************************************
+    /// Asks for a larger buffer if new_size will not fit.
+    /// Returns true if the capacity is at least new_size.
+    //*************************************************************************
+    bool ensure_capacity(size_t new_size)
+    {
+      if (new_size <= CAPACITY)
+      {
+        return true;
+      }
+
+      return (p_grow != nullptr) && p_grow(*this, new_size);
+    }
+
     //*************************************************************************
     /// Compare helper function
     //*************************************************************************
@@ -2078,6 +2091,11 @@ namespace etl
     //*************************************************************************
     T* p_buffer;
 
+    //*************************************************************************
+    /// Called when the buffer is too small. Null for fixed capacity strings.
+    //*************************************************************************
+    grow_function_t p_grow;
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -38,6 +38,8 @@ SOFTWARE.
 #include "stl/algorithm.h"
 #include "stl/iterator.h"
 
+#include "private/string_search.h"
+
 //*****************************************************************************
 ///\defgroup char_traits char_traits
 /// Character traits
@@ -114,20 +116,19 @@ namespace etl
       return a < b;
     }
 
+    //*************************************************************************
+    /// Reads one character at a time unless ETL_STRLEN_OVER_READ is defined.
+    /// Then whole aligned blocks or words are read, which may go past the
+    /// terminator. See platform.h.
     //*************************************************************************
     static size_t length(const char_type* str)
     {
-      size_t count = 0;
-
-      if (str != 0)
+      if (str == 0)
       {
-        while (*str++ != 0)
-        {
-          ++count;
-        }
+        return 0;
       }
 
-      return count;
+      return etl::private_string_search::length(str);
     }
 
     //*************************************************************************
@@ -150,15 +151,9 @@ namespace etl
     //*************************************************************************
     static char_type* move(char_type* dest, const char_type* src, size_t count)
     {
-      if ((dest < src) || (dest > (src + count)))
+      if (count != 0)
       {
-        etl::copy_n(src, src + count, dest);
-      }
-      else
-      {
-        etl::copy_n(std::reverse_iterator<char_type*>(src + count),
-                    count,
-                    std::reverse_iterator<char_type*>(dest + count));
+        memmove(dest, src, count * sizeof(char_type));
       }
 
       return dest;
@@ -167,7 +162,10 @@ namespace etl
     //*************************************************************************
     static char_type* copy(char_type* dest, const char_type* src, size_t count)
     {
-      etl::copy_n(src, src + count, dest);
+      if (count != 0)
+      {
+        memcpy(dest, src, count * sizeof(char_type));
+      }
 
       return dest;
     }
@@ -175,38 +173,16 @@ namespace etl
     //*************************************************************************
     static int compare(const char_type* s1, const char_type* s2, size_t count)
     {
-      for (size_t i = 0; i < count; ++i)
-      {
-        if (*s1 < *s2)
-        {
-          return -1;
-        }
-          else if (*s1 > *s2)
-        {
-          return 1;
-        }
-
-        ++s1;
-        ++s2;
-      }
-
-      return 0;
+      return etl::private_string_search::compare(s1, s2, count);
     }
 
     //*************************************************************************
     static const char_type* find(const char_type* p, size_t count, const char_type& ch)
     {
-      for (size_t i = 0; i < count; ++i)
-      {
-        if (*p == ch)
-        {
-          return p;
-        }
-
-        ++p;
-      }
+      const char_type* last   = p + count;
+      const char_type* result = etl::private_string_search::find_char(p, last, ch);
 
-      return 0;
+      return (result == last) ? 0 : result;
     }
 
     //*************************************************************************
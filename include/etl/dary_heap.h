@@ -0,0 +1,697 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_DARY_HEAP_INCLUDED
+#define ETL_DARY_HEAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+
+#include "stl/algorithm.h"
+#include "stl/functional.h"
+#include "stl/iterator.h"
+#include "stl/utility.h"
+
+#include "container.h"
+#include "vector.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "59"
+
+//*****************************************************************************
+///\defgroup dary_heap dary_heap
+/// Heap algorithms and a fixed capacity priority queue where each node has
+/// ARITY children. With four children the heap is half the depth of a
+/// binary heap and the children of a node are adjacent in memory, so a
+/// sift down touches fewer cache lines.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_dary_heap
+  {
+    //*************************************************************************
+    /// Allows a value to be moved, where supported.
+    //*************************************************************************
+#if ETL_CPP11_SUPPORTED
+    template <typename T>
+    T&& move(T& value)
+    {
+      return std::move(value);
+    }
+#else
+    template <typename T>
+    T& move(T& value)
+    {
+      return value;
+    }
+#endif
+
+    //*************************************************************************
+    /// Moves 'value' from the hole towards the top until the parent does not
+    /// compare less than it.
+    //*************************************************************************
+    template <const size_t ARITY, typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void sift_up(TIterator first, TDistance hole, TValue& value, TCompare& compare)
+    {
+      while (hole > 0)
+      {
+        const TDistance parent = (hole - 1) / TDistance(ARITY);
+
+        if (!compare(first[parent], value))
+        {
+          break;
+        }
+
+        first[hole] = private_dary_heap::move(first[parent]);
+        hole = parent;
+      }
+
+      first[hole] = private_dary_heap::move(value);
+    }
+
+    //*************************************************************************
+    /// Finds the greatest of the children starting at 'child'.
+    /// A node with all of its children is the common case, and has a fixed
+    /// count that the compiler may unroll.
+    //*************************************************************************
+    template <const size_t ARITY, typename TIterator, typename TDistance, typename TCompare>
+    TDistance best_child(TIterator first, TDistance child, TDistance length, TCompare& compare)
+    {
+      TDistance best = child;
+
+      if ((length - child) >= TDistance(ARITY))
+      {
+        for (size_t i = 1U; i < ARITY; ++i)
+        {
+          const TDistance next = child + TDistance(i);
+          best = compare(first[best], first[next]) ? next : best;
+        }
+      }
+      else
+      {
+        for (TDistance next = child + 1; next < length; ++next)
+        {
+          best = compare(first[best], first[next]) ? next : best;
+        }
+      }
+
+      return best;
+    }
+
+    //*************************************************************************
+    /// Moves 'value' from the hole towards the bottom until no child compares
+    /// greater than it.
+    //*************************************************************************
+    template <const size_t ARITY, typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void sift_down(TIterator first, TDistance hole, TDistance length, TValue& value, TCompare& compare)
+    {
+      while (true)
+      {
+        const TDistance child = (hole * TDistance(ARITY)) + 1;
+
+        if (child >= length)
+        {
+          break;
+        }
+
+        const TDistance best = best_child<ARITY>(first, child, length, compare);
+
+        if (!compare(value, first[best]))
+        {
+          break;
+        }
+
+        first[hole] = private_dary_heap::move(first[best]);
+        hole = best;
+      }
+
+      first[hole] = private_dary_heap::move(value);
+    }
+
+    //*************************************************************************
+    /// Moves the hole to a leaf, always through the greatest child, then
+    /// moves 'value' up from there. The value replacing the top usually
+    /// comes from the bottom, so this needs fewer comparisons than sift_down.
+    //*************************************************************************
+    template <const size_t ARITY, typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void sift_down_to_leaf(TIterator first, TDistance hole, TDistance length, TValue& value, TCompare& compare)
+    {
+      while (true)
+      {
+        const TDistance child = (hole * TDistance(ARITY)) + 1;
+
+        if (child >= length)
+        {
+          break;
+        }
+
+        const TDistance best = best_child<ARITY>(first, child, length, compare);
+
+        first[hole] = private_dary_heap::move(first[best]);
+        hole = best;
+      }
+
+      sift_up<ARITY>(first, hole, value, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// Adds the element at last - 1 to the d-ary heap in [first, last - 1).
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator, typename TCompare>
+  void push_dary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(ARITY >= 2, "A heap node must have at least two children");
+
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+    typedef typename std::iterator_traits<TIterator>::value_type      value_type;
+
+    const difference_type length = std::distance(first, last);
+
+    if (length > 1)
+    {
+      value_type value = private_dary_heap::move(first[length - 1]);
+      private_dary_heap::sift_up<ARITY>(first, length - 1, value, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// Adds the element at last - 1 to the d-ary heap in [first, last - 1).
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator>
+  void push_dary_heap(TIterator first, TIterator last)
+  {
+    typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+    etl::push_dary_heap<ARITY>(first, last, std::less<value_type>());
+  }
+
+  //***************************************************************************
+  /// Moves the top of the d-ary heap in [first, last) to last - 1 and makes
+  /// [first, last - 1) a heap.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator, typename TCompare>
+  void pop_dary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(ARITY >= 2, "A heap node must have at least two children");
+
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+    typedef typename std::iterator_traits<TIterator>::value_type      value_type;
+
+    const difference_type length = std::distance(first, last);
+
+    if (length > 1)
+    {
+      value_type value = private_dary_heap::move(first[length - 1]);
+      first[length - 1] = private_dary_heap::move(first[0]);
+      private_dary_heap::sift_down_to_leaf<ARITY>(first, difference_type(0), length - 1, value, compare);
+    }
+  }
+
+  //***************************************************************************
+  /// Moves the top of the d-ary heap in [first, last) to last - 1 and makes
+  /// [first, last - 1) a heap.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator>
+  void pop_dary_heap(TIterator first, TIterator last)
+  {
+    typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+    etl::pop_dary_heap<ARITY>(first, last, std::less<value_type>());
+  }
+
+  //***************************************************************************
+  /// Makes a d-ary heap from [first, last), bottom up, in linear time.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator, typename TCompare>
+  void make_dary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(ARITY >= 2, "A heap node must have at least two children");
+
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+    typedef typename std::iterator_traits<TIterator>::value_type      value_type;
+
+    const difference_type length = std::distance(first, last);
+
+    if (length > 1)
+    {
+      difference_type parent = (length - 2) / difference_type(ARITY);
+
+      while (true)
+      {
+        value_type value = private_dary_heap::move(first[parent]);
+        private_dary_heap::sift_down<ARITY>(first, parent, length, value, compare);
+
+        if (parent == 0)
+        {
+          break;
+        }
+
+        --parent;
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Makes a d-ary heap from [first, last), bottom up, in linear time.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator>
+  void make_dary_heap(TIterator first, TIterator last)
+  {
+    typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+    etl::make_dary_heap<ARITY>(first, last, std::less<value_type>());
+  }
+
+  //***************************************************************************
+  /// Checks that [first, last) is a d-ary heap.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator, typename TCompare>
+  bool is_dary_heap(TIterator first, TIterator last, TCompare compare)
+  {
+    ETL_STATIC_ASSERT(ARITY >= 2, "A heap node must have at least two children");
+
+    typedef typename std::iterator_traits<TIterator>::difference_type difference_type;
+
+    const difference_type length = std::distance(first, last);
+
+    for (difference_type i = 1; i < length; ++i)
+    {
+      if (compare(first[(i - 1) / difference_type(ARITY)], first[i]))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Checks that [first, last) is a d-ary heap.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  template <const size_t ARITY, typename TIterator>
+  bool is_dary_heap(TIterator first, TIterator last)
+  {
+    typedef typename std::iterator_traits<TIterator>::value_type value_type;
+
+    return etl::is_dary_heap<ARITY>(first, last, std::less<value_type>());
+  }
+
+  //***************************************************************************
+  /// The base class for dary_heap exceptions.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  class dary_heap_exception : public exception
+  {
+  public:
+
+    dary_heap_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the heap is full.
+  ///\ingroup dary_heap
+  //***************************************************************************
+  class dary_heap_full : public etl::dary_heap_exception
+  {
+  public:
+
+    dary_heap_full(string_type file_name_, numeric_type line_number_)
+      : dary_heap_exception(ETL_ERROR_TEXT("dary_heap:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup dary_heap
+  ///\brief The base for all d-ary heaps that contain a particular type.
+  /// It has the same interface as etl::ipriority_queue.
+  ///\tparam T        The type of value that the heap holds.
+  ///\tparam ARITY    The number of children of each node.
+  ///\tparam TCompare The comparison. The top compares greater than all other values.
+  //***************************************************************************
+  template <typename T, const size_t ARITY = 4, typename TCompare = std::less<T> >
+  class idary_heap
+  {
+  public:
+
+    ETL_STATIC_ASSERT(ARITY >= 2, "A heap node must have at least two children");
+
+    typedef T                     value_type;
+    typedef etl::ivector<T>       container_type;
+    typedef TCompare              compare_type;
+    typedef T&                    reference;
+    typedef const T&              const_reference;
+    typedef size_t                size_type;
+
+    static const size_t ARITY_VALUE = ARITY;
+
+  private:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// Gets a reference to the highest priority value.
+    //*************************************************************************
+    reference top()
+    {
+      return container.front();
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the highest priority value.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return container.front();
+    }
+
+    //*************************************************************************
+    /// Adds a value to the heap.
+    /// If asserts or exceptions are enabled, throws an etl::dary_heap_full
+    /// if the heap is already full.
+    //*************************************************************************
+    void push(parameter_t value)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::dary_heap_full));
+
+      container.push_back(value);
+      etl::push_dary_heap<ARITY>(container.begin(), container.end(), compare);
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Emplaces a value to the heap.
+    /// If asserts or exceptions are enabled, throws an etl::dary_heap_full
+    /// if the heap is already full.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::dary_heap_full));
+
+      container.emplace_back(std::forward<Args>(args)...);
+      etl::push_dary_heap<ARITY>(container.begin(), container.end(), compare);
+    }
+#endif
+
+    //*************************************************************************
+    /// Replaces the contents with a range, and makes it a heap in linear time.
+    /// If asserts or exceptions are enabled, throws an etl::dary_heap_full
+    /// if the range is larger than the capacity.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      ETL_ASSERT(static_cast<size_t>(std::distance(first, last)) <= max_size(), ETL_ERROR(etl::dary_heap_full));
+
+      container.assign(first, last);
+      etl::make_dary_heap<ARITY>(container.begin(), container.end(), compare);
+    }
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// Does nothing if the heap is empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (!empty())
+      {
+        etl::pop_dary_heap<ARITY>(container.begin(), container.end(), compare);
+        container.pop_back();
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the highest priority value, assigns it to destination and
+    /// removes it from the heap.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      destination = top();
+      pop();
+    }
+
+    //*************************************************************************
+    /// Returns the current number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return container.size();
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return container.max_size();
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return container.empty();
+    }
+
+    //*************************************************************************
+    /// Checks to see if the heap is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return container.full();
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return container.available();
+    }
+
+    //*************************************************************************
+    /// Clears the heap to the empty state.
+    //*************************************************************************
+    void clear()
+    {
+      container.clear();
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Make this a clone of the supplied heap.
+    //*************************************************************************
+    void clone(const idary_heap& other)
+    {
+      container.assign(other.container.cbegin(), other.container.cend());
+    }
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    explicit idary_heap(container_type& container_)
+      : container(container_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    idary_heap(const idary_heap&);
+
+    container_type& container;
+
+    TCompare compare;
+  };
+
+  template <typename T, const size_t ARITY, typename TCompare>
+  const size_t idary_heap<T, ARITY, TCompare>::ARITY_VALUE;
+
+  //***************************************************************************
+  ///\ingroup dary_heap
+  /// A fixed capacity d-ary heap.
+  ///\tparam T        The type of value that the heap holds.
+  ///\tparam SIZE     The maximum number of values.
+  ///\tparam ARITY    The number of children of each node.
+  ///\tparam TCompare The comparison. The top compares greater than all other values.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, const size_t ARITY = 4, typename TCompare = std::less<T> >
+  class dary_heap : public etl::idary_heap<T, ARITY, TCompare>
+  {
+  public:
+
+    typedef etl::idary_heap<T, ARITY, TCompare> base_t;
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    dary_heap()
+      : base_t(storage)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    dary_heap(const dary_heap& other)
+      : base_t(storage)
+    {
+      base_t::clone(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    dary_heap(TIterator first, TIterator last)
+      : base_t(storage)
+    {
+      base_t::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    dary_heap& operator = (const dary_heap& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    etl::vector<T, SIZE> storage;
+  };
+
+  template <typename T, const size_t SIZE, const size_t ARITY, typename TCompare>
+  const size_t dary_heap<T, SIZE, ARITY, TCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  ///\ingroup dary_heap
+  /// A d-ary heap that uses a buffer supplied on construction.
+  ///\tparam T        The type of value that the heap holds.
+  ///\tparam ARITY    The number of children of each node.
+  ///\tparam TCompare The comparison. The top compares greater than all other values.
+  //***************************************************************************
+  template <typename T, const size_t ARITY, typename TCompare>
+  class dary_heap<T, 0, ARITY, TCompare> : public etl::idary_heap<T, ARITY, TCompare>
+  {
+  public:
+
+    typedef etl::idary_heap<T, ARITY, TCompare> base_t;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param buffer   Storage for max_size values of T.
+    ///\param max_size The maximum number of values.
+    //*************************************************************************
+    dary_heap(void* buffer, size_t max_size)
+      : base_t(storage),
+        storage(buffer, max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    dary_heap(const dary_heap& other, void* buffer, size_t max_size)
+      : base_t(storage),
+        storage(buffer, max_size)
+    {
+      base_t::clone(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    //*************************************************************************
+    template <typename TIterator>
+    dary_heap(TIterator first, TIterator last, void* buffer, size_t max_size)
+      : base_t(storage),
+        storage(buffer, max_size)
+    {
+      base_t::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    dary_heap& operator = (const dary_heap& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction.
+    dary_heap(const dary_heap&);
+
+    etl::vector<T, 0> storage;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -1877,6 +1877,111 @@ namespace etl
       destroy_element_front();
     }
 
+    //*************************************************************************
+    /// Removes the 'n' oldest items from the deque.
+    /// If asserts or exceptions are enabled, throws an etl::deque_empty if there are fewer than 'n' items.
+    ///\param n The number of items to remove.
+    //*************************************************************************
+    void pop_front(size_t n)
+    {
+      ETL_ASSERT(n <= current_size, ETL_ERROR(deque_empty));
+
+      const size_t n1 = std::min(n, BUFFER_SIZE - static_cast<size_t>(_begin.index));
+
+      etl::destroy(p_buffer + _begin.index, p_buffer + _begin.index + n1);
+      etl::destroy(p_buffer, p_buffer + (n - n1));
+
+      _begin += difference_type(n);
+      current_size -= n;
+      ETL_SUBTRACT_DEBUG_COUNT(n)
+    }
+
+    //*************************************************************************
+    /// Adds a range of items to the back of the deque.
+    /// The items are copied to at most two contiguous blocks of the buffer.
+    /// If asserts or exceptions are enabled, throws an etl::deque_full if there is not enough free space.
+    ///\param range_begin The first item to add.
+    ///\param range_end   One past the last item to add.
+    //*************************************************************************
+    template<typename TIterator>
+    typename etl::enable_if<is_iterator<TIterator>::value, void>::type
+      push_back(TIterator range_begin, TIterator range_end)
+    {
+      const size_t n = std::distance(range_begin, range_end);
+
+      ETL_ASSERT(n <= available(), ETL_ERROR(deque_full));
+
+      const size_t n1 = std::min(n, BUFFER_SIZE - static_cast<size_t>(_end.index));
+
+      TIterator range_middle = range_begin;
+      std::advance(range_middle, n1);
+
+      etl::uninitialized_copy(range_begin, range_middle, p_buffer + _end.index);
+      etl::uninitialized_copy(range_middle, range_end, p_buffer);
+
+      _end += difference_type(n);
+      current_size += n;
+      ETL_ADD_DEBUG_COUNT(n)
+    }
+
+    //*************************************************************************
+    /// Calls f(pointer, size) for each contiguous block of items, from the
+    /// front to the back. There are at most two blocks.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_segment(TFunction f)
+    {
+      if (!empty())
+      {
+        if (_begin.index < _end.index)
+        {
+          f(p_buffer + _begin.index, current_size);
+        }
+        else
+        {
+          f(p_buffer + _begin.index, BUFFER_SIZE - static_cast<size_t>(_begin.index));
+
+          if (_end.index != 0)
+          {
+            f(p_buffer, static_cast<size_t>(_end.index));
+          }
+        }
+      }
+
+      return f;
+    }
+
+    //*************************************************************************
+    /// Calls f(const_pointer, size) for each contiguous block of items, from
+    /// the front to the back. There are at most two blocks.
+    ///\return The function.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_segment(TFunction f) const
+    {
+      if (!empty())
+      {
+        const_pointer p_data = p_buffer;
+
+        if (_begin.index < _end.index)
+        {
+          f(p_data + _begin.index, current_size);
+        }
+        else
+        {
+          f(p_data + _begin.index, BUFFER_SIZE - static_cast<size_t>(_begin.index));
+
+          if (_end.index != 0)
+          {
+            f(p_data, static_cast<size_t>(_end.index));
+          }
+        }
+      }
+
+      return f;
+    }
+
     //*************************************************************************
     /// Resizes the deque.
     /// If asserts or exceptions are enabled, throws an etl::deque_full is 'new_size' is too large.
@@ -0,0 +1,803 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FORMAT_INCLUDED
+#define ETL_FORMAT_INCLUDED
+
+///\ingroup string
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "basic_format_spec.h"
+#include "error_handler.h"
+#include "exception.h"
+#include "private/to_string_helper.h"
+
+#if ETL_CPP14_SUPPORTED
+
+#undef ETL_FILE
+#define ETL_FILE "56"
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup string
+  /// Exception base for format.
+  //***************************************************************************
+  class format_exception : public etl::exception
+  {
+  public:
+
+    format_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// Invalid format string exception.
+  //***************************************************************************
+  class format_syntax_exception : public etl::format_exception
+  {
+  public:
+
+    format_syntax_exception(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:syntax", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// Format string has too many segments exception.
+  //***************************************************************************
+  class format_full_exception : public etl::format_exception
+  {
+  public:
+
+    format_full_exception(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:full", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// Wrong number of arguments exception.
+  //***************************************************************************
+  class format_argument_exception : public etl::format_exception
+  {
+  public:
+
+    format_argument_exception(string_type file_name_, numeric_type line_number_)
+      : format_exception(ETL_ERROR_TEXT("format:arguments", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// A parsed replacement field.
+    /// {:[[fill]align][0][width][.precision][type]}
+    //*************************************************************************
+    template <typename TChar>
+    struct field
+    {
+      constexpr field()
+        : width(0)
+        , precision(0)
+        , fill(TChar(' '))
+        , align(0)
+        , type(0)
+        , has_precision(false)
+        , zero_pad(false)
+      {
+      }
+
+      uint32_t width;
+      uint32_t precision;
+      TChar    fill;
+      char     align;         ///< '<', '>' or 0 for the default for the type.
+      char     type;          ///< One of "bBcdfgopsxX" or 0 for the default for the type.
+      bool     has_precision;
+      bool     zero_pad;      ///< Pad numbers with zeros after the sign.
+    };
+
+    //*************************************************************************
+    /// A span of literal text, or a replacement field if text is null.
+    //*************************************************************************
+    template <typename TChar>
+    struct segment
+    {
+      constexpr segment()
+        : text(nullptr)
+        , length(0)
+        , spec()
+      {
+      }
+
+      const TChar*  text;
+      size_t        length;
+      field<TChar>  spec;
+    };
+
+    //*************************************************************************
+    /// Type erased argument.
+    /// Holds the address of the argument and the writer for its type.
+    //*************************************************************************
+    template <typename TChar>
+    struct argument
+    {
+      typedef void (*writer_t)(etl::ibasic_string<TChar>&, const void*, const field<TChar>&);
+
+      const void* value;
+      writer_t    write;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A format string, parsed into literal spans and replacement fields.
+  /// Declare as constexpr to parse the format string at compile time.
+  /// A malformed format string is then a compile error.
+  /// Supports "{}", "{:spec}", "{{" and "}}". Arguments are used in order.
+  /// The spec is [[fill]align][0][width][.precision][type]
+  /// align : '<' left, '>' right.
+  /// type  : 'd' decimal, 'b'/'B' binary, 'o' octal, 'x'/'X' hex,
+  ///         'f' fixed point, 'g' short round trip, 'c' character,
+  ///         's' string or 'true'/'false', 'p' pointer.
+  /// Floating point defaults to a short round trip (Grisu2; not always the
+  /// shortest), unless a precision is given. Numbers are right aligned and
+  /// text is left aligned by default.
+  ///\tparam MAX_SEGMENTS The maximum number of literal spans and fields.
+  //***************************************************************************
+  template <typename TChar, size_t MAX_SEGMENTS_ = 16U>
+  class basic_format_string
+  {
+  public:
+
+    typedef TChar value_type;
+
+    static const size_t MAX_SEGMENTS = MAX_SEGMENTS_;
+
+    typedef private_format::segment<TChar> segment_type;
+
+    //*************************************************************************
+    /// Construct from a string literal.
+    //*************************************************************************
+    template <size_t SIZE>
+    constexpr basic_format_string(const TChar (&text)[SIZE])
+      : segments()
+      , n_segments(0)
+      , n_fields(0)
+    {
+      parse(text, text + SIZE - 1);
+    }
+
+    //*************************************************************************
+    /// Construct from a pointer and length.
+    //*************************************************************************
+    constexpr basic_format_string(const TChar* text, size_t length)
+      : segments()
+      , n_segments(0)
+      , n_fields(0)
+    {
+      parse(text, text + length);
+    }
+
+    //*************************************************************************
+    /// The number of literal spans and fields.
+    //*************************************************************************
+    constexpr size_t size() const
+    {
+      return n_segments;
+    }
+
+    //*************************************************************************
+    /// The number of replacement fields.
+    //*************************************************************************
+    constexpr size_t number_of_fields() const
+    {
+      return n_fields;
+    }
+
+    //*************************************************************************
+    /// Gets a segment.
+    //*************************************************************************
+    constexpr const segment_type& operator [](size_t i) const
+    {
+      return segments[i];
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Splits the text into literal spans and replacement fields.
+    //*************************************************************************
+    constexpr void parse(const TChar* p, const TChar* const p_end)
+    {
+      const TChar* p_literal = p;
+
+      while (p != p_end)
+      {
+        if ((*p == TChar('{')) || (*p == TChar('}')))
+        {
+          const bool is_escape = ((p_end - p) > 1) && (*(p + 1) == *p);
+
+          if (is_escape)
+          {
+            // Keep the first brace as literal text and skip the second.
+            add_literal(p_literal, p + 1);
+            p += 2;
+            p_literal = p;
+          }
+          else if (*p == TChar('{'))
+          {
+            add_literal(p_literal, p);
+            p = parse_field(p + 1, p_end);
+            p_literal = p;
+          }
+          else
+          {
+            // An unmatched '}'.
+            ETL_ALWAYS_ASSERT(ETL_ERROR(format_syntax_exception));
+            return;
+          }
+        }
+        else
+        {
+          ++p;
+        }
+      }
+
+      add_literal(p_literal, p_end);
+    }
+
+    //*************************************************************************
+    /// Parses the field after the '{'.
+    /// \return A pointer to the character after the closing '}'.
+    //*************************************************************************
+    constexpr const TChar* parse_field(const TChar* p, const TChar* const p_end)
+    {
+      private_format::field<TChar> spec;
+
+      if ((p != p_end) && (*p == TChar(':')))
+      {
+        ++p;
+
+        // Fill and alignment.
+        if (((p_end - p) > 1) && is_align(*(p + 1)))
+        {
+          spec.fill  = *p;
+          spec.align = char(*(p + 1));
+          p += 2;
+        }
+        else if ((p != p_end) && is_align(*p))
+        {
+          spec.align = char(*p);
+          ++p;
+        }
+
+        // Zero padding.
+        if ((p != p_end) && (*p == TChar('0')))
+        {
+          if (spec.align == 0)
+          {
+            spec.fill     = TChar('0');
+            spec.align    = '>';
+            spec.zero_pad = true;
+          }
+
+          ++p;
+        }
+
+        p = parse_number(p, p_end, spec.width);
+
+        // Precision.
+        if ((p != p_end) && (*p == TChar('.')))
+        {
+          const TChar* const p_precision = p + 1;
+
+          p = parse_number(p_precision, p_end, spec.precision);
+          spec.has_precision = true;
+
+          if (p == p_precision)
+          {
+            ETL_ALWAYS_ASSERT(ETL_ERROR(format_syntax_exception));
+            return p_end;
+          }
+        }
+
+        if ((p != p_end) && is_type(*p))
+        {
+          spec.type = char(*p);
+          ++p;
+        }
+      }
+
+      if ((p == p_end) || (*p != TChar('}')))
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(format_syntax_exception));
+        return p_end;
+      }
+
+      if (add_segment())
+      {
+        segments[n_segments - 1].spec = spec;
+        ++n_fields;
+      }
+
+      return p + 1;
+    }
+
+    //*************************************************************************
+    /// Adds a literal span, if not empty.
+    //*************************************************************************
+    constexpr void add_literal(const TChar* p_begin, const TChar* p_end)
+    {
+      if ((p_begin != p_end) && add_segment())
+      {
+        segments[n_segments - 1].text   = p_begin;
+        segments[n_segments - 1].length = size_t(p_end - p_begin);
+      }
+    }
+
+    //*************************************************************************
+    /// Reserves the next segment.
+    //*************************************************************************
+    constexpr bool add_segment()
+    {
+      if (n_segments == MAX_SEGMENTS)
+      {
+        ETL_ALWAYS_ASSERT(ETL_ERROR(format_full_exception));
+        return false;
+      }
+
+      ++n_segments;
+
+      return true;
+    }
+
+    //*************************************************************************
+    constexpr const TChar* parse_number(const TChar* p, const TChar* const p_end, uint32_t& value)
+    {
+      while ((p != p_end) && (*p >= TChar('0')) && (*p <= TChar('9')))
+      {
+        value = (value * 10U) + uint32_t(*p - TChar('0'));
+        ++p;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    static constexpr bool is_align(TChar c)
+    {
+      return (c == TChar('<')) || (c == TChar('>'));
+    }
+
+    //*************************************************************************
+    static constexpr bool is_type(TChar c)
+    {
+      return (c == TChar('b')) || (c == TChar('B')) || (c == TChar('c')) || (c == TChar('d')) ||
+             (c == TChar('f')) || (c == TChar('g')) || (c == TChar('o')) || (c == TChar('p')) ||
+             (c == TChar('s')) || (c == TChar('x')) || (c == TChar('X'));
+    }
+
+    segment_type segments[MAX_SEGMENTS];
+    size_t       n_segments;
+    size_t       n_fields;
+  };
+
+  template <typename TChar, size_t MAX_SEGMENTS_>
+  const size_t basic_format_string<TChar, MAX_SEGMENTS_>::MAX_SEGMENTS;
+
+  typedef etl::basic_format_string<char>     format_string;
+  typedef etl::basic_format_string<wchar_t>  wformat_string;
+  typedef etl::basic_format_string<char16_t> u16format_string;
+  typedef etl::basic_format_string<char32_t> u32format_string;
+
+  namespace private_format
+  {
+    //*************************************************************************
+    /// Makes the to_string format spec for a field.
+    //*************************************************************************
+    template <typename TChar>
+    etl::basic_format_spec<etl::ibasic_string<TChar> > make_format_spec(const field<TChar>& spec, bool is_text)
+    {
+      etl::basic_format_spec<etl::ibasic_string<TChar> > format;
+
+      format.width(spec.width).precision(spec.precision).fill(spec.fill);
+
+      switch (spec.type)
+      {
+        case 'b': case 'B': format.binary();                    break;
+        case 'o':           format.octal();                     break;
+        case 'x':           format.hex().upper_case(false);     break;
+        case 'X': case 'p': format.hex();                       break;
+        default:                                                break;
+      }
+
+      if ((spec.align == '<') || ((spec.align == 0) && is_text))
+      {
+        format.left();
+      }
+      else
+      {
+        format.right();
+      }
+
+      return format;
+    }
+
+    //*************************************************************************
+    /// Appends text with alignment.
+    //*************************************************************************
+    template <typename TChar>
+    void write_text(etl::ibasic_string<TChar>& str, const TChar* p_begin, const TChar* p_end, const field<TChar>& spec)
+    {
+      const size_t start = str.size();
+
+      str.append(p_begin, p_end);
+
+      if (spec.width != 0U)
+      {
+        etl::private_to_string::add_alignment(str, start, make_format_spec(spec, true));
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the sign of a zero padded number in front of the padding, so
+    /// that "00-42" becomes "-0042".
+    ///\param start The offset of the first character of the field.
+    //*************************************************************************
+    template <typename TChar>
+    void move_sign_to_front(etl::ibasic_string<TChar>& str, size_t start)
+    {
+      size_t i = start;
+
+      while ((i < str.size()) && (str[i] == TChar('0')))
+      {
+        ++i;
+      }
+
+      if ((i != start) && (i < str.size()) && (str[i] == TChar('-')))
+      {
+        str[i]     = TChar('0');
+        str[start] = TChar('-');
+      }
+    }
+
+    //*************************************************************************
+    /// Writer for integrals.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    void write_integral(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      const T& v = *static_cast<const T*>(value);
+
+      if (spec.type == 'c')
+      {
+        const TChar c = TChar(v);
+        write_text(str, &c, &c + 1, spec);
+      }
+      else
+      {
+        const size_t start = str.size();
+
+        etl::private_to_string::to_string(v, str, make_format_spec(spec, false), true);
+
+        if (spec.zero_pad)
+        {
+          move_sign_to_front(str, start);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Writer for characters.
+    //*************************************************************************
+    template <typename TChar>
+    void write_char(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      const TChar& c = *static_cast<const TChar*>(value);
+
+      if ((spec.type == 0) || (spec.type == 'c'))
+      {
+        write_text(str, &c, &c + 1, spec);
+      }
+      else
+      {
+        typedef typename etl::make_unsigned<TChar>::type unsigned_t;
+        etl::private_to_string::to_string(unsigned_t(c), str, make_format_spec(spec, false), true);
+      }
+    }
+
+    //*************************************************************************
+    /// Writer for booleans.
+    //*************************************************************************
+    template <typename TChar>
+    void write_bool(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      const bool is_text = (spec.type == 0) || (spec.type == 's');
+
+      etl::basic_format_spec<etl::ibasic_string<TChar> > format = make_format_spec(spec, is_text);
+      format.boolalpha(is_text);
+
+      etl::private_to_string::to_string(*static_cast<const bool*>(value), str, format, true);
+    }
+
+    //*************************************************************************
+    /// Writer for floating point.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    void write_floating_point(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      etl::basic_format_spec<etl::ibasic_string<TChar> > format = make_format_spec(spec, false);
+      format.decimal().shortest((spec.type == 'g') || ((spec.type != 'f') && !spec.has_precision));
+
+      const size_t start = str.size();
+
+      etl::private_to_string::to_string(*static_cast<const T*>(value), str, format, true);
+
+      if (spec.zero_pad)
+      {
+        move_sign_to_front(str, start);
+      }
+    }
+
+    //*************************************************************************
+    /// Writer for pointers.
+    //*************************************************************************
+    template <typename TChar>
+    void write_pointer(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      field<TChar> pointer_spec = spec;
+      pointer_spec.type = (spec.type == 0) ? 'p' : spec.type;
+
+      etl::private_to_string::to_string(static_cast<const volatile void*>(value), str, make_format_spec(pointer_spec, false), true);
+    }
+
+    //*************************************************************************
+    /// Writer for null terminated strings.
+    //*************************************************************************
+    template <typename TChar>
+    void write_c_string(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      const TChar* p_begin = static_cast<const TChar*>(value);
+      const TChar* p_end   = p_begin;
+
+      while (*p_end != 0)
+      {
+        ++p_end;
+      }
+
+      write_text(str, p_begin, p_end, spec);
+    }
+
+    //*************************************************************************
+    /// Writer for strings.
+    //*************************************************************************
+    template <typename TChar>
+    void write_string(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      const etl::ibasic_string<TChar>& s = *static_cast<const etl::ibasic_string<TChar>*>(value);
+
+      write_text(str, s.data(), s.data() + s.size(), spec);
+    }
+
+    //*************************************************************************
+    /// Writer for string views.
+    //*************************************************************************
+    template <typename TChar, typename TTraits>
+    void write_string_view(etl::ibasic_string<TChar>& str, const void* value, const field<TChar>& spec)
+    {
+      const etl::basic_string_view<TChar, TTraits>& s = *static_cast<const etl::basic_string_view<TChar, TTraits>*>(value);
+
+      write_text(str, s.data(), s.data() + s.size(), spec);
+    }
+
+    //*************************************************************************
+    /// Makes the argument for each supported type.
+    //*************************************************************************
+    template <typename TChar, typename T>
+    typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value && !etl::is_same<T, TChar>::value, argument<TChar> >::type
+      make_argument(const T& value)
+    {
+      argument<TChar> a = { &value, &write_integral<TChar, T> };
+      return a;
+    }
+
+    template <typename TChar, typename T>
+    typename etl::enable_if<etl::is_same<T, TChar>::value, argument<TChar> >::type
+      make_argument(const T& value)
+    {
+      argument<TChar> a = { &value, &write_char<TChar> };
+      return a;
+    }
+
+    template <typename TChar, typename T>
+    typename etl::enable_if<etl::is_same<T, bool>::value, argument<TChar> >::type
+      make_argument(const T& value)
+    {
+      argument<TChar> a = { &value, &write_bool<TChar> };
+      return a;
+    }
+
+    template <typename TChar, typename T>
+    typename etl::enable_if<etl::is_floating_point<T>::value, argument<TChar> >::type
+      make_argument(const T& value)
+    {
+      argument<TChar> a = { &value, &write_floating_point<TChar, T> };
+      return a;
+    }
+
+    template <typename TChar, typename T>
+    typename etl::enable_if<!etl::is_same<typename etl::remove_cv<T>::type, TChar>::value, argument<TChar> >::type
+      make_argument(T* value)
+    {
+      argument<TChar> a = { const_cast<const void*>(static_cast<const volatile void*>(value)), &write_pointer<TChar> };
+      return a;
+    }
+
+    template <typename TChar>
+    argument<TChar> make_argument(const TChar* value)
+    {
+      argument<TChar> a = { value, &write_c_string<TChar> };
+      return a;
+    }
+
+    template <typename TChar>
+    argument<TChar> make_argument(const etl::ibasic_string<TChar>& value)
+    {
+      argument<TChar> a = { &value, &write_string<TChar> };
+      return a;
+    }
+
+    template <typename TChar, typename TTraits>
+    argument<TChar> make_argument(const etl::basic_string_view<TChar, TTraits>& value)
+    {
+      argument<TChar> a = { &value, &write_string_view<TChar, TTraits> };
+      return a;
+    }
+  }
+
+  //***************************************************************************
+  ///\ingroup string
+  /// Appends the formatted arguments to the string.
+  /// Literal spans are appended directly and each field is written in place
+  /// by the to_string writer for its argument type.
+  /// The output is truncated if the string is full.
+  //***************************************************************************
+  template <typename TChar, size_t MAX_SEGMENTS, typename... TArgs>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const etl::basic_format_string<TChar, MAX_SEGMENTS>& fmt, const TArgs&... args)
+  {
+    ETL_ASSERT(fmt.number_of_fields() == sizeof...(TArgs), ETL_ERROR(format_argument_exception));
+
+    const private_format::argument<TChar> arguments[sizeof...(TArgs) + 1] = { private_format::make_argument<TChar>(args)..., { nullptr, nullptr } };
+
+    size_t index = 0U;
+
+    for (size_t i = 0U; i < fmt.size(); ++i)
+    {
+      const private_format::segment<TChar>& segment = fmt[i];
+
+      if (segment.text != nullptr)
+      {
+        str.append(segment.text, segment.length);
+      }
+      else if (index < sizeof...(TArgs))
+      {
+        arguments[index].write(str, arguments[index].value, segment.spec);
+        ++index;
+      }
+    }
+
+    return str;
+  }
+
+#if defined(__cpp_consteval)
+  namespace private_format
+  {
+    //*************************************************************************
+    /// A format string literal, parsed by the consteval constructor.
+    //*************************************************************************
+    template <typename TChar>
+    struct literal_format_string
+    {
+      template <size_t SIZE>
+      consteval literal_format_string(const TChar (&text)[SIZE])
+        : fmt(text)
+      {
+      }
+
+      etl::basic_format_string<TChar> fmt;
+    };
+
+    //*************************************************************************
+    /// Stops a parameter taking part in template argument deduction.
+    //*************************************************************************
+    template <typename T>
+    struct non_deduced
+    {
+      typedef T type;
+    };
+  }
+
+  //***************************************************************************
+  ///\ingroup string
+  /// Appends the formatted arguments to the string.
+  /// The format string literal is parsed at compile time, and a syntax error
+  /// is a compile error.
+  //***************************************************************************
+  template <typename TChar, typename... TArgs>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, typename private_format::non_deduced<private_format::literal_format_string<TChar> >::type text, const TArgs&... args)
+  {
+    return etl::format_to(str, text.fmt, args...);
+  }
+#else
+  //***************************************************************************
+  ///\ingroup string
+  /// Appends the formatted arguments to the string.
+  /// Before C++20 the format string literal is parsed at runtime, on every call.
+  /// Use ETL_FORMAT_STRING, or a constexpr etl::basic_format_string, to parse
+  /// it at compile time.
+  //***************************************************************************
+  template <typename TChar, size_t SIZE, typename... TArgs>
+  etl::ibasic_string<TChar>& format_to(etl::ibasic_string<TChar>& str, const TChar (&text)[SIZE], const TArgs&... args)
+  {
+    return etl::format_to(str, etl::basic_format_string<TChar>(text), args...);
+  }
+#endif
+}
+
+//*****************************************************************************
+/// A format string literal parsed at compile time.
+/// etl::format_to(str, ETL_FORMAT_STRING("{} {:x}"), a, b);
+//*****************************************************************************
+#define ETL_FORMAT_STRING(text) \
+  ([]() -> const auto& \
+   { \
+     static constexpr etl::basic_format_string<etl::remove_cv<etl::remove_reference<decltype((text)[0])>::type>::type> fmt(text); \
+     return fmt; \
+   }())
+
+#undef ETL_FILE
+
+#endif
+
+#endif
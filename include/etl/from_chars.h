@@ -0,0 +1,764 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_FROM_CHARS_INCLUDED
+#define ETL_FROM_CHARS_INCLUDED
+
+#include <stdint.h>
+#include <string.h>
+#include <float.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "enum_type.h"
+#include "optional.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "private/eisel_lemire.h"
+
+#include "stl/limits.h"
+
+///\defgroup from_chars from_chars
+/// Allocation free parsing of integral and floating point values.
+/// Errors are reported in the result, not by exceptions.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a from_chars conversion.
+  ///\ingroup from_chars
+  //***************************************************************************
+  struct from_chars_status
+  {
+    enum enum_type
+    {
+      success,
+      invalid_argument,
+      result_out_of_range
+    };
+
+    ETL_DECLARE_ENUM_TYPE(from_chars_status, int)
+    ETL_ENUM_TYPE(success,             "success")
+    ETL_ENUM_TYPE(invalid_argument,    "invalid argument")
+    ETL_ENUM_TYPE(result_out_of_range, "result out of range")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of a from_chars conversion.
+  /// ptr points to the first character not matching the pattern, or to the
+  /// first character if there was no match.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename TChar>
+  struct from_chars_result
+  {
+    from_chars_result(const TChar* ptr_, etl::from_chars_status ec_)
+      : ptr(ptr_),
+        ec(ec_)
+    {
+    }
+
+    const TChar*           ptr;
+    etl::from_chars_status ec;
+  };
+
+  namespace private_from_chars
+  {
+    //*************************************************************************
+    /// The value of a digit in bases up to 36, or 36 if not a digit.
+    //*************************************************************************
+    template <typename TChar>
+    uint32_t digit_value(const TChar c)
+    {
+      if ((c >= TChar('0')) && (c <= TChar('9')))
+      {
+        return uint32_t(c - TChar('0'));
+      }
+      else if ((c >= TChar('a')) && (c <= TChar('z')))
+      {
+        return uint32_t(c - TChar('a')) + 10U;
+      }
+      else if ((c >= TChar('A')) && (c <= TChar('Z')))
+      {
+        return uint32_t(c - TChar('A')) + 10U;
+      }
+
+      return 36U;
+    }
+
+    //*************************************************************************
+    /// Parses eight decimal digits at once (SWAR).
+    /// Only for narrow characters.
+    /// \return <b>true</b> if the next eight characters were all digits.
+    //*************************************************************************
+    template <typename TChar>
+    bool parse_eight_digits(const TChar*, uint32_t&)
+    {
+      return false;
+    }
+
+    inline bool parse_eight_digits(const char* p, uint32_t& value)
+    {
+      // Load little endian, whatever the platform.
+      uint64_t v = 0U;
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        v |= uint64_t(uint8_t(p[i])) << (8U * i);
+      }
+
+      // All in the range '0' to '9'?
+      if ((((v & 0xF0F0F0F0F0F0F0F0ULL) | (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4U)) != 0x3333333333333333ULL))
+      {
+        return false;
+      }
+
+      // Combine pairs, then quads, then the two halves.
+      v = ((v & 0x0F0F0F0F0F0F0F0FULL) * 2561U) >> 8U;
+      v = ((v & 0x00FF00FF00FF00FFULL) * 6553601U) >> 16U;
+      value = uint32_t(((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32U);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Matches a lower case word, ignoring case.
+    //*************************************************************************
+    template <typename TChar>
+    bool match(const TChar* first, const TChar* last, const char* word)
+    {
+      for (; *word != '\0'; ++word, ++first)
+      {
+        if ((first == last) || ((*first != TChar(*word)) && (*first != TChar(*word - 'a' + 'A'))))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// The parts of a decimal floating point number.
+    /// value ~= mantissa * 10^exponent.
+    //*************************************************************************
+    template <typename TChar>
+    struct decimal_number
+    {
+      uint64_t     mantissa;           ///< The first 19 significant digits.
+      int          exponent;           ///< The exponent of the last digit of the mantissa.
+      int          explicit_exponent;  ///< The exponent after 'e'.
+      bool         truncated;          ///< Non-zero digits after the mantissa.
+      const TChar* integer_first;
+      const TChar* integer_last;
+      const TChar* fraction_first;
+      const TChar* fraction_last;
+    };
+
+    //*************************************************************************
+    /// Accumulates the digits of the integer or fraction part.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* parse_digits(const TChar* p, const TChar* last, decimal_number<TChar>& number, int& significant, const bool fraction)
+    {
+      while (p != last)
+      {
+        // Eight at a time, while they fit.
+        if ((number.mantissa != 0U) && (significant <= 11) && ((last - p) >= 8))
+        {
+          uint32_t eight;
+
+          if (parse_eight_digits(p, eight))
+          {
+            number.mantissa = (number.mantissa * 100000000U) + eight;
+            significant += 8;
+            number.exponent -= fraction ? 8 : 0;
+            p += 8;
+            continue;
+          }
+        }
+
+        const uint32_t d = digit_value(*p);
+
+        if (d > 9U)
+        {
+          break;
+        }
+
+        if ((number.mantissa == 0U) && (d == 0U))
+        {
+          // Leading zero.
+          number.exponent -= fraction ? 1 : 0;
+        }
+        else if (significant < 19)
+        {
+          number.mantissa = (number.mantissa * 10U) + d;
+          ++significant;
+          number.exponent -= fraction ? 1 : 0;
+        }
+        else
+        {
+          // Beyond the precision of the mantissa.
+          number.exponent += fraction ? 0 : 1;
+          number.truncated = number.truncated || (d != 0U);
+        }
+
+        ++p;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Parses an optional exponent.
+    /// \return The end of the exponent, or p if there was none.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* parse_exponent(const TChar* p, const TChar* last, int& exponent)
+    {
+      if ((p == last) || ((*p != TChar('e')) && (*p != TChar('E'))))
+      {
+        return p;
+      }
+
+      const TChar* q = p + 1;
+      bool negative = false;
+
+      if ((q != last) && ((*q == TChar('-')) || (*q == TChar('+'))))
+      {
+        negative = (*q == TChar('-'));
+        ++q;
+      }
+
+      if ((q == last) || (digit_value(*q) > 9U))
+      {
+        // Not an exponent, so the 'e' is not part of the number.
+        return p;
+      }
+
+      int value = 0;
+
+      for (; (q != last) && (digit_value(*q) <= 9U); ++q)
+      {
+        // Saturate well outside the range of any floating point type.
+        if (value < 100000)
+        {
+          value = (value * 10) + int(digit_value(*q));
+        }
+      }
+
+      exponent = negative ? -value : value;
+
+      return q;
+    }
+
+    //*************************************************************************
+    /// Builds the exact significant digits, and the exponent of the last.
+    //*************************************************************************
+    template <typename TChar>
+    void build_digits(const decimal_number<TChar>& number, etl::private_eisel_lemire::big_integer& digits, int& exponent)
+    {
+      // Enough digits to decide any halfway point.
+      const int MAX_DIGITS = 769;
+
+      int  count   = 0;
+      bool sticky  = false;
+      uint32_t chunk = 0U;
+      uint32_t chunk_scale = 1U;
+
+      exponent = number.explicit_exponent;
+
+      const TChar* parts[2][2] =
+      {
+        { number.integer_first,  number.integer_last },
+        { number.fraction_first, number.fraction_last }
+      };
+
+      for (int part = 0; part < 2; ++part)
+      {
+        for (const TChar* p = parts[part][0]; p != parts[part][1]; ++p)
+        {
+          const uint32_t d = digit_value(*p);
+
+          if ((count == 0) && (d == 0U))
+          {
+            // Leading zero.
+            exponent -= part;
+          }
+          else if (count < MAX_DIGITS)
+          {
+            chunk = (chunk * 10U) + d;
+            chunk_scale *= 10U;
+            ++count;
+            exponent -= part;
+
+            if (chunk_scale == 1000000000U)
+            {
+              digits.multiply(chunk_scale);
+              digits.add(chunk);
+              chunk = 0U;
+              chunk_scale = 1U;
+            }
+          }
+          else
+          {
+            exponent += 1 - part;
+            sticky = sticky || (d != 0U);
+          }
+        }
+      }
+
+      digits.multiply(chunk_scale);
+      digits.add(chunk);
+
+      // Dropped digits make the value a little larger than the digits kept.
+      if (sticky)
+      {
+        digits.multiply(10U);
+        digits.add(1U);
+        --exponent;
+      }
+    }
+
+    //*************************************************************************
+    /// The exact powers of ten for the fast path.
+    //*************************************************************************
+    template <typename T>
+    T exact_power_of_ten(const int e)
+    {
+      static const T powers[] =
+      {
+        T(1e0),  T(1e1),  T(1e2),  T(1e3),  T(1e4),  T(1e5),  T(1e6),  T(1e7),
+        T(1e8),  T(1e9),  T(1e10), T(1e11), T(1e12), T(1e13), T(1e14), T(1e15),
+        T(1e16), T(1e17), T(1e18), T(1e19), T(1e20), T(1e21), T(1e22)
+      };
+
+      return powers[e];
+    }
+
+    //*************************************************************************
+    /// Parses a float or double.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    etl::from_chars_result<TChar> parse_floating_point(const TChar* first, const TChar* last, T& value)
+    {
+      typedef etl::private_eisel_lemire::binary_format<T> format;
+      typedef typename format::bits_type                  bits_type;
+
+      const TChar* p = first;
+      bool negative = false;
+
+      if ((p != last) && (*p == TChar('-')))
+      {
+        negative = true;
+        ++p;
+      }
+
+      // Infinity and NaN.
+      if (match(p, last, "inf"))
+      {
+        p += match(p, last, "infinity") ? 8 : 3;
+        value = negative ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+        return etl::from_chars_result<TChar>(p, etl::from_chars_status::success);
+      }
+
+      if (match(p, last, "nan"))
+      {
+        p += 3;
+
+        // Optional (n-char-sequence).
+        if ((p != last) && (*p == TChar('(')))
+        {
+          const TChar* q = p + 1;
+
+          while ((q != last) && ((digit_value(*q) < 36U) || (*q == TChar('_'))))
+          {
+            ++q;
+          }
+
+          if ((q != last) && (*q == TChar(')')))
+          {
+            p = q + 1;
+          }
+        }
+
+        value = negative ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+        return etl::from_chars_result<TChar>(p, etl::from_chars_status::success);
+      }
+
+      decimal_number<TChar> number;
+      number.mantissa          = 0U;
+      number.exponent          = 0;
+      number.explicit_exponent = 0;
+      number.truncated         = false;
+
+      int significant = 0;
+
+      number.integer_first = p;
+      p = parse_digits(p, last, number, significant, false);
+      number.integer_last = p;
+
+      number.fraction_first = p;
+      number.fraction_last  = p;
+
+      if ((p != last) && (*p == TChar('.')))
+      {
+        number.fraction_first = p + 1;
+        p = parse_digits(p + 1, last, number, significant, true);
+        number.fraction_last = p;
+      }
+
+      if ((number.integer_first == number.integer_last) && (number.fraction_first == number.fraction_last))
+      {
+        return etl::from_chars_result<TChar>(first, etl::from_chars_status::invalid_argument);
+      }
+
+      p = parse_exponent(p, last, number.explicit_exponent);
+
+      if (number.mantissa == 0U)
+      {
+        value = negative ? -T(0) : T(0);
+        return etl::from_chars_result<TChar>(p, etl::from_chars_status::success);
+      }
+
+      const int exponent = number.exponent + number.explicit_exponent;
+
+#if !defined(FLT_EVAL_METHOD) || (FLT_EVAL_METHOD == 0)
+      // Clinger's fast path. Both the mantissa and the power of ten are exact,
+      // so one correctly rounded operation gives the correctly rounded result.
+      if (!number.truncated &&
+          (number.mantissa <= (2ULL << format::MANTISSA_EXPLICIT_BITS)) &&
+          (exponent >= -format::MAX_EXPONENT_FAST_PATH) &&
+          (exponent <= format::MAX_EXPONENT_FAST_PATH))
+      {
+        T result = T(number.mantissa);
+
+        if (exponent < 0)
+        {
+          result = result / exact_power_of_ten<T>(-exponent);
+        }
+        else
+        {
+          result = result * exact_power_of_ten<T>(exponent);
+        }
+
+        value = negative ? -result : result;
+        return etl::from_chars_result<TChar>(p, etl::from_chars_status::success);
+      }
+#endif
+
+      // Eisel-Lemire.
+      etl::private_eisel_lemire::adjusted_mantissa am = etl::private_eisel_lemire::compute_float<T>(exponent, number.mantissa);
+
+      bool decided = am.decided;
+
+      // The truncated digits lie between mantissa and mantissa + 1.
+      if (decided && number.truncated)
+      {
+        const etl::private_eisel_lemire::adjusted_mantissa am_plus = etl::private_eisel_lemire::compute_float<T>(exponent, number.mantissa + 1U);
+
+        decided = am_plus.decided && (am_plus.mantissa == am.mantissa) && (am_plus.power2 == am.power2);
+      }
+
+      bits_type bits = etl::private_eisel_lemire::to_bits<T>(am);
+
+      if (!decided)
+      {
+        // Compare the exact digits with the halfway points.
+        etl::private_eisel_lemire::big_integer digits;
+        int digits_exponent;
+
+        build_digits(number, digits, digits_exponent);
+        bits = etl::private_eisel_lemire::refine<T>(digits, digits_exponent, bits);
+      }
+
+      const bits_type infinity = bits_type(bits_type(format::INFINITE_POWER) << format::MANTISSA_EXPLICIT_BITS);
+
+      if ((bits == 0U) || (bits == infinity))
+      {
+        return etl::from_chars_result<TChar>(p, etl::from_chars_status::result_out_of_range);
+      }
+
+      T result;
+      memcpy(&result, &bits, sizeof(result));
+
+      value = negative ? -result : result;
+
+      return etl::from_chars_result<TChar>(p, etl::from_chars_status::success);
+    }
+  }
+
+  //***************************************************************************
+  /// Parses an integral value from [first, last).
+  /// The pattern is an optional '-', for signed types only, followed by
+  /// digits in the base. No prefix or leading whitespace is accepted.
+  /// Decimal digits are parsed eight at a time for narrow characters.
+  /// On error, value is unchanged.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value, const int base = 10)
+  {
+    typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+    if ((base < 2) || (base > 36))
+    {
+      return etl::from_chars_result<TChar>(first, etl::from_chars_status::invalid_argument);
+    }
+
+    const TChar* p = first;
+    bool negative  = false;
+
+    if (etl::is_signed<T>::value && (p != last) && (*p == TChar('-')))
+    {
+      negative = true;
+      ++p;
+    }
+
+    // The largest magnitude allowed.
+    const unsigned_t limit = negative ? unsigned_t(unsigned_t(0) - unsigned_t(etl::integral_limits<T>::min))
+                                      : unsigned_t(etl::integral_limits<T>::max);
+
+    const TChar* digits_first = p;
+    unsigned_t   magnitude    = 0U;
+    bool         overflow     = false;
+
+    if ((base == 10) && (limit >= 99999999U))
+    {
+      uint32_t eight;
+
+      while (((last - p) >= 8) &&
+             (magnitude <= unsigned_t((limit - 99999999U) / 100000000U)) &&
+             etl::private_from_chars::parse_eight_digits(p, eight))
+      {
+        magnitude = unsigned_t((magnitude * 100000000U) + eight);
+        p += 8;
+      }
+    }
+
+    for (; p != last; ++p)
+    {
+      const uint32_t d = etl::private_from_chars::digit_value(*p);
+
+      if (d >= uint32_t(base))
+      {
+        break;
+      }
+
+      if (!overflow)
+      {
+        if (magnitude > unsigned_t((limit - d) / unsigned_t(base)))
+        {
+          // Keep consuming the digits.
+          overflow = true;
+        }
+        else
+        {
+          magnitude = unsigned_t((magnitude * unsigned_t(base)) + d);
+        }
+      }
+    }
+
+    if (p == digits_first)
+    {
+      return etl::from_chars_result<TChar>(first, etl::from_chars_status::invalid_argument);
+    }
+
+    if (overflow)
+    {
+      return etl::from_chars_result<TChar>(p, etl::from_chars_status::result_out_of_range);
+    }
+
+    value = negative ? T(unsigned_t(unsigned_t(0) - magnitude)) : T(magnitude);
+
+    return etl::from_chars_result<TChar>(p, etl::from_chars_status::success);
+  }
+
+  //***************************************************************************
+  /// Parses a floating point value from [first, last).
+  /// The pattern is an optional '-' followed by decimal digits with an
+  /// optional '.' and exponent, or 'inf', 'infinity' or 'nan'.
+  /// The result is correctly rounded. long double is parsed as double.
+  /// Values that overflow or underflow to zero return result_out_of_range.
+  /// On error, value is unchanged.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value)
+  {
+    typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type parse_t;
+
+    parse_t result;
+    etl::from_chars_result<TChar> status = etl::private_from_chars::parse_floating_point(first, last, result);
+
+    if (status.ec == etl::from_chars_status::success)
+    {
+      value = T(result);
+    }
+
+    return status;
+  }
+
+  //***************************************************************************
+  /// Parses an integral value from a string view.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::basic_string_view<TChar, TTraits>& view, T& value, const int base = 10)
+  {
+    return etl::from_chars(view.data(), view.data() + view.size(), value, base);
+  }
+
+  //***************************************************************************
+  /// Parses a floating point value from a string view.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::basic_string_view<TChar, TTraits>& view, T& value)
+  {
+    return etl::from_chars(view.data(), view.data() + view.size(), value);
+  }
+
+  //***************************************************************************
+  /// Parses an integral value from a string.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::ibasic_string<TChar>& str, T& value, const int base = 10)
+  {
+    return etl::from_chars(str.data(), str.data() + str.size(), value, base);
+  }
+
+  //***************************************************************************
+  /// Parses a floating point value from a string.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const etl::ibasic_string<TChar>& str, T& value)
+  {
+    return etl::from_chars(str.data(), str.data() + str.size(), value);
+  }
+
+  //***************************************************************************
+  /// Converts all of [first, last) to an integral value.
+  /// \return The value, or an empty optional if the characters are not
+  /// entirely a valid number or it is out of range.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::optional<T> >::type
+    to_arithmetic(const TChar* first, const TChar* last, const int base = 10)
+  {
+    T value;
+    const etl::from_chars_result<TChar> result = etl::from_chars(first, last, value, base);
+
+    if ((result.ec == etl::from_chars_status::success) && (result.ptr == last))
+    {
+      return etl::optional<T>(value);
+    }
+
+    return etl::optional<T>();
+  }
+
+  //***************************************************************************
+  /// Converts all of [first, last) to a floating point value.
+  /// \return The value, or an empty optional if the characters are not
+  /// entirely a valid number or it is out of range.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::optional<T> >::type
+    to_arithmetic(const TChar* first, const TChar* last)
+  {
+    T value;
+    const etl::from_chars_result<TChar> result = etl::from_chars(first, last, value);
+
+    if ((result.ec == etl::from_chars_status::success) && (result.ptr == last))
+    {
+      return etl::optional<T>(value);
+    }
+
+    return etl::optional<T>();
+  }
+
+  //***************************************************************************
+  /// Converts all of a string view to an integral value.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::optional<T> >::type
+    to_arithmetic(const etl::basic_string_view<TChar, TTraits>& view, const int base = 10)
+  {
+    return etl::to_arithmetic<T>(view.data(), view.data() + view.size(), base);
+  }
+
+  //***************************************************************************
+  /// Converts all of a string view to a floating point value.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar, typename TTraits>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::optional<T> >::type
+    to_arithmetic(const etl::basic_string_view<TChar, TTraits>& view)
+  {
+    return etl::to_arithmetic<T>(view.data(), view.data() + view.size());
+  }
+
+  //***************************************************************************
+  /// Converts all of a string to an integral value.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::optional<T> >::type
+    to_arithmetic(const etl::ibasic_string<TChar>& str, const int base = 10)
+  {
+    return etl::to_arithmetic<T>(str.data(), str.data() + str.size(), base);
+  }
+
+  //***************************************************************************
+  /// Converts all of a string to a floating point value.
+  ///\ingroup from_chars
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::optional<T> >::type
+    to_arithmetic(const etl::ibasic_string<TChar>& str)
+  {
+    return etl::to_arithmetic<T>(str.data(), str.data() + str.size());
+  }
+}
+
+#endif
@@ -0,0 +1,813 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+#define ETL_INDEXED_PRIORITY_QUEUE_INCLUDED
+
+#include <stddef.h>
+
+#include <new>
+
+#include "platform.h"
+
+#include "stl/functional.h"
+#include "stl/iterator.h"
+#include "stl/utility.h"
+
+#include "alignment.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "60"
+
+//*****************************************************************************
+///\defgroup indexed_priority_queue indexed_priority_queue
+/// A fixed capacity priority queue where each value has a handle that may be
+/// used to change its priority or to remove it.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for indexed_priority_queue exceptions.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_exception : public exception
+  {
+  public:
+
+    indexed_priority_queue_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when the queue is full.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_full : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_full(string_type file_name_, numeric_type line_number_)
+      : indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The exception thrown when a handle does not refer to a value in the queue.
+  ///\ingroup indexed_priority_queue
+  //***************************************************************************
+  class indexed_priority_queue_handle : public etl::indexed_priority_queue_exception
+  {
+  public:
+
+    indexed_priority_queue_handle(string_type file_name_, numeric_type line_number_)
+      : indexed_priority_queue_exception(ETL_ERROR_TEXT("indexed_priority_queue:handle", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  ///\brief The base for all indexed priority queues that contain a particular type.
+  /// Values stay in the slot they were created in, and the d-ary heap holds
+  /// slot numbers, which are the handles. A handle is valid from the push that
+  /// returns it until the value is popped or erased, after which it may be
+  /// reused. The slots not in use are stacked in the unused part of the heap.
+  ///\tparam T        The type of value that the queue holds.
+  ///\tparam ARITY    The number of children of each heap node.
+  ///\tparam TCompare The comparison. The top compares greater than all other values.
+  //***************************************************************************
+  template <typename T, const size_t ARITY = 4, typename TCompare = std::less<T> >
+  class iindexed_priority_queue
+  {
+  public:
+
+    ETL_STATIC_ASSERT(ARITY >= 2, "A heap node must have at least two children");
+
+    typedef T        value_type;
+    typedef TCompare compare_type;
+    typedef T&       reference;
+    typedef const T& const_reference;
+    typedef size_t   size_type;
+    typedef size_t   handle_type;
+
+    //*************************************************************************
+    /// The storage for a value and its position in the heap.
+    //*************************************************************************
+    struct slot_type
+    {
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+      size_t position;
+    };
+
+    static const size_t    ARITY_VALUE = ARITY;
+    static const size_type NOT_QUEUED  = ~size_type(0); ///< The heap position of a slot that is not in use.
+
+  private:
+
+    typedef typename etl::parameter_type<T>::type parameter_t;
+
+  public:
+
+    //*************************************************************************
+    /// Gets a reference to the highest priority value.
+    //*************************************************************************
+    reference top()
+    {
+      return value(p_heap[0]);
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the highest priority value.
+    //*************************************************************************
+    const_reference top() const
+    {
+      return value(p_heap[0]);
+    }
+
+    //*************************************************************************
+    /// Gets the handle of the highest priority value.
+    //*************************************************************************
+    handle_type top_handle() const
+    {
+      return p_heap[0];
+    }
+
+    //*************************************************************************
+    /// Adds a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    handle_type push(parameter_t item)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::indexed_priority_queue_full));
+
+      const handle_type handle = p_heap[current_size];
+      ::new (static_cast<void*>(&p_slots[handle].value)) T(item);
+
+      insert_handle(handle);
+
+      return handle;
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT)
+    //*************************************************************************
+    /// Emplaces a value to the queue.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_full
+    /// if the queue is already full.
+    ///\return The handle of the value.
+    //*************************************************************************
+    template <typename ... Args>
+    handle_type emplace(Args && ... args)
+    {
+      ETL_ASSERT(!full(), ETL_ERROR(etl::indexed_priority_queue_full));
+
+      const handle_type handle = p_heap[current_size];
+      ::new (static_cast<void*>(&p_slots[handle].value)) T(std::forward<Args>(args)...);
+
+      insert_handle(handle);
+
+      return handle;
+    }
+#endif
+
+    //*************************************************************************
+    /// Replaces the contents with a range, and makes it a heap in linear time.
+    /// The value at offset i in the range has handle i.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_full
+    /// if the range is larger than the capacity.
+    //*************************************************************************
+    template <typename TIterator>
+    void assign(TIterator first, TIterator last)
+    {
+      ETL_ASSERT(static_cast<size_t>(std::distance(first, last)) <= MAX_SIZE, ETL_ERROR(etl::indexed_priority_queue_full));
+
+      clear();
+      initialise_slots();
+
+      while (first != last)
+      {
+        ::new (static_cast<void*>(&p_slots[current_size].value)) T(*first);
+        p_slots[current_size].position = current_size;
+        ++current_size;
+        ++first;
+      }
+
+      heapify();
+    }
+
+    //*************************************************************************
+    /// Removes the highest priority value.
+    /// Does nothing if the queue is empty.
+    //*************************************************************************
+    void pop()
+    {
+      if (!empty())
+      {
+        remove_handle(p_heap[0]);
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the highest priority value, assigns it to destination and
+    /// removes it from the queue.
+    //*************************************************************************
+    void pop_into(reference destination)
+    {
+      destination = top();
+      pop();
+    }
+
+    //*************************************************************************
+    /// Checks that a handle refers to a value in the queue.
+    //*************************************************************************
+    bool contains(handle_type handle) const
+    {
+      return (handle < MAX_SIZE) && (p_slots[handle].position != NOT_QUEUED);
+    }
+
+    //*************************************************************************
+    /// Gets the value for a handle.
+    /// If the value's priority is changed through the reference then
+    /// update_priority(handle) must be called.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_handle
+    /// if the handle is not in the queue.
+    //*************************************************************************
+    reference operator [](handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_handle));
+
+      return value(handle);
+    }
+
+    //*************************************************************************
+    /// Gets the value for a handle.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_handle
+    /// if the handle is not in the queue.
+    //*************************************************************************
+    const_reference operator [](handle_type handle) const
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_handle));
+
+      return value(handle);
+    }
+
+    //*************************************************************************
+    /// Replaces the value for a handle and restores the heap.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_handle
+    /// if the handle is not in the queue.
+    //*************************************************************************
+    void update_priority(handle_type handle, parameter_t item)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_handle));
+
+      value(handle) = item;
+      restore(p_slots[handle].position);
+    }
+
+    //*************************************************************************
+    /// Restores the heap after the value for a handle was changed in place.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_handle
+    /// if the handle is not in the queue.
+    //*************************************************************************
+    void update_priority(handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_handle));
+
+      restore(p_slots[handle].position);
+    }
+
+    //*************************************************************************
+    /// Removes the value for a handle.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_handle
+    /// if the handle is not in the queue.
+    //*************************************************************************
+    void erase(handle_type handle)
+    {
+      ETL_ASSERT(contains(handle), ETL_ERROR(etl::indexed_priority_queue_handle));
+
+      remove_handle(handle);
+    }
+
+    //*************************************************************************
+    /// Returns the current number of values.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// Returns the maximum number of values.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is empty.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// Checks to see if the queue is full.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Returns the remaining capacity.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+    //*************************************************************************
+    /// Clears the queue to the empty state.
+    /// All handles become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < current_size; ++i)
+      {
+        const handle_type handle = p_heap[i];
+
+        etl::destroy_at(&value(handle));
+        p_slots[handle].position = NOT_QUEUED;
+      }
+
+      current_size = 0U;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iindexed_priority_queue(slot_type* p_slots_, handle_type* p_heap_, size_t max_size_)
+      : p_slots(p_slots_),
+        p_heap(p_heap_),
+        current_size(0U),
+        MAX_SIZE(max_size_)
+    {
+      initialise_slots();
+    }
+
+    //*************************************************************************
+    /// Make this a clone of the supplied queue. Handles are preserved.
+    /// If asserts or exceptions are enabled, throws an etl::indexed_priority_queue_full
+    /// if the other queue has a larger capacity.
+    //*************************************************************************
+    void clone(const iindexed_priority_queue& other)
+    {
+      ETL_ASSERT(other.MAX_SIZE <= MAX_SIZE, ETL_ERROR(etl::indexed_priority_queue_full));
+
+      clear();
+
+      for (size_t i = 0U; i < other.current_size; ++i)
+      {
+        const handle_type handle = other.p_heap[i];
+
+        ::new (static_cast<void*>(&p_slots[handle].value)) T(other.value(handle));
+        p_slots[handle].position = i;
+        p_heap[i] = handle;
+      }
+
+      current_size = other.current_size;
+
+      // Stack the unused slots.
+      size_t free_position = current_size;
+
+      for (handle_type handle = 0U; handle < MAX_SIZE; ++handle)
+      {
+        if (p_slots[handle].position == NOT_QUEUED)
+        {
+          p_heap[free_position++] = handle;
+        }
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Marks all slots as unused.
+    //*************************************************************************
+    void initialise_slots()
+    {
+      for (size_t i = 0U; i < MAX_SIZE; ++i)
+      {
+        p_heap[i]           = i;
+        p_slots[i].position = NOT_QUEUED;
+      }
+    }
+
+    //*************************************************************************
+    reference value(handle_type handle)
+    {
+      return *reinterpret_cast<T*>(&p_slots[handle].value);
+    }
+
+    //*************************************************************************
+    const_reference value(handle_type handle) const
+    {
+      return *reinterpret_cast<const T*>(&p_slots[handle].value);
+    }
+
+    //*************************************************************************
+    /// Places a handle at heap position.
+    //*************************************************************************
+    void place(size_t position, handle_type handle)
+    {
+      p_heap[position] = handle;
+      p_slots[handle].position = position;
+    }
+
+    //*************************************************************************
+    /// Adds the handle of a newly constructed value, which is the first
+    /// unused slot, to the heap.
+    //*************************************************************************
+    void insert_handle(handle_type handle)
+    {
+      p_slots[handle].position = current_size;
+      ++current_size;
+
+      sift_up(current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Destroys the value for a handle and removes it from the heap.
+    //*************************************************************************
+    void remove_handle(handle_type handle)
+    {
+      const size_t position = p_slots[handle].position;
+
+      etl::destroy_at(&value(handle));
+
+      --current_size;
+
+      const handle_type last = p_heap[current_size];
+
+      // The slot goes on top of the unused stack.
+      p_heap[current_size] = handle;
+      p_slots[handle].position = NOT_QUEUED;
+
+      if (position != current_size)
+      {
+        place(position, last);
+
+        if (sift_up(position) == position)
+        {
+          sift_down_to_leaf(position);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Restores the heap after the value at position has changed.
+    //*************************************************************************
+    void restore(size_t position)
+    {
+      if (sift_up(position) == position)
+      {
+        sift_down(position);
+      }
+    }
+
+    //*************************************************************************
+    /// Makes a heap of the first current_size positions, bottom up.
+    //*************************************************************************
+    void heapify()
+    {
+      if (current_size > 1U)
+      {
+        size_t parent = (current_size - 2U) / ARITY;
+
+        while (true)
+        {
+          sift_down(parent);
+
+          if (parent == 0U)
+          {
+            break;
+          }
+
+          --parent;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the handle at position towards the top.
+    ///\return The new position.
+    //*************************************************************************
+    size_t sift_up(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+      const_reference item = value(handle);
+
+      while (position > 0U)
+      {
+        const size_t parent = (position - 1U) / ARITY;
+
+        if (!compare(value(p_heap[parent]), item))
+        {
+          break;
+        }
+
+        place(position, p_heap[parent]);
+        position = parent;
+      }
+
+      place(position, handle);
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// Finds the heap position of the greatest of the children starting at
+    /// 'child'.
+    //*************************************************************************
+    size_t best_child(size_t child)
+    {
+      size_t best = child;
+
+      if ((current_size - child) >= ARITY)
+      {
+        for (size_t i = 1U; i < ARITY; ++i)
+        {
+          best = compare(value(p_heap[best]), value(p_heap[child + i])) ? child + i : best;
+        }
+      }
+      else
+      {
+        for (size_t next = child + 1U; next < current_size; ++next)
+        {
+          best = compare(value(p_heap[best]), value(p_heap[next])) ? next : best;
+        }
+      }
+
+      return best;
+    }
+
+    //*************************************************************************
+    /// Moves the hole at position to a leaf, always through the greatest
+    /// child, then moves the handle up from there. A handle that came from the
+    /// bottom of the heap usually belongs near the bottom, so this needs fewer
+    /// comparisons than sift_down.
+    //*************************************************************************
+    void sift_down_to_leaf(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+
+      while (true)
+      {
+        const size_t child = (position * ARITY) + 1U;
+
+        if (child >= current_size)
+        {
+          break;
+        }
+
+        const size_t best = best_child(child);
+
+        place(position, p_heap[best]);
+        position = best;
+      }
+
+      place(position, handle);
+      sift_up(position);
+    }
+
+    //*************************************************************************
+    /// Moves the handle at position towards the bottom.
+    //*************************************************************************
+    void sift_down(size_t position)
+    {
+      const handle_type handle = p_heap[position];
+      const_reference item = value(handle);
+
+      while (true)
+      {
+        const size_t child = (position * ARITY) + 1U;
+
+        if (child >= current_size)
+        {
+          break;
+        }
+
+        const size_t best = best_child(child);
+
+        if (!compare(item, value(p_heap[best])))
+        {
+          break;
+        }
+
+        place(position, p_heap[best]);
+        position = best;
+      }
+
+      place(position, handle);
+    }
+
+    // Disable copy construction.
+    iindexed_priority_queue(const iindexed_priority_queue&);
+
+    slot_type*   p_slots;
+    handle_type* p_heap;
+    size_t       current_size;
+    const size_t MAX_SIZE;
+
+    TCompare compare;
+  };
+
+  template <typename T, const size_t ARITY, typename TCompare>
+  const size_t iindexed_priority_queue<T, ARITY, TCompare>::ARITY_VALUE;
+
+  template <typename T, const size_t ARITY, typename TCompare>
+  const typename iindexed_priority_queue<T, ARITY, TCompare>::size_type iindexed_priority_queue<T, ARITY, TCompare>::NOT_QUEUED;
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// A fixed capacity indexed priority queue.
+  ///\tparam T        The type of value that the queue holds.
+  ///\tparam SIZE     The maximum number of values.
+  ///\tparam ARITY    The number of children of each heap node.
+  ///\tparam TCompare The comparison. The top compares greater than all other values.
+  //***************************************************************************
+  template <typename T, const size_t SIZE, const size_t ARITY = 4, typename TCompare = std::less<T> >
+  class indexed_priority_queue : public etl::iindexed_priority_queue<T, ARITY, TCompare>
+  {
+  public:
+
+    typedef etl::iindexed_priority_queue<T, ARITY, TCompare> base_t;
+
+    static const size_t MAX_SIZE = SIZE;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    indexed_priority_queue()
+      : base_t(slots, heap, SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Handles are preserved.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& other)
+      : base_t(slots, heap, SIZE)
+    {
+      base_t::clone(other);
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    /// The value at offset i in the range has handle i.
+    //*************************************************************************
+    template <typename TIterator>
+    indexed_priority_queue(TIterator first, TIterator last)
+      : base_t(slots, heap, SIZE)
+    {
+      base_t::assign(first, last);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator. Handles are preserved.
+    //*************************************************************************
+    indexed_priority_queue& operator = (const indexed_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    typename base_t::slot_type   slots[SIZE];
+    typename base_t::handle_type heap[SIZE];
+  };
+
+  template <typename T, const size_t SIZE, const size_t ARITY, typename TCompare>
+  const size_t indexed_priority_queue<T, SIZE, ARITY, TCompare>::MAX_SIZE;
+
+  //***************************************************************************
+  ///\ingroup indexed_priority_queue
+  /// An indexed priority queue that uses buffers supplied on construction.
+  ///\tparam T        The type of value that the queue holds.
+  ///\tparam ARITY    The number of children of each heap node.
+  ///\tparam TCompare The comparison. The top compares greater than all other values.
+  //***************************************************************************
+  template <typename T, const size_t ARITY, typename TCompare>
+  class indexed_priority_queue<T, 0, ARITY, TCompare> : public etl::iindexed_priority_queue<T, ARITY, TCompare>
+  {
+  public:
+
+    typedef etl::iindexed_priority_queue<T, ARITY, TCompare> base_t;
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param slot_buffer Storage for max_size slots.
+    ///\param heap_buffer Storage for max_size handles.
+    ///\param max_size    The maximum number of values.
+    //*************************************************************************
+    indexed_priority_queue(typename base_t::slot_type* slot_buffer, typename base_t::handle_type* heap_buffer, size_t max_size)
+      : base_t(slot_buffer, heap_buffer, max_size)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor. Handles are preserved.
+    //*************************************************************************
+    indexed_priority_queue(const indexed_priority_queue& other, typename base_t::slot_type* slot_buffer, typename base_t::handle_type* heap_buffer, size_t max_size)
+      : base_t(slot_buffer, heap_buffer, max_size)
+    {
+      base_t::clone(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~indexed_priority_queue()
+    {
+      base_t::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator. Handles are preserved.
+    //*************************************************************************
+    indexed_priority_queue& operator = (const indexed_priority_queue& rhs)
+    {
+      if (&rhs != this)
+      {
+        base_t::clone(rhs);
+      }
+
+      return *this;
+    }
+
+  private:
+
+    // Disable copy construction.
+    indexed_priority_queue(const indexed_priority_queue&);
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -1596,6 +1596,53 @@ namespace etl
     }
 #endif
 
+    //*************************************************************************
+    /// Moves the nodes to the lowest addresses in the pool, in list order, so
+    /// that walking the list walks forwards through memory.
+    /// Only done if all of the pool's nodes belong to this list.
+    /// Invalidates iterators.
+    ///\return <b>true</b> if the nodes were moved.
+    //*************************************************************************
+    bool compact()
+    {
+      ETL_ASSERT(p_node_pool != nullptr, ETL_ERROR(list_no_pool));
+
+      if (p_node_pool->size() != size())
+      {
+        return false;
+      }
+
+      p_node_pool->begin_relayout();
+
+      // Number the nodes in list order.
+      node_t* p_node  = terminal_node.next;
+      size_t position = 0U;
+
+      while (p_node != &terminal_node)
+      {
+        node_t* p_next = p_node->next;
+        p_node_pool->set_relayout_position(p_node, position++);
+        p_node = p_next;
+      }
+
+      relayout_mover mover;
+      p_node_pool->end_relayout(mover);
+
+      // Link them in address order.
+      node_t* p_previous = &terminal_node;
+
+      for (size_t i = 0U; i < position; ++i)
+      {
+        p_node = static_cast<data_node_t*>(p_node_pool->item_address(i));
+        join(*p_previous, *p_node);
+        p_previous = p_node;
+      }
+
+      join(*p_previous, terminal_node);
+
+      return true;
+    }
+
     //*************************************************************************
     /// Sort using in-place merge sort algorithm.
     /// Uses 'less-than operator as the predicate.
@@ -1934,6 +1981,28 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT
     }
 
+    //*************************************************************************
+    /// Moves the values of nodes for compact().
+    //*************************************************************************
+    struct relayout_mover
+    {
+      void move(void* p_from, void* p_to)
+      {
+        T& from = static_cast<data_node_t*>(p_from)->value;
+#if ETL_CPP11_SUPPORTED
+        ::new (&(static_cast<data_node_t*>(p_to)->value)) T(std::move(from));
+#else
+        ::new (&(static_cast<data_node_t*>(p_to)->value)) T(from);
+#endif
+        from.~T();
+      }
+
+      void swap(void* p_item1, void* p_item2)
+      {
+        std::swap(static_cast<data_node_t*>(p_item1)->value, static_cast<data_node_t*>(p_item2)->value);
+      }
+    };
+
     // Disable copy construction.
     ilist(const ilist&);
 
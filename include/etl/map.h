@@ -1247,6 +1247,42 @@ namespace etl
       return vcompare;
     };
 
+    //*************************************************************************
+    /// Moves the nodes to the lowest addresses in the pool, in key order, and
+    /// rebuilds the tree fully balanced, so that walking the map walks forwards
+    /// through memory.
+    /// Only done if all of the pool's nodes belong to this map.
+    /// Invalidates iterators.
+    ///\return <b>true</b> if the nodes were moved.
+    //*************************************************************************
+    bool compact()
+    {
+      if (p_node_pool->size() != size())
+      {
+        return false;
+      }
+
+      p_node_pool->begin_relayout();
+
+      // Number the nodes in key order.
+      Node* p_node    = make_vine();
+      size_t position = 0U;
+
+      while (p_node != nullptr)
+      {
+        Node* p_next = p_node->children[kRight];
+        p_node_pool->set_relayout_position(p_node, position++);
+        p_node = p_next;
+      }
+
+      relayout_mover mover;
+      p_node_pool->end_relayout(mover);
+
+      root_node = build_balanced_tree(0U, position);
+
+      return true;
+    }
+
   protected:
 
     //*************************************************************************
@@ -1289,6 +1325,120 @@ namespace etl
       ETL_DECREMENT_DEBUG_COUNT
     }
 
+    //*************************************************************************
+    /// Moves the values of nodes for compact().
+    //*************************************************************************
+    struct relayout_mover
+    {
+      void move(void* p_from, void* p_to)
+      {
+        value_type& from = static_cast<Data_Node*>(p_from)->value;
+#if ETL_CPP11_SUPPORTED
+        ::new ((void*)&(static_cast<Data_Node*>(p_to)->value)) value_type(std::move(from));
+#else
+        ::new ((void*)&(static_cast<Data_Node*>(p_to)->value)) value_type(from);
+#endif
+        from.~value_type();
+      }
+
+      // The keys are const, so the values are exchanged by reconstructing them.
+      void swap(void* p_item1, void* p_item2)
+      {
+        value_type& value1 = static_cast<Data_Node*>(p_item1)->value;
+#if ETL_CPP11_SUPPORTED
+        value_type temp(std::move(value1));
+#else
+        value_type temp(value1);
+#endif
+        value1.~value_type();
+        move(p_item2, p_item1);
+#if ETL_CPP11_SUPPORTED
+        ::new ((void*)&(static_cast<Data_Node*>(p_item2)->value)) value_type(std::move(temp));
+#else
+        ::new ((void*)&(static_cast<Data_Node*>(p_item2)->value)) value_type(temp);
+#endif
+      }
+    };
+
+    //*************************************************************************
+    /// Rotates the tree into a list of nodes in key order, linked by their
+    /// right children.
+    ///\return The first node.
+    //*************************************************************************
+    Node* make_vine()
+    {
+      Node head;
+      head.children[kRight] = root_node;
+
+      Node* p_tail = &head;
+      Node* p_rest = root_node;
+
+      while (p_rest != nullptr)
+      {
+        if (p_rest->children[kLeft] == nullptr)
+        {
+          p_tail = p_rest;
+          p_rest = p_rest->children[kRight];
+        }
+        else
+        {
+          // Rotate right.
+          Node* p_left = p_rest->children[kLeft];
+          p_rest->children[kLeft] = p_left->children[kRight];
+          p_left->children[kRight] = p_rest;
+          p_rest = p_left;
+          p_tail->children[kRight] = p_left;
+        }
+      }
+
+      return head.children[kRight];
+    }
+
+    //*************************************************************************
+    /// Builds a balanced tree from the 'count' pool items starting at 'first'.
+    ///\return The root of the tree.
+    //*************************************************************************
+    Node* build_balanced_tree(size_t first, size_t count)
+    {
+      if (count == 0U)
+      {
+        return nullptr;
+      }
+
+      // The left subtree is never smaller than the right one.
+      const size_t left_count  = count / 2U;
+      const size_t right_count = count - left_count - 1U;
+
+      Node* p_node = static_cast<Data_Node*>(p_node_pool->item_address(first + left_count));
+
+      p_node->mark_as_leaf();
+      p_node->children[kLeft]  = build_balanced_tree(first, left_count);
+      p_node->children[kRight] = build_balanced_tree(first + left_count + 1U, right_count);
+
+      if (tree_height(left_count) != tree_height(right_count))
+      {
+        p_node->weight = uint_least8_t(kLeft);
+      }
+
+      return p_node;
+    }
+
+    //*************************************************************************
+    /// The height of a tree made by build_balanced_tree().
+    //*************************************************************************
+    static size_t tree_height(size_t count)
+    {
+      size_t height = 0U;
+
+      while (count != 0U)
+      {
+        ++height;
+        count >>= 1U;
+      }
+
+      return height;
+    }
+
     //*************************************************************************
     /// Find the value matching the node provided
     //*************************************************************************
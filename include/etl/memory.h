@@ -388,6 +388,28 @@ namespace etl
     return o_end;
   }
 
+  //*****************************************************************************
+  /// Relocates the objects in [first, last) to the storage starting at d_first,
+  /// by copying their bytes. The ranges may overlap.
+  /// Afterwards the objects live at the destination and the parts of the source
+  /// not overlapped by it are uninitialised. No constructors or destructors are
+  /// called, so T must be trivially relocatable.
+  /// Returns an iterator to the end of the destination range.
+  ///\ingroup memory
+  //*****************************************************************************
+  template <typename T>
+  T* relocate(T* first, T* last, T* d_first)
+  {
+    const size_t n = static_cast<size_t>(last - first);
+
+    if (n != 0U)
+    {
+      ::memmove(static_cast<void*>(d_first), static_cast<const void*>(first), n * sizeof(T));
+    }
+
+    return d_first + n;
+  }
+
   //*****************************************************************************
   /// Value construct an item at address p.
   ///\ingroup memory
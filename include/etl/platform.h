@@ -94,6 +94,30 @@ SOFTWARE.
   #define ETL_DELETE
 #endif
 
+// SIMD instruction sets.
+// By default, string searches and comparisons use the SIMD instructions that
+// the compiler targets, or a machine word at a time if there are none. No
+// profile changes this.
+// Define ETL_NO_SIMD in the profile to not use SIMD instructions.
+// Define ETL_NO_SWAR as well to process strings one character at a time.
+// Define ETL_STRLEN_OVER_READ to find string lengths in the same way. This
+// reads past the terminator, within the aligned block or word that holds it.
+// AddressSanitizer is turned off for those reads, and MemorySanitizer or
+// valgrind may report them.
+#if !defined(ETL_NO_SIMD)
+  #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define ETL_SIMD_SSE2
+  #endif
+
+  #if defined(__AVX2__)
+    #define ETL_SIMD_AVX2
+  #endif
+
+  #if defined(__ARM_NEON) || defined(__ARM_NEON__)
+    #define ETL_SIMD_NEON
+  #endif
+#endif
+
 #if ETL_CPP11_SUPPORTED
   #define ETL_NOEXCEPT noexcept
   #define ETL_NOEXCEPT_EXPR(expression) noexcept(expression)
@@ -47,6 +47,7 @@ SOFTWARE.
 #include "alignment.h"
 #include "static_assert.h"
 #include "algorithm.h"
+#include "binary.h"
 
 #undef ETL_FILE
 #define ETL_FILE "11"
@@ -267,6 +268,11 @@ namespace etl
       items_allocated = 0;
       items_initialised = 0;
       p_next = p_buffer;
+
+      if (p_allocation_map != nullptr)
+      {
+        reset_allocation_map(0);
+      }
     }
 
     //*************************************************************************
@@ -330,6 +336,113 @@ namespace etl
       return items_allocated == MAX_SIZE;
     }
 
+    //*************************************************************************
+    /// <b>true</b> if the pool always allocates the free item with the
+    /// lowest address.
+    //*************************************************************************
+    bool is_lowest_address_first() const
+    {
+      return p_allocation_map != nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns the address of the item at the index.
+    //*************************************************************************
+    void* item_address(size_t index) const
+    {
+      return p_buffer + (index * ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Starts moving the allocated items to the lowest addresses.
+    /// Used by containers to compact their nodes. All of the allocated items
+    /// must belong to the caller.
+    /// The caller then gives every allocated item its new position with
+    /// set_relayout_position() and calls end_relayout().
+    //*************************************************************************
+    void begin_relayout()
+    {
+      if (p_allocation_map == nullptr)
+      {
+        // Mark the free items so that they can be told apart from the allocated ones.
+        char* p_free = p_next;
+        uint32_t free_items = items_initialised - items_allocated;
+
+        while (free_items-- != 0U)
+        {
+          char* p_next_free = *reinterpret_cast<char**>(p_free);
+          *reinterpret_cast<uintptr_t*>(p_free) = free_marker();
+          p_free = p_next_free;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Sets the position that an allocated item will be moved to.
+    /// Overwrites the first pointer sized field of the item.
+    //*************************************************************************
+    void set_relayout_position(void* p_item, size_t position)
+    {
+      // Odd, so never the same as the free marker.
+      *reinterpret_cast<uintptr_t*>(p_item) = (uintptr_t(position) << 1U) | 1U;
+    }
+
+    //*************************************************************************
+    /// Moves every allocated item to the position set by set_relayout_position().
+    /// The positions must be 0 to size() - 1. 'mover' must provide
+    /// move(p_from, p_to), which moves an item's contents to a free item,
+    /// and swap(p_item1, p_item2), which exchanges the contents of two items.
+    /// Item 'n' is then at item_address(n) and the free items follow the
+    /// allocated ones.
+    //*************************************************************************
+    template <typename TMover>
+    void end_relayout(TMover& mover)
+    {
+      const size_t limit = (p_allocation_map != nullptr) ? size_t(MAX_SIZE) : size_t(items_initialised);
+
+      for (size_t index = 0U; index < limit; ++index)
+      {
+        if (is_free_for_relayout(index))
+        {
+          continue;
+        }
+
+        size_t position = relayout_position(index);
+
+        // Follow the cycle of positions until this index holds its own item.
+        while (position != index)
+        {
+          void* p_item   = item_address(index);
+          void* p_target = item_address(position);
+
+          if (is_free_for_relayout(position))
+          {
+            mover.move(p_item, p_target);
+            set_relayout_position(p_target, position);
+            mark_free_for_relayout(index, position);
+            break;
+          }
+          else
+          {
+            size_t next_position = relayout_position(position);
+            mover.swap(p_item, p_target);
+            set_relayout_position(p_target, position);
+            set_relayout_position(p_item, next_position);
+            position = next_position;
+          }
+        }
+      }
+
+      // The allocated items are now the lowest ones.
+      items_initialised = items_allocated;
+      p_next = (items_allocated < MAX_SIZE) ? p_buffer + (items_allocated * ITEM_SIZE) : nullptr;
+
+      if (p_allocation_map != nullptr)
+      {
+        reset_allocation_map(items_allocated);
+      }
+    }
+
   protected:
 
     //*************************************************************************
@@ -340,11 +453,125 @@ namespace etl
         p_next(p_buffer_),
         items_allocated(0),
         items_initialised(0),
+        p_allocation_map(nullptr),
+        lowest_free_word(0),
+        item_size_shift(NO_SHIFT),
         ITEM_SIZE(item_size_),
         MAX_SIZE(max_size_)
     {
     }
 
+    //*************************************************************************
+    /// Makes the pool always allocate the free item with the lowest address.
+    /// 'p_allocation_map_' must have a bit for every item.
+    /// Must be called before any items are allocated.
+    //*************************************************************************
+    void set_allocation_map(uint32_t* p_allocation_map_)
+    {
+      p_allocation_map = p_allocation_map_;
+      reset_allocation_map(0);
+
+      // Items are usually a power of two in size, so a shift can replace the division.
+      item_size_shift = NO_SHIFT;
+
+      if ((ITEM_SIZE & (ITEM_SIZE - 1U)) == 0U)
+      {
+        item_size_shift = etl::count_trailing_zeros(ITEM_SIZE);
+      }
+    }
+
+    //*************************************************************************
+    /// Allocates 'n' items, lowest address first, and writes their addresses
+    /// to 'out'. Allocates nothing if there are fewer than 'n' free items.
+    /// Requires the allocation map.
+    //*************************************************************************
+    template <typename T, typename TOutputIterator>
+    bool allocate_items(TOutputIterator out, size_t n)
+    {
+      if (n > available())
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        return false;
+      }
+
+      items_allocated += uint32_t(n);
+
+      while (n != 0U)
+      {
+        uint32_t& word = p_allocation_map[lowest_free_word];
+        uint32_t free_bits = ~word;
+
+        // Take as many as are needed from this word.
+        while ((free_bits != 0U) && (n != 0U))
+        {
+          const uint32_t bit = etl::count_trailing_zeros(free_bits);
+          free_bits &= (free_bits - 1U);
+          word |= (uint32_t(1U) << bit);
+
+          *out++ = reinterpret_cast<T*>(p_buffer + ((((lowest_free_word * 32U) + bit)) * ITEM_SIZE));
+          --n;
+        }
+
+        if (free_bits == 0U)
+        {
+          ++lowest_free_word;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Releases 'n' items.
+    /// Requires the allocation map.
+    //*************************************************************************
+    template <typename TIterator>
+    void release_items(TIterator first, size_t n)
+    {
+      while (n-- != 0U)
+      {
+        release_item((char*)(*first++));
+      }
+    }
+
+    //*************************************************************************
+    /// Checks that the item belongs to the pool and is allocated.
+    /// Requires the allocation map.
+    //*************************************************************************
+    bool is_item_allocated(const void* p_object) const
+    {
+      uint32_t index;
+
+      return item_index(static_cast<const char*>(p_object), index) &&
+             ((p_allocation_map[index / 32U] & (uint32_t(1U) << (index % 32U))) != 0U);
+    }
+
+    //*************************************************************************
+    /// Calls 'function' with the address of every allocated item, in address order.
+    /// Requires the allocation map.
+    //*************************************************************************
+    template <typename T, typename TFunction>
+    TFunction for_each_allocated_item(TFunction function) const
+    {
+      const uint32_t words = (MAX_SIZE + 31U) / 32U;
+
+      for (uint32_t i = 0U; i < words; ++i)
+      {
+        // The items past the end are marked as allocated, so leave them out.
+        uint32_t allocated = p_allocation_map[i] & low_bits(MAX_SIZE, i * 32U);
+
+        while (allocated != 0U)
+        {
+          const uint32_t bit = etl::count_trailing_zeros(allocated);
+          allocated &= (allocated - 1U);
+
+          function(reinterpret_cast<T*>(p_buffer + (((i * 32U) + bit) * ITEM_SIZE)));
+        }
+      }
+
+      return function;
+    }
+
   private:
 
     //*************************************************************************
@@ -355,7 +582,11 @@ namespace etl
       char* p_value = nullptr;
 
       // Any free space left?
-      if (items_allocated < MAX_SIZE)
+      if ((items_allocated < MAX_SIZE) && (p_allocation_map != nullptr))
+      {
+        p_value = allocate_lowest_item();
+      }
+      else if (items_allocated < MAX_SIZE)
       {
         // Initialise another one if necessary.
         if (items_initialised < MAX_SIZE)
@@ -394,6 +625,12 @@ namespace etl
     //*************************************************************************
     void release_item(char* p_value)
     {
+      if (p_allocation_map != nullptr)
+      {
+        release_lowest_item(p_value);
+        return;
+      }
+
       // Does it belong to us?
       ETL_ASSERT(is_item_in_pool(p_value), ETL_ERROR(pool_object_not_in_pool));
 
@@ -433,6 +670,173 @@ namespace etl
       return is_within_range && is_valid_address;
     }
 
+    //*************************************************************************
+    /// Allocate the free item with the lowest address.
+    /// There must be a free item.
+    //*************************************************************************
+    char* allocate_lowest_item()
+    {
+      // Skip the full words. The unused bits of the last word are always set.
+      while (p_allocation_map[lowest_free_word] == 0xFFFFFFFFUL)
+      {
+        ++lowest_free_word;
+      }
+
+      uint32_t& word = p_allocation_map[lowest_free_word];
+      const uint32_t bit = etl::count_trailing_zeros(uint32_t(~word));
+
+      word |= (uint32_t(1U) << bit);
+      ++items_allocated;
+
+      return p_buffer + ((((lowest_free_word * 32U) + bit)) * ITEM_SIZE);
+    }
+
+    //*************************************************************************
+    /// Release an item allocated by allocate_lowest_item().
+    //*************************************************************************
+    void release_lowest_item(const char* p_value)
+    {
+      uint32_t index;
+
+      // Does it belong to us, and is it allocated?
+      if (!item_index(p_value, index))
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+        return;
+      }
+
+      const uint32_t word = index / 32U;
+      const uint32_t bit  = uint32_t(1U) << (index % 32U);
+
+      if ((p_allocation_map[word] & bit) == 0U)
+      {
+        ETL_ASSERT(false, ETL_ERROR(pool_object_not_in_pool));
+        return;
+      }
+
+      p_allocation_map[word] &= ~bit;
+      --items_allocated;
+
+      if (word < lowest_free_word)
+      {
+        lowest_free_word = word;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the index of an item.
+    ///\return <b>false</b> if the address is not an item in the pool.
+    //*************************************************************************
+    bool item_index(const char* p, uint32_t& index) const
+    {
+      const intptr_t distance = p - p_buffer;
+
+      if ((distance < 0) || (distance >= intptr_t(ITEM_SIZE * MAX_SIZE)))
+      {
+        return false;
+      }
+
+      if (item_size_shift != NO_SHIFT)
+      {
+        index = uint32_t(distance) >> item_size_shift;
+        return (uint32_t(distance) & (ITEM_SIZE - 1U)) == 0U;
+      }
+      else
+      {
+        index = uint32_t(distance / ITEM_SIZE);
+        return (distance % ITEM_SIZE) == 0;
+      }
+    }
+
+    //*************************************************************************
+    /// Marks the first 'n' items as allocated and the rest as free.
+    //*************************************************************************
+    void reset_allocation_map(uint32_t n)
+    {
+      const uint32_t words = (MAX_SIZE + 31U) / 32U;
+
+      for (uint32_t i = 0U; i < words; ++i)
+      {
+        p_allocation_map[i] = low_bits(n, i * 32U);
+      }
+
+      // Items past the end are never free.
+      if ((MAX_SIZE % 32U) != 0U)
+      {
+        p_allocation_map[words - 1U] |= ~low_bits(MAX_SIZE, (words - 1U) * 32U);
+      }
+
+      lowest_free_word = n / 32U;
+    }
+
+    //*************************************************************************
+    /// The bits of the word starting at item 'first' for the items below 'n'.
+    //*************************************************************************
+    static uint32_t low_bits(uint32_t n, uint32_t first)
+    {
+      if (n <= first)
+      {
+        return 0U;
+      }
+      else if ((n - first) >= 32U)
+      {
+        return 0xFFFFFFFFUL;
+      }
+      else
+      {
+        return (uint32_t(1U) << (n - first)) - 1U;
+      }
+    }
+
+    //*************************************************************************
+    /// The value written to free items by begin_relayout().
+    //*************************************************************************
+    uintptr_t free_marker() const
+    {
+      // Never the address of an item, and even.
+      return reinterpret_cast<uintptr_t>(this);
+    }
+
+    //*************************************************************************
+    /// Is the item free, between begin_relayout() and the end of end_relayout().
+    //*************************************************************************
+    bool is_free_for_relayout(size_t index) const
+    {
+      if (p_allocation_map != nullptr)
+      {
+        return (p_allocation_map[index / 32U] & (uint32_t(1U) << (index % 32U))) == 0U;
+      }
+      else
+      {
+        return (index >= items_initialised) ||
+               (*reinterpret_cast<const uintptr_t*>(item_address(index)) == free_marker());
+      }
+    }
+
+    //*************************************************************************
+    /// Records that an item has moved from 'from' to the free 'to'.
+    //*************************************************************************
+    void mark_free_for_relayout(size_t from, size_t to)
+    {
+      if (p_allocation_map != nullptr)
+      {
+        p_allocation_map[from / 32U] &= ~(uint32_t(1U) << (from % 32U));
+        p_allocation_map[to / 32U]   |= (uint32_t(1U) << (to % 32U));
+      }
+      else
+      {
+        *reinterpret_cast<uintptr_t*>(item_address(from)) = free_marker();
+      }
+    }
+
+    //*************************************************************************
+    /// The position set by set_relayout_position().
+    //*************************************************************************
+    size_t relayout_position(size_t index) const
+    {
+      return size_t(*reinterpret_cast<const uintptr_t*>(item_address(index)) >> 1U);
+    }
+
     // Disable copy construction and assignment.
     ipool(const ipool&);
     ipool& operator =(const ipool&);
@@ -443,6 +847,12 @@ namespace etl
     uint32_t  items_allocated;   ///< The number of items allocated.
     uint32_t  items_initialised; ///< The number of items initialised.
 
+    uint32_t* p_allocation_map;  ///< One bit per item, set if allocated, or nullptr if the free list is used.
+    uint32_t  lowest_free_word;  ///< No free items are in the allocation map words below this one.
+    uint32_t  item_size_shift;   ///< log2(ITEM_SIZE) if it is a power of two, otherwise NO_SHIFT.
+
+    static const uint32_t NO_SHIFT = 0xFFFFFFFFUL;
+
     const uint32_t ITEM_SIZE;    ///< The size of allocated items.
     const uint32_t MAX_SIZE;    ///< The maximum number of objects that can be allocated.
 
@@ -748,6 +1158,144 @@ namespace etl
     pool(const pool&);
     pool& operator =(const pool&);
   };
+
+  //*************************************************************************
+  /// A generic pool that always allocates the free item with the lowest
+  /// address, so that the allocated items stay packed together.
+  /// Free items are tracked with one bit per item, which also allows bulk
+  /// allocation and release, and iteration over the allocated objects.
+  ///\ingroup pool
+  //*************************************************************************
+  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_>
+  class generic_ordered_pool : public etl::generic_pool<TYPE_SIZE_, ALIGNMENT_, SIZE_>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_ordered_pool()
+    {
+      this->set_allocation_map(allocation_map);
+    }
+
+    //*************************************************************************
+    /// Allocates storage for 'n' objects, lowest address first, and writes
+    /// their addresses to 'out'.
+    /// If there are fewer than 'n' free items then none are allocated. If
+    /// asserts or exceptions are enabled an etl::pool_no_allocation is thrown,
+    /// otherwise <b>false</b> is returned.
+    //*************************************************************************
+    template <typename U, typename TOutputIterator>
+    bool allocate_n(TOutputIterator out, size_t n)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE_, "Type too large for pool");
+      return this->template allocate_items<U>(out, n);
+    }
+
+    //*************************************************************************
+    /// Releases 'n' objects, whose addresses start at 'first'.
+    //*************************************************************************
+    template <typename TIterator>
+    void release_n(TIterator first, size_t n)
+    {
+      this->release_items(first, n);
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if the object belongs to the pool and is allocated.
+    //*************************************************************************
+    bool is_allocated(const void* p_object) const
+    {
+      return this->is_item_allocated(p_object);
+    }
+
+    //*************************************************************************
+    /// Calls function(U*) for every allocated object, in address order.
+    //*************************************************************************
+    template <typename U, typename TFunction>
+    TFunction for_each_allocated(TFunction function) const
+    {
+      return this->template for_each_allocated_item<U>(function);
+    }
+
+  private:
+
+    uint32_t allocation_map[(SIZE_ + 31U) / 32U];
+
+    // Should not be copied.
+    generic_ordered_pool(const generic_ordered_pool&);
+    generic_ordered_pool& operator =(const generic_ordered_pool&);
+  };
+
+  //*************************************************************************
+  /// A pool that always allocates the free item with the lowest address, so
+  /// that the allocated items stay packed together.
+  /// Free items are tracked with one bit per item, which also allows bulk
+  /// allocation and release, and iteration over the allocated objects.
+  ///\ingroup pool
+  //*************************************************************************
+  template <typename T, const size_t SIZE_>
+  class ordered_pool : public etl::pool<T, SIZE_>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    ordered_pool()
+    {
+      this->set_allocation_map(allocation_map);
+    }
+
+    //*************************************************************************
+    /// Allocates storage for 'n' objects, lowest address first, and writes
+    /// their addresses to 'out'.
+    /// If there are fewer than 'n' free items then none are allocated. If
+    /// asserts or exceptions are enabled an etl::pool_no_allocation is thrown,
+    /// otherwise <b>false</b> is returned.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    bool allocate_n(TOutputIterator out, size_t n)
+    {
+      return this->template allocate_items<T>(out, n);
+    }
+
+    //*************************************************************************
+    /// Releases 'n' objects, whose addresses start at 'first'.
+    //*************************************************************************
+    template <typename TIterator>
+    void release_n(TIterator first, size_t n)
+    {
+      this->release_items(first, n);
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if the object belongs to the pool and is allocated.
+    //*************************************************************************
+    bool is_allocated(const void* p_object) const
+    {
+      return this->is_item_allocated(p_object);
+    }
+
+    //*************************************************************************
+    /// Calls function(T*) for every allocated object, in address order.
+    //*************************************************************************
+    template <typename TFunction>
+    TFunction for_each_allocated(TFunction function) const
+    {
+      return this->template for_each_allocated_item<T>(function);
+    }
+
+  private:
+
+    uint32_t allocation_map[(SIZE_ + 31U) / 32U];
+
+    // Should not be copied.
+    ordered_pool(const ordered_pool&);
+    ordered_pool& operator =(const ordered_pool&);
+  };
 }
 
 #undef ETL_FILE
@@ -0,0 +1,560 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_GRISU_INCLUDED
+#define ETL_GRISU_INCLUDED
+
+///\ingroup private
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../stl/limits.h"
+
+//*****************************************************************************
+/// Shortest round trip formatting of floating point values.
+/// An implementation of Florian Loitsch's Grisu2 algorithm, from
+/// "Printing Floating-Point Numbers Quickly and Accurately with Integers".
+/// The digits always convert back to the original value and are the
+/// shortest that do so for almost all values.
+/// Uses a fixed table of cached powers of ten and no floating point arithmetic.
+//*****************************************************************************
+namespace etl
+{
+  namespace private_grisu
+  {
+    //*************************************************************************
+    /// The maximum number of characters written by to_chars.
+    /// Sign, 17 digits, decimal point, 'e', exponent sign and 3 exponent
+    /// digits, or a leading "0." and 4 zeros.
+    //*************************************************************************
+    static const int MAX_CHARS = 32;
+
+    //*************************************************************************
+    /// A 'do it yourself' floating point value, f * 2^e.
+    //*************************************************************************
+    struct diy_fp
+    {
+      diy_fp(uint64_t f_, int e_)
+        : f(f_),
+          e(e_)
+      {
+      }
+
+      //***********************************
+      /// x - y. The exponents must be the same and x >= y.
+      //***********************************
+      static diy_fp sub(const diy_fp& x, const diy_fp& y)
+      {
+        return diy_fp(x.f - y.f, x.e);
+      }
+
+      //***********************************
+      /// The upper 64 bits of x * y, rounded.
+      //***********************************
+      static diy_fp mul(const diy_fp& x, const diy_fp& y)
+      {
+        const uint64_t mask = 0xFFFFFFFFULL;
+
+        const uint64_t x_lo = x.f & mask;
+        const uint64_t x_hi = x.f >> 32U;
+        const uint64_t y_lo = y.f & mask;
+        const uint64_t y_hi = y.f >> 32U;
+
+        const uint64_t p0 = x_lo * y_lo;
+        const uint64_t p1 = x_lo * y_hi;
+        const uint64_t p2 = x_hi * y_lo;
+        const uint64_t p3 = x_hi * y_hi;
+
+        uint64_t middle = (p0 >> 32U) + (p1 & mask) + (p2 & mask);
+        middle += 1ULL << 31U; // Round.
+
+        const uint64_t h = p3 + (p1 >> 32U) + (p2 >> 32U) + (middle >> 32U);
+
+        return diy_fp(h, x.e + y.e + 64);
+      }
+
+      //***********************************
+      /// Shifts until the top bit is set.
+      //***********************************
+      static diy_fp normalize(diy_fp x)
+      {
+        while ((x.f >> 63U) == 0U)
+        {
+          x.f <<= 1U;
+          --x.e;
+        }
+
+        return x;
+      }
+
+      //***********************************
+      /// Shifts to the target exponent, which must be less than x.e.
+      //***********************************
+      static diy_fp normalize_to(const diy_fp& x, int target_exponent)
+      {
+        return diy_fp(x.f << (x.e - target_exponent), target_exponent);
+      }
+
+      uint64_t f;
+      int      e;
+    };
+
+    //*************************************************************************
+    /// The value and the boundaries of the values that round to it.
+    //*************************************************************************
+    struct boundaries
+    {
+      boundaries(const diy_fp& w_, const diy_fp& minus_, const diy_fp& plus_)
+        : w(w_),
+          minus(minus_),
+          plus(plus_)
+      {
+      }
+
+      diy_fp w;
+      diy_fp minus;
+      diy_fp plus;
+    };
+
+    //*************************************************************************
+    /// The bit layout of float and double.
+    //*************************************************************************
+    template <typename T>
+    struct float_traits;
+
+    template <>
+    struct float_traits<float>
+    {
+      typedef uint32_t bits_type;
+      static const int MAX_FIXED_EXPONENT = 9;
+    };
+
+    template <>
+    struct float_traits<double>
+    {
+      typedef uint64_t bits_type;
+      static const int MAX_FIXED_EXPONENT = 17;
+    };
+
+    //*************************************************************************
+    /// Computes the boundaries of a finite, positive value.
+    //*************************************************************************
+    template <typename T>
+    boundaries compute_boundaries(const T value)
+    {
+      typedef typename float_traits<T>::bits_type bits_type;
+
+      const int      precision  = std::numeric_limits<T>::digits; // Including the hidden bit.
+      const int      bias       = std::numeric_limits<T>::max_exponent - 1 + (precision - 1);
+      const int      min_exp    = 1 - bias;
+      const uint64_t hidden_bit = 1ULL << (precision - 1);
+
+      bits_type bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      const uint64_t biased_exponent = uint64_t(bits) >> (precision - 1);
+      const uint64_t fraction        = uint64_t(bits) & (hidden_bit - 1U);
+
+      const bool   is_denormal = (biased_exponent == 0U);
+      const diy_fp v = is_denormal ? diy_fp(fraction, min_exp)
+                                   : diy_fp(fraction + hidden_bit, int(biased_exponent) - bias);
+
+      // The gap to the next lower value is half the size when the fraction is zero.
+      const bool lower_boundary_is_closer = (fraction == 0U) && (biased_exponent > 1U);
+
+      const diy_fp m_plus  = diy_fp((2U * v.f) + 1U, v.e - 1);
+      const diy_fp m_minus = lower_boundary_is_closer ? diy_fp((4U * v.f) - 1U, v.e - 2)
+                                                      : diy_fp((2U * v.f) - 1U, v.e - 1);
+
+      const diy_fp w_plus  = diy_fp::normalize(m_plus);
+      const diy_fp w_minus = diy_fp::normalize_to(m_minus, w_plus.e);
+
+      return boundaries(diy_fp::normalize(v), w_minus, w_plus);
+    }
+
+    //*************************************************************************
+    /// A normalized power of ten, f * 2^e ~= 10^k.
+    //*************************************************************************
+    struct cached_power
+    {
+      uint64_t f;
+      int      e;
+      int      k;
+    };
+
+    //*************************************************************************
+    /// The target range of the scaled binary exponent.
+    //*************************************************************************
+    static const int ALPHA = -60;
+    static const int GAMMA = -32;
+
+    //*************************************************************************
+    /// Gets the cached power of ten c = 10^-k such that the exponent of
+    /// w * c is in the range [ALPHA, GAMMA].
+    //*************************************************************************
+    inline cached_power get_cached_power(const int e)
+    {
+      static const int MIN_DECIMAL_EXPONENT = -300;
+      static const int DECIMAL_STEP         = 8;
+
+      static const cached_power cached_powers[] =
+      {
+        { 0xAB70FE17C79AC6CAULL, -1060, -300 },
+        { 0xFF77B1FCBEBCDC4FULL, -1034, -292 },
+        { 0xBE5691EF416BD60CULL, -1007, -284 },
+        { 0x8DD01FAD907FFC3CULL,  -980, -276 },
+        { 0xD3515C2831559A83ULL,  -954, -268 },
+        { 0x9D71AC8FADA6C9B5ULL,  -927, -260 },
+        { 0xEA9C227723EE8BCBULL,  -901, -252 },
+        { 0xAECC49914078536DULL,  -874, -244 },
+        { 0x823C12795DB6CE57ULL,  -847, -236 },
+        { 0xC21094364DFB5637ULL,  -821, -228 },
+        { 0x9096EA6F3848984FULL,  -794, -220 },
+        { 0xD77485CB25823AC7ULL,  -768, -212 },
+        { 0xA086CFCD97BF97F4ULL,  -741, -204 },
+        { 0xEF340A98172AACE5ULL,  -715, -196 },
+        { 0xB23867FB2A35B28EULL,  -688, -188 },
+        { 0x84C8D4DFD2C63F3BULL,  -661, -180 },
+        { 0xC5DD44271AD3CDBAULL,  -635, -172 },
+        { 0x936B9FCEBB25C996ULL,  -608, -164 },
+        { 0xDBAC6C247D62A584ULL,  -582, -156 },
+        { 0xA3AB66580D5FDAF6ULL,  -555, -148 },
+        { 0xF3E2F893DEC3F126ULL,  -529, -140 },
+        { 0xB5B5ADA8AAFF80B8ULL,  -502, -132 },
+        { 0x87625F056C7C4A8BULL,  -475, -124 },
+        { 0xC9BCFF6034C13053ULL,  -449, -116 },
+        { 0x964E858C91BA2655ULL,  -422, -108 },
+        { 0xDFF9772470297EBDULL,  -396, -100 },
+        { 0xA6DFBD9FB8E5B88FULL,  -369,  -92 },
+        { 0xF8A95FCF88747D94ULL,  -343,  -84 },
+        { 0xB94470938FA89BCFULL,  -316,  -76 },
+        { 0x8A08F0F8BF0F156BULL,  -289,  -68 },
+        { 0xCDB02555653131B6ULL,  -263,  -60 },
+        { 0x993FE2C6D07B7FACULL,  -236,  -52 },
+        { 0xE45C10C42A2B3B06ULL,  -210,  -44 },
+        { 0xAA242499697392D3ULL,  -183,  -36 },
+        { 0xFD87B5F28300CA0EULL,  -157,  -28 },
+        { 0xBCE5086492111AEBULL,  -130,  -20 },
+        { 0x8CBCCC096F5088CCULL,  -103,  -12 },
+        { 0xD1B71758E219652CULL,   -77,   -4 },
+        { 0x9C40000000000000ULL,   -50,    4 },
+        { 0xE8D4A51000000000ULL,   -24,   12 },
+        { 0xAD78EBC5AC620000ULL,     3,   20 },
+        { 0x813F3978F8940984ULL,    30,   28 },
+        { 0xC097CE7BC90715B3ULL,    56,   36 },
+        { 0x8F7E32CE7BEA5C70ULL,    83,   44 },
+        { 0xD5D238A4ABE98068ULL,   109,   52 },
+        { 0x9F4F2726179A2245ULL,   136,   60 },
+        { 0xED63A231D4C4FB27ULL,   162,   68 },
+        { 0xB0DE65388CC8ADA8ULL,   189,   76 },
+        { 0x83C7088E1AAB65DBULL,   216,   84 },
+        { 0xC45D1DF942711D9AULL,   242,   92 },
+        { 0x924D692CA61BE758ULL,   269,  100 },
+        { 0xDA01EE641A708DEAULL,   295,  108 },
+        { 0xA26DA3999AEF774AULL,   322,  116 },
+        { 0xF209787BB47D6B85ULL,   348,  124 },
+        { 0xB454E4A179DD1877ULL,   375,  132 },
+        { 0x865B86925B9BC5C2ULL,   402,  140 },
+        { 0xC83553C5C8965D3DULL,   428,  148 },
+        { 0x952AB45CFA97A0B3ULL,   455,  156 },
+        { 0xDE469FBD99A05FE3ULL,   481,  164 },
+        { 0xA59BC234DB398C25ULL,   508,  172 },
+        { 0xF6C69A72A3989F5CULL,   534,  180 },
+        { 0xB7DCBF5354E9BECEULL,   561,  188 },
+        { 0x88FCF317F22241E2ULL,   588,  196 },
+        { 0xCC20CE9BD35C78A5ULL,   614,  204 },
+        { 0x98165AF37B2153DFULL,   641,  212 },
+        { 0xE2A0B5DC971F303AULL,   667,  220 },
+        { 0xA8D9D1535CE3B396ULL,   694,  228 },
+        { 0xFB9B7CD9A4A7443CULL,   720,  236 },
+        { 0xBB764C4CA7A44410ULL,   747,  244 },
+        { 0x8BAB8EEFB6409C1AULL,   774,  252 },
+        { 0xD01FEF10A657842CULL,   800,  260 },
+        { 0x9B10A4E5E9913129ULL,   827,  268 },
+        { 0xE7109BFBA19C0C9DULL,   853,  276 },
+        { 0xAC2820D9623BF429ULL,   880,  284 },
+        { 0x80444B5E7AA7CF85ULL,   907,  292 },
+        { 0xBF21E44003ACDD2DULL,   933,  300 },
+        { 0x8E679C2F5E44FF8FULL,   960,  308 },
+        { 0xD433179D9C8CB841ULL,   986,  316 },
+        { 0x9E19DB92B4E31BA9ULL,  1013,  324 },
+        { 0xEB96BF6EBADF77D9ULL,  1039,  332 },
+        { 0xAF87023B9BF0EE6BULL,  1066,  340 },
+      };
+
+      // k = ceil((ALPHA - e - 1) * log10(2)), using 78913 / 2^18 ~= log10(2).
+      const int f = ALPHA - e - 1;
+      const int k = ((f * 78913) / (1 << 18)) + (f > 0 ? 1 : 0);
+
+      const int index = (-MIN_DECIMAL_EXPONENT + k + (DECIMAL_STEP - 1)) / DECIMAL_STEP;
+
+      return cached_powers[index];
+    }
+
+    //*************************************************************************
+    /// Finds the number of decimal digits in n and the largest power of ten <= n.
+    //*************************************************************************
+    inline int find_largest_pow10(const uint32_t n, uint32_t& pow10)
+    {
+      static const uint32_t powers[] =
+      {
+        1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL
+      };
+
+      int digits = 10;
+
+      while ((digits > 1) && (n < powers[digits - 1]))
+      {
+        --digits;
+      }
+
+      pow10 = powers[digits - 1];
+
+      return digits;
+    }
+
+    //*************************************************************************
+    /// Moves the last digit towards w while it stays within the boundaries.
+    //*************************************************************************
+    inline void round_weed(char* buffer, const int length, const uint64_t dist, const uint64_t delta, uint64_t rest, const uint64_t ten_k)
+    {
+      while ((rest < dist) &&
+             ((delta - rest) >= ten_k) &&
+             (((rest + ten_k) < dist) || ((dist - rest) > (rest + ten_k - dist))))
+      {
+        --buffer[length - 1];
+        rest += ten_k;
+      }
+    }
+
+    //*************************************************************************
+    /// Generates the shortest digits in the range (m_minus, m_plus), closest to w.
+    //*************************************************************************
+    inline void generate_digits(char* buffer, int& length, int& decimal_exponent, const diy_fp& m_minus, const diy_fp& w, const diy_fp& m_plus)
+    {
+      uint64_t delta = diy_fp::sub(m_plus, m_minus).f;
+      uint64_t dist  = diy_fp::sub(m_plus, w).f;
+
+      // one = 2^-e, splitting m_plus into an integral part p1 and a fractional part p2.
+      const int      shift = -m_plus.e;
+      const uint64_t one   = 1ULL << shift;
+
+      uint32_t p1 = uint32_t(m_plus.f >> shift);
+      uint64_t p2 = m_plus.f & (one - 1U);
+
+      // The integral digits.
+      uint32_t pow10;
+      int n = find_largest_pow10(p1, pow10);
+
+      while (n > 0)
+      {
+        const uint32_t d = p1 / pow10;
+        p1 %= pow10;
+
+        buffer[length++] = char('0' + d);
+        --n;
+
+        const uint64_t rest = (uint64_t(p1) << shift) + p2;
+
+        if (rest <= delta)
+        {
+          decimal_exponent += n;
+          round_weed(buffer, length, dist, delta, rest, uint64_t(pow10) << shift);
+          return;
+        }
+
+        pow10 /= 10U;
+      }
+
+      // The fractional digits.
+      int m = 0;
+
+      while (true)
+      {
+        p2 *= 10U;
+        const uint64_t d = p2 >> shift;
+        p2 &= (one - 1U);
+
+        buffer[length++] = char('0' + d);
+        ++m;
+
+        delta *= 10U;
+        dist  *= 10U;
+
+        if (p2 <= delta)
+        {
+          break;
+        }
+      }
+
+      decimal_exponent -= m;
+      round_weed(buffer, length, dist, delta, p2, one);
+    }
+
+    //*************************************************************************
+    /// Generates the shortest digits of a finite, positive value.
+    /// value = digits * 10^decimal_exponent.
+    //*************************************************************************
+    template <typename T>
+    void grisu2(char* buffer, int& length, int& decimal_exponent, const T value)
+    {
+      const boundaries b = compute_boundaries(value);
+
+      const cached_power cached = get_cached_power(b.plus.e);
+      const diy_fp       c(cached.f, cached.e);
+
+      const diy_fp w       = diy_fp::mul(b.w, c);
+      const diy_fp w_minus = diy_fp::mul(b.minus, c);
+      const diy_fp w_plus  = diy_fp::mul(b.plus, c);
+
+      // Allow for the rounding error of the multiplications.
+      const diy_fp m_minus(w_minus.f + 1U, w_minus.e);
+      const diy_fp m_plus(w_plus.f - 1U, w_plus.e);
+
+      length           = 0;
+      decimal_exponent = -cached.k;
+
+      generate_digits(buffer, length, decimal_exponent, m_minus, w, m_plus);
+    }
+
+    //*************************************************************************
+    /// Appends the exponent as e+dd or e-ddd.
+    //*************************************************************************
+    inline char* append_exponent(char* p, int e)
+    {
+      *p++ = 'e';
+
+      if (e < 0)
+      {
+        *p++ = '-';
+        e = -e;
+      }
+      else
+      {
+        *p++ = '+';
+      }
+
+      if (e >= 100)
+      {
+        *p++ = char('0' + (e / 100));
+        e %= 100;
+      }
+
+      *p++ = char('0' + (e / 10));
+      *p++ = char('0' + (e % 10));
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Formats the digits as fixed or scientific notation, in place.
+    /// value = buffer[0, length) * 10^decimal_exponent.
+    /// \return The end of the formatted characters.
+    //*************************************************************************
+    inline char* format_digits(char* buffer, const int length, const int decimal_exponent, const int max_fixed_exponent)
+    {
+      // The position of the decimal point relative to the first digit.
+      const int n = length + decimal_exponent;
+
+      if ((length <= n) && (n <= max_fixed_exponent))
+      {
+        // digits000
+        memset(buffer + length, '0', size_t(n - length));
+        return buffer + n;
+      }
+
+      if ((0 < n) && (n <= max_fixed_exponent))
+      {
+        // dig.its
+        memmove(buffer + n + 1, buffer + n, size_t(length - n));
+        buffer[n] = '.';
+        return buffer + length + 1;
+      }
+
+      if ((-4 < n) && (n <= 0))
+      {
+        // 0.000digits
+        memmove(buffer + 2 - n, buffer, size_t(length));
+        buffer[0] = '0';
+        buffer[1] = '.';
+        memset(buffer + 2, '0', size_t(-n));
+        return buffer + 2 - n + length;
+      }
+
+      if (length == 1)
+      {
+        // de+dd
+        return append_exponent(buffer + 1, n - 1);
+      }
+
+      // d.igitse+dd
+      memmove(buffer + 2, buffer + 1, size_t(length - 1));
+      buffer[1] = '.';
+      return append_exponent(buffer + length + 1, n - 1);
+    }
+
+    //*************************************************************************
+    /// Writes a short representation of a finite value that converts back to
+    /// the same value. It is the shortest for almost all values.
+    /// The buffer must have room for MAX_CHARS characters.
+    /// \return The end of the characters written.
+    //*************************************************************************
+    template <typename T>
+    char* to_chars(char* buffer, T value)
+    {
+      typename float_traits<T>::bits_type bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      // Sign bit set?
+      if ((bits >> ((sizeof(bits) * 8U) - 1U)) != 0U)
+      {
+        *buffer++ = '-';
+        value = -value;
+      }
+
+      if (value == T(0))
+      {
+        *buffer++ = '0';
+        return buffer;
+      }
+
+      int length;
+      int decimal_exponent;
+
+      grisu2(buffer, length, decimal_exponent, value);
+
+      return format_digits(buffer, length, decimal_exponent, float_traits<T>::MAX_FIXED_EXPONENT);
+    }
+  }
+}
+
+#endif
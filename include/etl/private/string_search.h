@@ -0,0 +1,920 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <limits.h>
+
+#include "../platform.h"
+#include "../type_traits.h"
+#include "../binary.h"
+#include "../smallest.h"
+#include "../nullptr.h"
+
+#if defined(ETL_SIMD_AVX2) || defined(ETL_SIMD_SSE2)
+  #include <immintrin.h>
+#elif defined(ETL_SIMD_NEON)
+  #include <arm_neon.h>
+#endif
+
+// With ETL_STRLEN_OVER_READ, reads that look for a terminator are aligned, so
+// never cross a page, but may read past the end of the string.
+#if defined(ETL_STRLEN_OVER_READ) && (defined(__GNUC__) || defined(__clang__))
+  #define ETL_STRING_SEARCH_NO_SANITIZE __attribute__((no_sanitize_address))
+#else
+  #define ETL_STRING_SEARCH_NO_SANITIZE
+#endif
+
+//*****************************************************************************
+/// Character search, length, comparison and substring search for strings,
+/// string views and char_traits.
+/// With SSE2, AVX2 or NEON, blocks of 16 or 32 bytes are compared at once for
+/// 8, 16 and 32 bit characters. Otherwise, or with ETL_NO_SIMD defined in the
+/// profile, a machine word of characters is tested at a time. With ETL_NO_SWAR
+/// also defined, scalar code is used.
+/// The length of a string is found one character at a time unless
+/// ETL_STRLEN_OVER_READ is defined, as the faster searches read past the
+/// terminator to the end of an aligned block or word.
+//*****************************************************************************
+namespace etl
+{
+  namespace private_string_search
+  {
+    //*************************************************************************
+    /// The character as an unsigned value.
+    //*************************************************************************
+    template <typename T>
+    uint32_t to_unsigned(const T c)
+    {
+      return uint32_t(typename etl::make_unsigned<T>::type(c));
+    }
+
+#if defined(ETL_SIMD_AVX2) || defined(ETL_SIMD_SSE2) || defined(ETL_SIMD_NEON)
+    #define ETL_STRING_SEARCH_SIMD
+
+    //*************************************************************************
+    /// The index of the lowest set bit. value must not be zero.
+    //*************************************************************************
+    inline uint32_t lowest_bit(const uint64_t value)
+    {
+#if defined(__GNUC__)
+      return uint32_t(__builtin_ctzll(value));
+#else
+      return uint32_t(etl::count_trailing_zeros(value));
+#endif
+    }
+
+    //*************************************************************************
+    /// The index of the highest set bit. value must not be zero.
+    //*************************************************************************
+    inline uint32_t highest_bit(uint64_t value)
+    {
+#if defined(__GNUC__)
+      return uint32_t(63 - __builtin_clzll(value));
+#else
+      uint32_t index = 0U;
+
+      if (value >> 32U) { value >>= 32U; index += 32U; }
+      if (value >> 16U) { value >>= 16U; index += 16U; }
+      if (value >> 8U)  { value >>= 8U;  index += 8U;  }
+      if (value >> 4U)  { value >>= 4U;  index += 4U;  }
+      if (value >> 2U)  { value >>= 2U;  index += 2U;  }
+      if (value >> 1U)  { index += 1U; }
+
+      return index;
+#endif
+    }
+
+    //*************************************************************************
+    /// Compares a block of characters with a character.
+    /// equal() returns a mask with MASK_BITS bits set for each byte of each
+    /// matching character.
+    //*************************************************************************
+    template <size_t Size>
+    struct simd
+    {
+      static const bool SUPPORTED = false;
+    };
+
+#if defined(ETL_SIMD_AVX2)
+    static const size_t   BLOCK_BYTES = 32U;
+    static const size_t   MASK_BITS   = 1U;
+    static const uint64_t ALL_MATCH   = 0xFFFFFFFFU;
+
+    template <>
+    struct simd<1U>
+    {
+      static const bool SUPPORTED = true;
+      typedef __m256i vector;
+      static vector   splat(uint32_t c)                   { return _mm256_set1_epi8(char(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi8(load(p), v))); }
+    };
+
+    template <>
+    struct simd<2U>
+    {
+      static const bool SUPPORTED = true;
+      typedef __m256i vector;
+      static vector   splat(uint32_t c)                   { return _mm256_set1_epi16(short(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi16(load(p), v))); }
+    };
+
+    template <>
+    struct simd<4U>
+    {
+      static const bool SUPPORTED = true;
+      typedef __m256i vector;
+      static vector   splat(uint32_t c)                   { return _mm256_set1_epi32(int(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return _mm256_loadu_si256(static_cast<const __m256i*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return uint32_t(_mm256_movemask_epi8(_mm256_cmpeq_epi32(load(p), v))); }
+    };
+#elif defined(ETL_SIMD_SSE2)
+    static const size_t   BLOCK_BYTES = 16U;
+    static const size_t   MASK_BITS   = 1U;
+    static const uint64_t ALL_MATCH   = 0xFFFFU;
+
+    template <>
+    struct simd<1U>
+    {
+      static const bool SUPPORTED = true;
+      typedef __m128i vector;
+      static vector   splat(uint32_t c)                   { return _mm_set1_epi8(char(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(load(p), v))); }
+    };
+
+    template <>
+    struct simd<2U>
+    {
+      static const bool SUPPORTED = true;
+      typedef __m128i vector;
+      static vector   splat(uint32_t c)                   { return _mm_set1_epi16(short(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi16(load(p), v))); }
+    };
+
+    template <>
+    struct simd<4U>
+    {
+      static const bool SUPPORTED = true;
+      typedef __m128i vector;
+      static vector   splat(uint32_t c)                   { return _mm_set1_epi32(int(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return _mm_loadu_si128(static_cast<const __m128i*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi32(load(p), v))); }
+    };
+#elif defined(ETL_SIMD_NEON)
+    static const size_t   BLOCK_BYTES = 16U;
+    static const size_t   MASK_BITS   = 4U;
+    static const uint64_t ALL_MATCH   = ~uint64_t(0U);
+
+    //*************************************************************************
+    /// Narrows a byte comparison result to a 64 bit mask, 4 bits per byte.
+    //*************************************************************************
+    inline uint64_t neon_mask(const uint8x16_t eq)
+    {
+      return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+    }
+
+    template <>
+    struct simd<1U>
+    {
+      static const bool SUPPORTED = true;
+      typedef uint8x16_t vector;
+      static vector   splat(uint32_t c)                   { return vdupq_n_u8(uint8_t(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return vld1q_u8(static_cast<const uint8_t*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return neon_mask(vceqq_u8(load(p), v)); }
+    };
+
+    template <>
+    struct simd<2U>
+    {
+      static const bool SUPPORTED = true;
+      typedef uint16x8_t vector;
+      static vector   splat(uint32_t c)                   { return vdupq_n_u16(uint16_t(c)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return vld1q_u16(static_cast<const uint16_t*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return neon_mask(vreinterpretq_u8_u16(vceqq_u16(load(p), v))); }
+    };
+
+    template <>
+    struct simd<4U>
+    {
+      static const bool SUPPORTED = true;
+      typedef uint32x4_t vector;
+      static vector   splat(uint32_t c)                   { return vdupq_n_u32(c); }
+      ETL_STRING_SEARCH_NO_SANITIZE static vector   load(const void* p)                  { return vld1q_u32(static_cast<const uint32_t*>(p)); }
+      ETL_STRING_SEARCH_NO_SANITIZE static uint64_t equal(const void* p, const vector& v) { return neon_mask(vreinterpretq_u8_u32(vceqq_u32(load(p), v))); }
+    };
+#endif
+
+    //*************************************************************************
+    /// SIMD first match of c in [first, last), or the first unsearched position.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char_blocks(const T* first, const T* last, const T c, const T*& found, etl::true_type)
+    {
+      typedef simd<sizeof(T)> ops;
+
+      const ptrdiff_t N        = ptrdiff_t(BLOCK_BYTES / sizeof(T));
+      const uint32_t  CHAR_BITS = uint32_t(MASK_BITS * sizeof(T));
+
+      const typename ops::vector needle = ops::splat(to_unsigned(c));
+
+      while ((last - first) >= N)
+      {
+        const uint64_t mask = ops::equal(first, needle);
+
+        if (mask != 0U)
+        {
+          found = first + (lowest_bit(mask) / CHAR_BITS);
+          return first;
+        }
+
+        first += N;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// SIMD last match of c in [first, last), or the last unsearched position.
+    //*************************************************************************
+    template <typename T>
+    const T* rfind_char_blocks(const T* first, const T* last, const T c, const T*& found, etl::true_type)
+    {
+      typedef simd<sizeof(T)> ops;
+
+      const ptrdiff_t N         = ptrdiff_t(BLOCK_BYTES / sizeof(T));
+      const uint32_t  CHAR_BITS = uint32_t(MASK_BITS * sizeof(T));
+
+      const typename ops::vector needle = ops::splat(to_unsigned(c));
+
+      while ((last - first) >= N)
+      {
+        const uint64_t mask = ops::equal(last - N, needle);
+
+        if (mask != 0U)
+        {
+          found = (last - N) + (highest_bit(mask) / CHAR_BITS);
+          return last;
+        }
+
+        last -= N;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// SIMD search for positions that match the first and last characters
+    /// of the substring. Only those are compared in full.
+    //*************************************************************************
+    template <typename T>
+    const T* find_substring_blocks(const T* first, const T* last, const T* s, const size_t n, const T*& found, etl::true_type)
+    {
+      typedef simd<sizeof(T)> ops;
+
+      const ptrdiff_t N         = ptrdiff_t(BLOCK_BYTES / sizeof(T));
+      const uint32_t  CHAR_BITS = uint32_t(MASK_BITS * sizeof(T));
+      const uint64_t  CHAR_MASK = (uint64_t(1U) << CHAR_BITS) - 1U;
+
+      const typename ops::vector first_char = ops::splat(to_unsigned(s[0]));
+      const typename ops::vector last_char  = ops::splat(to_unsigned(s[n - 1U]));
+
+      while ((last - first) >= ptrdiff_t(N + n - 1U))
+      {
+        uint64_t mask = ops::equal(first, first_char) & ops::equal(first + n - 1U, last_char);
+
+        while (mask != 0U)
+        {
+          const uint32_t index = lowest_bit(mask) / CHAR_BITS;
+
+          if (memcmp(first + index + 1U, s + 1U, (n - 2U) * sizeof(T)) == 0)
+          {
+            found = first + index;
+            return first;
+          }
+
+          mask &= ~(CHAR_MASK << (index * CHAR_BITS));
+        }
+
+        first += N;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// SIMD search for the terminating zero.
+    /// Returns the start of the block that contains it.
+    //*************************************************************************
+    template <typename T>
+    ETL_STRING_SEARCH_NO_SANITIZE
+    const T* find_terminator_blocks(const T* p, etl::true_type)
+    {
+      typedef simd<sizeof(T)> ops;
+
+      const ptrdiff_t N = ptrdiff_t(BLOCK_BYTES / sizeof(T));
+
+      while ((uintptr_t(p) % BLOCK_BYTES) != 0U)
+      {
+        if (*p == 0)
+        {
+          return p;
+        }
+
+        ++p;
+      }
+
+      const typename ops::vector zero = ops::splat(0U);
+
+      while (ops::equal(p, zero) == 0U)
+      {
+        p += N;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// SIMD comparison of two ranges.
+    /// Returns the number of leading characters known to be equal.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch_blocks(const T* s1, const T* s2, const size_t count, etl::true_type)
+    {
+      typedef simd<sizeof(T)> ops;
+
+      const size_t N = BLOCK_BYTES / sizeof(T);
+
+      size_t i = 0U;
+
+      while (((count - i) >= N) && (ops::equal(s1 + i, ops::load(s2 + i)) == ALL_MATCH))
+      {
+        i += N;
+      }
+
+      return i;
+    }
+#endif
+
+    //*************************************************************************
+    /// No SIMD for this character size.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char_blocks(const T* first, const T*, const T, const T*&, etl::false_type)
+    {
+      return first;
+    }
+
+    template <typename T>
+    const T* rfind_char_blocks(const T*, const T* last, const T, const T*&, etl::false_type)
+    {
+      return last;
+    }
+
+    template <typename T>
+    const T* find_substring_blocks(const T* first, const T*, const T*, const size_t, const T*&, etl::false_type)
+    {
+      return first;
+    }
+
+    template <typename T>
+    const T* find_terminator_blocks(const T* p, etl::false_type)
+    {
+      return p;
+    }
+
+    template <typename T>
+    size_t mismatch_blocks(const T*, const T*, const size_t, etl::false_type)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// Whether there is SIMD support for the character size.
+    //*************************************************************************
+    template <typename T>
+    struct has_simd
+    {
+#if defined(ETL_STRING_SEARCH_SIMD)
+      static const bool value = simd<sizeof(T)>::SUPPORTED;
+#else
+      static const bool value = false;
+#endif
+      typedef etl::integral_constant<bool, value> type;
+    };
+
+    //*************************************************************************
+    /// Word at a time (SWAR) operations.
+    /// A machine word holds several characters, which are tested together.
+    //*************************************************************************
+    typedef uintptr_t word_t;
+
+#if defined(__GNUC__) || defined(__clang__)
+    typedef word_t __attribute__((__may_alias__)) aliased_word_t;
+#endif
+
+    template <size_t Size>
+    struct swar
+    {
+      typedef typename etl::smallest_uint_for_bits<Size * CHAR_BIT>::type lane_t;
+
+      // 0x0101..., 0x00010001..., etc.
+      static const word_t ONES = word_t(~word_t(0U)) / word_t(lane_t(~lane_t(0U)));
+
+      // 0x7F7F..., 0x7FFF7FFF..., etc.
+      static const word_t LOW_BITS = ONES * word_t(lane_t(~lane_t(0U)) >> 1U);
+
+      //***********************************
+      template <typename T>
+      static word_t splat(const T c)
+      {
+        return ONES * word_t(lane_t(c));
+      }
+
+      //***********************************
+      /// The has_zero_byte test from binary.h, for lanes of Size bytes.
+      //***********************************
+      static bool has_zero(const word_t value)
+      {
+        if (Size == 1U)
+        {
+          return etl::has_zero_byte<>::test(value);
+        }
+
+        return word_t(~((((value & LOW_BITS) + LOW_BITS) | value) | LOW_BITS)) != 0U;
+      }
+
+      //***********************************
+      static word_t load(const void* p)
+      {
+        word_t value;
+        memcpy(&value, p, sizeof(word_t));
+
+        return value;
+      }
+
+      //***********************************
+      /// p must be aligned to a word.
+      //***********************************
+      ETL_STRING_SEARCH_NO_SANITIZE
+      static word_t load_aligned(const void* p)
+      {
+#if defined(__GNUC__) || defined(__clang__)
+        return *static_cast<const aliased_word_t*>(p);
+#else
+        return load(p);
+#endif
+      }
+    };
+
+    template <size_t Size>
+    const word_t swar<Size>::ONES;
+
+    template <size_t Size>
+    const word_t swar<Size>::LOW_BITS;
+
+    //*************************************************************************
+    /// Whether word at a time operations can be used for the character size.
+    //*************************************************************************
+    template <typename T>
+    struct has_swar
+    {
+#if defined(ETL_NO_SWAR)
+      static const bool value = false;
+#else
+      static const bool value = (sizeof(T) < sizeof(word_t));
+#endif
+      typedef etl::integral_constant<bool, value> type;
+    };
+
+    //*************************************************************************
+    /// Skips the words in [first, last) that do not contain c.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char_words(const T* first, const T* last, const T c, etl::true_type)
+    {
+      typedef swar<sizeof(T)> ops;
+
+      const ptrdiff_t N      = ptrdiff_t(sizeof(word_t) / sizeof(T));
+      const word_t    needle = ops::splat(c);
+
+      while (((last - first) >= N) && !ops::has_zero(ops::load(first) ^ needle))
+      {
+        first += N;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Skips the words that do not contain the terminating zero.
+    //*************************************************************************
+    template <typename T>
+    ETL_STRING_SEARCH_NO_SANITIZE
+    const T* find_terminator_words(const T* p, etl::true_type)
+    {
+      typedef swar<sizeof(T)> ops;
+
+      const ptrdiff_t N = ptrdiff_t(sizeof(word_t) / sizeof(T));
+
+      while ((uintptr_t(p) % sizeof(word_t)) != 0U)
+      {
+        if (*p == 0)
+        {
+          return p;
+        }
+
+        ++p;
+      }
+
+      while (!ops::has_zero(ops::load_aligned(p)))
+      {
+        p += N;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Returns the number of leading characters in equal words.
+    //*************************************************************************
+    template <typename T>
+    size_t mismatch_words(const T* s1, const T* s2, const size_t count, etl::true_type)
+    {
+      typedef swar<sizeof(T)> ops;
+
+      const size_t N = sizeof(word_t) / sizeof(T);
+
+      size_t i = 0U;
+
+      while (((count - i) >= N) && (ops::load(s1 + i) == ops::load(s2 + i)))
+      {
+        i += N;
+      }
+
+      return i;
+    }
+
+    //*************************************************************************
+    /// No word at a time operations for this character size.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char_words(const T* first, const T*, const T, etl::false_type)
+    {
+      return first;
+    }
+
+    template <typename T>
+    const T* find_terminator_words(const T* p, etl::false_type)
+    {
+      return p;
+    }
+
+    template <typename T>
+    size_t mismatch_words(const T*, const T*, const size_t, etl::false_type)
+    {
+      return 0U;
+    }
+
+    //*************************************************************************
+    /// The number of characters before the terminating zero.
+    /// The tags select the SIMD and word at a time searches, which may read
+    /// past the terminator.
+    //*************************************************************************
+    template <typename T, typename TBlocks, typename TWords>
+    size_t length(const T* str, TBlocks, TWords)
+    {
+      const T* p = find_terminator_blocks(str, TBlocks());
+
+      p = find_terminator_words(p, TWords());
+
+      while (*p != 0)
+      {
+        ++p;
+      }
+
+      return size_t(p - str);
+    }
+
+    //*************************************************************************
+    /// The number of characters before the terminating zero.
+    /// Only reads past the terminator if ETL_STRLEN_OVER_READ is defined.
+    //*************************************************************************
+    template <typename T>
+    size_t length(const T* str)
+    {
+#if defined(ETL_STRLEN_OVER_READ)
+      return length(str, typename has_simd<T>::type(), typename has_swar<T>::type());
+#else
+      return length(str, etl::false_type(), etl::false_type());
+#endif
+    }
+
+    //*************************************************************************
+    /// Compares count characters, using the character type's ordering.
+    /// The tags select the SIMD and word at a time comparisons.
+    /// \return -1, 0 or 1.
+    //*************************************************************************
+    template <typename T, typename TBlocks, typename TWords>
+    int compare(const T* s1, const T* s2, const size_t count, TBlocks, TWords)
+    {
+      size_t i = mismatch_blocks(s1, s2, count, TBlocks());
+
+      i += mismatch_words(s1 + i, s2 + i, count - i, TWords());
+
+      for (; i < count; ++i)
+      {
+        if (s1[i] < s2[i])
+        {
+          return -1;
+        }
+        else if (s1[i] > s2[i])
+        {
+          return 1;
+        }
+      }
+
+      return 0;
+    }
+
+    //*************************************************************************
+    /// Compares count characters, using the character type's ordering.
+    /// \return -1, 0 or 1.
+    //*************************************************************************
+    template <typename T>
+    int compare(const T* s1, const T* s2, const size_t count)
+    {
+      return compare(s1, s2, count, typename has_simd<T>::type(), typename has_swar<T>::type());
+    }
+
+    //*************************************************************************
+    /// Finds the first c in [first, last).
+    /// The tags select the SIMD and word at a time searches.
+    /// \return The position, or last if not found.
+    //*************************************************************************
+    template <typename T, typename TBlocks, typename TWords>
+    const T* find_char(const T* first, const T* last, const T c, TBlocks, TWords)
+    {
+      const T* found = nullptr;
+
+      first = find_char_blocks(first, last, c, found, TBlocks());
+
+      if (found != nullptr)
+      {
+        return found;
+      }
+
+      first = find_char_words(first, last, c, TWords());
+
+      for (; first < last; ++first)
+      {
+        if (*first == c)
+        {
+          return first;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the first c in [first, last).
+    /// \return The position, or last if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char(const T* first, const T* last, const T c)
+    {
+      return find_char(first, last, c, typename has_simd<T>::type(), typename has_swar<T>::type());
+    }
+
+    //*************************************************************************
+    /// Finds the last c in [first, last).
+    /// \return The position, or last if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* rfind_char(const T* first, const T* last, const T c)
+    {
+      const T* found = nullptr;
+      const T* end   = last;
+
+      last = rfind_char_blocks(first, last, c, found, typename has_simd<T>::type());
+
+      if (found != nullptr)
+      {
+        return found;
+      }
+
+      while (last > first)
+      {
+        --last;
+
+        if (*last == c)
+        {
+          return last;
+        }
+      }
+
+      return end;
+    }
+
+    //*************************************************************************
+    /// Finds the first occurrence of [s, s + n) in [first, last).
+    /// \return The position, or last if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_substring(const T* first, const T* last, const T* s, const size_t n)
+    {
+      if (n == 0U)
+      {
+        return (first <= last) ? first : last;
+      }
+
+      if (n == 1U)
+      {
+        return find_char(first, last, s[0]);
+      }
+
+      if ((last - first) < ptrdiff_t(n))
+      {
+        return last;
+      }
+
+      const T* found = nullptr;
+
+      first = find_substring_blocks(first, last, s, n, found, typename has_simd<T>::type());
+
+      if (found != nullptr)
+      {
+        return found;
+      }
+
+      const T first_char = s[0];
+      const T last_char  = s[n - 1U];
+
+      for (; (last - first) >= ptrdiff_t(n); ++first)
+      {
+        if ((first[0] == first_char) &&
+            (first[n - 1U] == last_char) &&
+            (memcmp(first + 1U, s + 1U, (n - 2U) * sizeof(T)) == 0))
+        {
+          return first;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// A set of characters, as a bitmap of the values below 256.
+    /// Larger values are checked against the original list.
+    //*************************************************************************
+    template <typename T>
+    class char_set
+    {
+    public:
+
+      char_set(const T* first_, const T* last_)
+        : first(first_),
+          last(last_),
+          has_large(false)
+      {
+        memset(bits, 0, sizeof(bits));
+
+        for (const T* p = first; p != last; ++p)
+        {
+          const uint32_t c = to_unsigned(*p);
+
+          if (c < 256U)
+          {
+            bits[c >> 5U] |= uint32_t(1U) << (c & 31U);
+          }
+          else
+          {
+            has_large = true;
+          }
+        }
+      }
+
+      bool contains(const T value) const
+      {
+        const uint32_t c = to_unsigned(value);
+
+        if (c < 256U)
+        {
+          return (bits[c >> 5U] & (uint32_t(1U) << (c & 31U))) != 0U;
+        }
+
+        if (has_large)
+        {
+          for (const T* p = first; p != last; ++p)
+          {
+            if (*p == value)
+            {
+              return true;
+            }
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      const T* first;
+      const T* last;
+      bool     has_large;
+      uint32_t bits[8];
+    };
+
+    //*************************************************************************
+    /// Finds the first character in [first, last) that is, or is not, in [s, s + n).
+    /// \return The position, or last if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_first_of(const T* first, const T* last, const T* s, const size_t n, const bool in_set)
+    {
+      if (in_set && (n == 1U))
+      {
+        return find_char(first, last, s[0]);
+      }
+
+      const char_set<T> set(s, s + n);
+
+      for (; first < last; ++first)
+      {
+        if (set.contains(*first) == in_set)
+        {
+          return first;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the last character in [first, last) that is, or is not, in [s, s + n).
+    /// \return The position, or last if not found.
+    //*************************************************************************
+    template <typename T>
+    const T* find_last_of(const T* first, const T* last, const T* s, const size_t n, const bool in_set)
+    {
+      if (in_set && (n == 1U))
+      {
+        return rfind_char(first, last, s[0]);
+      }
+
+      const char_set<T> set(s, s + n);
+
+      for (const T* p = last; p > first;)
+      {
+        --p;
+
+        if (set.contains(*p) == in_set)
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+  }
+}
+
+#endif
@@ -47,17 +47,22 @@ SOFTWARE.
 #include "../stl/iterator.h"
 #include "../stl/limits.h"
 
+#include "grisu.h"
+
 namespace etl
 {
   namespace private_to_string
   {
     //***************************************************************************
     /// Helper function for left/right alignment.
+    /// 'start' is the offset of the first character of the field. It is an
+    /// offset rather than an iterator, as the string may have moved to a new
+    /// buffer while the field was written.
     //***************************************************************************
     template <typename TIString>
-    void add_alignment(TIString& str, typename TIString::iterator position, const etl::basic_format_spec<TIString>& format)
+    void add_alignment(TIString& str, size_t start, const etl::basic_format_spec<TIString>& format)
     {
-      uint32_t length = static_cast<uint32_t>(std::distance(position, str.end()));
+      uint32_t length = static_cast<uint32_t>(str.size() - start);
 
       if (length < format.get_width())
       {
@@ -71,7 +76,7 @@ namespace etl
         else
         {
           // Insert fill characters on the left.
-          str.insert(position, fill_length, format.get_fill());
+          str.insert(str.begin() + start, fill_length, format.get_fill());
         }
       }
     }
@@ -86,7 +91,6 @@ namespace etl
                      const bool append)
     {
       typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
 
       static const type t[] = { 't', 'r', 'u', 'e' };
       static const type f[] = { 'f', 'a', 'l', 's', 'e' };
@@ -96,7 +100,7 @@ namespace etl
         str.clear();
       }
 
-      iterator start = str.end();
+      const size_t start = str.size();
 
       if (format.is_boolalpha())
       {
@@ -124,8 +128,157 @@ namespace etl
       etl::private_to_string::add_alignment(str, start, format);
     }
 
+    //***************************************************************************
+    /// The decimal digit pairs "00" to "99".
+    //***************************************************************************
+    inline const char* digit_pairs()
+    {
+      static const char pairs[] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+
+      return pairs;
+    }
+
+    //***************************************************************************
+    /// The digits for bases up to 36.
+    //***************************************************************************
+    inline const char* digit_characters(const bool upper_case)
+    {
+      static const char lower[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+      static const char upper[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+      return upper_case ? upper : lower;
+    }
+
+    //***************************************************************************
+    /// Returns the shift for bases that are powers of 2, or 0 for other bases.
+    //***************************************************************************
+    inline uint32_t base_shift(const uint32_t base)
+    {
+      switch (base)
+      {
+        case 2:  return 1U;
+        case 4:  return 2U;
+        case 8:  return 3U;
+        case 16: return 4U;
+        case 32: return 5U;
+        default: return 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Counts the digits of an unsigned value in the base.
+    //***************************************************************************
+    template <typename TUnsigned>
+    uint32_t count_digits(TUnsigned value, const uint32_t base)
+    {
+      uint32_t count = 1U;
+
+      if (base == 10U)
+      {
+        // Four digits per division.
+        while (true)
+        {
+          if (value < 10U)    return count;
+          if (value < 100U)   return count + 1U;
+          if (value < 1000U)  return count + 2U;
+          if (value < 10000U) return count + 3U;
+
+          value /= 10000U;
+          count += 4U;
+        }
+      }
+
+      const uint32_t shift = etl::private_to_string::base_shift(base);
+
+      if (shift != 0U)
+      {
+        while ((value >>= shift) != 0U)
+        {
+          ++count;
+        }
+      }
+      else
+      {
+        while ((value /= base) != 0U)
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of an unsigned value backwards from p_end.
+    /// The caller has made room for count_digits(value, base) characters.
+    //***************************************************************************
+    template <typename TUnsigned, typename TChar>
+    void write_digits(TUnsigned value, TChar* p_end, const uint32_t base, const bool upper_case)
+    {
+      if (base == 10U)
+      {
+        const char* pairs = etl::private_to_string::digit_pairs();
+
+        // Two digits per division.
+        while (value >= 100U)
+        {
+          const uint32_t index = uint32_t(value % 100U) * 2U;
+          value /= 100U;
+          *--p_end = TChar(pairs[index + 1U]);
+          *--p_end = TChar(pairs[index]);
+        }
+
+        if (value >= 10U)
+        {
+          const uint32_t index = uint32_t(value) * 2U;
+          *--p_end = TChar(pairs[index + 1U]);
+          *--p_end = TChar(pairs[index]);
+        }
+        else
+        {
+          *--p_end = TChar('0' + uint32_t(value));
+        }
+
+        return;
+      }
+
+      const char*    digits = etl::private_to_string::digit_characters(upper_case);
+      const uint32_t shift  = etl::private_to_string::base_shift(base);
+
+      if (shift != 0U)
+      {
+        const TUnsigned mask = TUnsigned(base - 1U);
+
+        do
+        {
+          *--p_end = TChar(digits[uint32_t(value & mask)]);
+          value >>= shift;
+        } while (value != 0U);
+      }
+      else
+      {
+        do
+        {
+          *--p_end = TChar(digits[uint32_t(value % base)]);
+          value /= base;
+        } while (value != 0U);
+      }
+    }
+
     //***************************************************************************
     /// Helper function for integrals.
+    /// The length is found first so that the digits are written straight to
+    /// their final position in the string. If the string does not have room,
+    /// the digits are built in a local buffer and appended with truncation.
     //***************************************************************************
     template <typename T, typename TIString>
     void add_integral(T value,
@@ -134,39 +287,51 @@ namespace etl
                       const bool append)
     {
       typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
 
-      const bool negative = etl::is_negative(value);
+      const bool     negative = etl::is_negative(value);
+      const uint32_t base     = format.get_base();
 
       if (!append)
       {
         str.clear();
       }
 
-      iterator start = str.end();
+      const size_t start = str.size();
 
-      if (value == 0)
+      // The magnitude, as an unsigned value.
+      const unsigned_t magnitude = negative ? unsigned_t(unsigned_t(0) - unsigned_t(value)) : unsigned_t(value);
+
+      // Only decimal values are signed.
+      const bool     add_sign = negative && (base == 10U);
+      const uint32_t n_digits = etl::private_to_string::count_digits(magnitude, base);
+      const uint32_t length   = n_digits + (add_sign ? 1U : 0U);
+
+      if (str.available() >= length)
       {
-        str.push_back(type('0'));
+        str.resize(str.size() + length);
+
+        if (add_sign)
+        {
+          str[start] = type('-');
+        }
+
+        etl::private_to_string::write_digits(magnitude, &*str.end(), base, format.is_upper_case());
       }
       else
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
-        {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
-        }
+        // Enough for a 64 bit binary value and a sign.
+        type buffer[std::numeric_limits<unsigned_t>::digits + 1];
+        type* const p_end = buffer + ETL_ARRAY_SIZE(buffer);
+
+        etl::private_to_string::write_digits(magnitude, p_end, base, format.is_upper_case());
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10) && negative)
+        if (add_sign)
         {
-          str.push_back(type('-'));
+          *(p_end - length) = type('-');
         }
 
-        // Reverse the string we appended.
-        std::reverse(start, str.end());
+        str.append(p_end - length, p_end);
       }
 
       etl::private_to_string::add_alignment(str, start, format);
@@ -216,6 +381,25 @@ namespace etl
       }
     }
 
+    //***************************************************************************
+    /// Helper function for short round trip floating point.
+    /// long double is formatted as double.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_shortest_floating_point(const T value, TIString& str)
+    {
+      typedef typename TIString::value_type type;
+      typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type float_t;
+
+      char buffer[etl::private_grisu::MAX_CHARS];
+      const char* const p_end = etl::private_grisu::to_chars(buffer, float_t(value));
+
+      for (const char* p = buffer; p != p_end; ++p)
+      {
+        str.push_back(type(*p));
+      }
+    }
+
     //***************************************************************************
     /// Helper function for floating point.
     //***************************************************************************
@@ -225,7 +409,6 @@ namespace etl
                             const etl::basic_format_spec<TIString>& format,
                             const bool append)
     {
-      typedef typename TIString::iterator   iterator;
       typedef typename TIString::value_type type;
 
       if (!append)
@@ -233,12 +416,16 @@ namespace etl
         str.clear();
       }
 
-      iterator start = str.end();
+      const size_t start = str.size();
 
       if (std::isnan(value) || std::isinf(value))
       {
         etl::private_to_string::add_nan_inf(std::isnan(value), std::isinf(value), str);
       }
+      else if (format.is_shortest())
+      {
+        etl::private_to_string::add_shortest_floating_point(value, str);
+      }
       else
       {
         // Make sure we format the two halves correctly.
@@ -49,7 +49,7 @@ SOFTWARE.
 namespace etl
 {
   template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_isr_base
+  class queue_spsc_locked_base
   {
   protected:
 
@@ -166,7 +166,7 @@ namespace etl
 
   protected:
 
-    queue_spsc_isr_base(T* p_buffer_, size_type max_size_)
+    queue_spsc_locked_base(T* p_buffer_, size_type max_size_)
       : p_buffer(p_buffer_),
         write_index(0),
         read_index(0),
@@ -378,12 +378,12 @@ namespace etl
     //*************************************************************************
 #if defined(ETL_POLYMORPHIC_SPSC_QUEUE_ISR) || defined(ETL_POLYMORPHIC_CONTAINERS)
   public:
-    virtual ~queue_spsc_isr_base()
+    virtual ~queue_spsc_locked_base()
     {
     }
 #else
   protected:
-    ~queue_spsc_isr_base()
+    ~queue_spsc_locked_base()
     {
     }
 #endif
@@ -391,17 +391,17 @@ namespace etl
 
   //***************************************************************************
   ///\ingroup queue_spsc
-  ///\brief This is the base for all queue_spsc_isrs that contain a particular type.
+  ///\brief This is the base for all queue_spsc_lockeds that contain a particular type.
   ///\details Normally a reference to this type will be taken from a derived queue_spsc_locked.
   /// This queue supports concurrent access by one producer and one consumer.
   /// \tparam T The type of value that the queue_spsc_locked holds.
   //***************************************************************************
   template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_locked : public queue_spsc_isr_base<T, MEMORY_MODEL>
+  class iqueue_spsc_locked : public queue_spsc_locked_base<T, MEMORY_MODEL>
   {
   private:
 
-    typedef queue_spsc_isr_base<T, MEMORY_MODEL> base_t;
+    typedef queue_spsc_locked_base<T, MEMORY_MODEL> base_t;
     typedef typename base_t::parameter_t parameter_t;
 
   public:
@@ -31,10 +31,12 @@ SOFTWARE.
 #ifndef ETL_RANDOM_INCLUDED
 #define ETL_RANDOM_INCLUDED
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "platform.h"
 #include "binary.h"
+#include "static_assert.h"
 
 namespace etl
 {
@@ -53,6 +55,18 @@ namespace etl
     virtual void initialise(uint32_t seed) = 0;
     virtual uint32_t operator()() = 0;
     virtual uint32_t range(uint32_t low, uint32_t high) = 0;
+
+    //*************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    /// The generators override this to avoid a virtual call per number.
+    //*************************************************************************
+    virtual void fill(uint32_t* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = operator()();
+      }
+    }
   };
 #else
   //***************************************************************************
@@ -72,6 +86,151 @@ namespace etl
   };
 #endif
 
+  namespace private_random
+  {
+    //*************************************************************************
+    /// A 128 bit unsigned value.
+    //*************************************************************************
+    struct uint128
+    {
+      uint64_t high;
+      uint64_t low;
+    };
+
+    //*************************************************************************
+    /// The full 128 bit product of two 64 bit values.
+    //*************************************************************************
+    inline uint128 multiply(uint64_t a, uint64_t b)
+    {
+      uint128 result;
+
+#if defined(__SIZEOF_INT128__)
+      __extension__ typedef unsigned __int128 uint128_t;
+
+      const uint128_t product = static_cast<uint128_t>(a) * b;
+
+      result.high = static_cast<uint64_t>(product >> 64U);
+      result.low  = static_cast<uint64_t>(product);
+#else
+      const uint64_t mask = 0xFFFFFFFFULL;
+
+      const uint64_t p0 = (a & mask) * (b & mask);
+      const uint64_t p1 = (a & mask) * (b >> 32U);
+      const uint64_t p2 = (a >> 32U) * (b & mask);
+      const uint64_t p3 = (a >> 32U) * (b >> 32U);
+
+      const uint64_t middle = (p0 >> 32U) + (p1 & mask) + (p2 & mask);
+
+      result.high = p3 + (p1 >> 32U) + (p2 >> 32U) + (middle >> 32U);
+      result.low  = (middle << 32U) | (p0 & mask);
+#endif
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The low 128 bits of the product of two 128 bit values.
+    //*************************************************************************
+    inline uint128 multiply(const uint128& a, const uint128& b)
+    {
+      uint128 result = multiply(a.low, b.low);
+
+      result.high += (a.high * b.low) + (a.low * b.high);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// The sum of two 128 bit values, modulo 2^128.
+    //*************************************************************************
+    inline uint128 add(const uint128& a, const uint128& b)
+    {
+      uint128 result;
+
+      result.low  = a.low + b.low;
+      result.high = a.high + b.high + ((result.low < a.low) ? 1U : 0U);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// SplitMix64, for expanding a seed into generator state.
+    /// http://prng.di.unimi.it/splitmix64.c
+    //*************************************************************************
+    inline uint64_t splitmix64(uint64_t& state)
+    {
+      uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+      z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+      z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+
+      return z ^ (z >> 31U);
+    }
+
+    //*************************************************************************
+    /// An unbiased number in [low, high] from a generator of uniform 32 bit
+    /// values. Lemire's multiply and shift, which only divides when a value
+    /// has to be rejected.
+    /// https://arxiv.org/abs/1805.10941
+    //*************************************************************************
+    template <typename TGenerator>
+    uint32_t range32(TGenerator& generator, uint32_t low, uint32_t high)
+    {
+      const uint32_t r = high - low + 1U;
+
+      if (r == 0U)
+      {
+        // The full 32 bit range.
+        return generator();
+      }
+
+      uint64_t m = uint64_t(generator()) * r;
+      uint32_t l = uint32_t(m);
+
+      if (l < r)
+      {
+        const uint32_t threshold = (0U - r) % r;
+
+        while (l < threshold)
+        {
+          m = uint64_t(generator()) * r;
+          l = uint32_t(m);
+        }
+      }
+
+      return low + uint32_t(m >> 32U);
+    }
+
+    //*************************************************************************
+    /// An unbiased number in [low, high] from a generator of uniform 64 bit
+    /// values.
+    //*************************************************************************
+    template <typename TGenerator>
+    uint64_t range64(TGenerator& generator, uint64_t low, uint64_t high)
+    {
+      const uint64_t r = high - low + 1U;
+
+      if (r == 0U)
+      {
+        // The full 64 bit range.
+        return generator();
+      }
+
+      uint128 m = multiply(generator(), r);
+
+      if (m.low < r)
+      {
+        const uint64_t threshold = (0U - r) % r;
+
+        while (m.low < threshold)
+        {
+          m = multiply(generator(), r);
+        }
+      }
+
+      return low + m.high;
+    }
+  }
+
   //***************************************************************************
   /// A 32 bit random number generator.
   /// Uses a 128 bit XOR shift algorithm.
@@ -139,12 +298,18 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
+        return private_random::range32(*this, low, high);
+      }
 
-        return n;
+      //***************************************************************************
+      /// Writes 'n' random numbers to 'p_out'.
+      //***************************************************************************
+      void fill(uint32_t* p_out, size_t n)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          p_out[i] = random_xorshift::operator()();
+        }
       }
 
     private:
@@ -210,12 +375,28 @@ namespace etl
     {
       uint32_t r = high - low + 1;
       uint32_t n = operator()();
-      n %= r;
-      n += low;
+
+      // r is zero for the full 32 bit range.
+      if (r != 0U)
+      {
+        n %= r;
+        n += low;
+      }
 
       return n;
     }
 
+    //***************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    //***************************************************************************
+    void fill(uint32_t* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = random_lcg::operator()();
+      }
+    }
+
   private:
 
     static const uint32_t a = 40014;
@@ -286,12 +467,28 @@ namespace etl
       {
         uint32_t r = high - low + 1;
         uint32_t n = operator()();
-        n %= r;
-        n += low;
+
+        // r is zero for the full 32 bit range.
+        if (r != 0U)
+        {
+          n %= r;
+          n += low;
+        }
 
         return n;
       }
 
+      //***************************************************************************
+      /// Writes 'n' random numbers to 'p_out'.
+      //***************************************************************************
+      void fill(uint32_t* p_out, size_t n)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          p_out[i] = random_clcg::operator()();
+        }
+      }
+
     private:
 
       static const uint32_t a1 = 40014;
@@ -367,12 +564,18 @@ namespace etl
       //***************************************************************************
       uint32_t range(uint32_t low, uint32_t high)
       {
-        uint32_t r = high - low + 1;
-        uint32_t n = operator()();
-        n %= r;
-        n += low;
+        return private_random::range32(*this, low, high);
+      }
 
-        return n;
+      //***************************************************************************
+      /// Writes 'n' random numbers to 'p_out'.
+      //***************************************************************************
+      void fill(uint32_t* p_out, size_t n)
+      {
+        for (size_t i = 0U; i < n; ++i)
+        {
+          p_out[i] = random_lsfr::operator()();
+        }
       }
 
     private:
@@ -436,12 +639,18 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return private_random::range32(*this, low, high);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    //***************************************************************************
+    void fill(uint32_t* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = random_mwc::operator()();
+      }
     }
 
   private:
@@ -503,12 +712,45 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return private_random::range32(*this, low, high);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    //***************************************************************************
+    void fill(uint32_t* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = random_pcg::operator()();
+      }
+    }
+
+    //***************************************************************************
+    /// Advances the sequence by 'delta' numbers in O(log delta) steps.
+    /// Gives each of several users a separate part of the same sequence.
+    //***************************************************************************
+    void advance(uint64_t delta)
+    {
+      uint64_t current_multiplier = multiplier;
+      uint64_t current_increment  = increment;
+      uint64_t total_multiplier   = 1U;
+      uint64_t total_increment    = 0U;
+
+      while (delta != 0U)
+      {
+        if ((delta & 1U) != 0U)
+        {
+          total_multiplier *= current_multiplier;
+          total_increment   = (total_increment * current_multiplier) + current_increment;
+        }
+
+        current_increment  *= (current_multiplier + 1U);
+        current_multiplier *= current_multiplier;
+        delta >>= 1U;
+      }
+
+      value = (value * total_multiplier) + total_increment;
     }
 
   private:
@@ -519,6 +761,450 @@ namespace etl
     uint64_t value;
   };
 
+  //***************************************************************************
+  /// A 32 bit random number generator that runs LANES independent 128 bit
+  /// XOR shift generators side by side.
+  /// The state of each lane is held in a separate array per word, so that the
+  /// compiler can step all of the lanes at once with vector instructions.
+  /// fill() writes LANES numbers per step, and is much faster than calling
+  /// operator() for each number. Each lane is seeded from the seed by SplitMix64.
+  ///\tparam LANES The number of generators. Best as a multiple of the vector width.
+  //***************************************************************************
+  template <const size_t LANES = 8U>
+  class random_xorshift_lanes : public random
+  {
+  public:
+
+    ETL_STATIC_ASSERT(LANES != 0U, "Must have at least one lane");
+
+    static const size_t LANE_COUNT = LANES;
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_xorshift_lanes()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n    = reinterpret_cast<uintptr_t>(this);
+      uint32_t  seed = static_cast<uint32_t>(n);
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xorshift_lanes(uint32_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint32_t seed)
+    {
+      uint64_t splitmix_state = seed;
+
+      for (size_t i = 0U; i < LANES; ++i)
+      {
+        const uint64_t a = private_random::splitmix64(splitmix_state);
+        const uint64_t b = private_random::splitmix64(splitmix_state);
+
+        s0[i] = static_cast<uint32_t>(a);
+        s1[i] = static_cast<uint32_t>(a >> 32U);
+        s2[i] = static_cast<uint32_t>(b);
+        s3[i] = static_cast<uint32_t>(b >> 32U) | 1U; // Never all zero.
+      }
+
+      index = LANES;
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint32_t operator()()
+    {
+      if (index == LANES)
+      {
+        step(buffer);
+        index = 0U;
+      }
+
+      return buffer[index++];
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint32_t range(uint32_t low, uint32_t high)
+    {
+      return private_random::range32(*this, low, high);
+    }
+
+    //***************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    /// Gives the same numbers as 'n' calls to operator().
+    //***************************************************************************
+    void fill(uint32_t* p_out, size_t n)
+    {
+      // Use up any buffered numbers first.
+      while ((n != 0U) && (index != LANES))
+      {
+        *p_out++ = buffer[index++];
+        --n;
+      }
+
+      while (n >= LANES)
+      {
+        step(p_out);
+        p_out += LANES;
+        n     -= LANES;
+      }
+
+      while (n != 0U)
+      {
+        *p_out++ = random_xorshift_lanes::operator()();
+        --n;
+      }
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Steps every lane once, writing one number per lane.
+    //***************************************************************************
+    void step(uint32_t* p_out)
+    {
+      for (size_t i = 0U; i < LANES; ++i)
+      {
+        uint32_t n = s3[i];
+        n ^= n << 11;
+        n ^= n >> 8;
+        s3[i] = s2[i];
+        s2[i] = s1[i];
+        s1[i] = s0[i];
+        n ^= s0[i];
+        n ^= s0[i] >> 19;
+        s0[i] = n;
+
+        p_out[i] = n;
+      }
+    }
+
+    uint32_t s0[LANES];
+    uint32_t s1[LANES];
+    uint32_t s2[LANES];
+    uint32_t s3[LANES];
+    uint32_t buffer[LANES];
+    size_t   index;
+  };
+
+  template <const size_t LANES>
+  const size_t random_xorshift_lanes<LANES>::LANE_COUNT;
+
+  //***************************************************************************
+  /// A 64 bit random number generator.
+  /// xoshiro256**, by David Blackman and Sebastiano Vigna.
+  /// Not derived from etl::random, as that returns 32 bit numbers.
+  /// jump() and long_jump() split the sequence into non-overlapping streams,
+  /// for example one per thread.
+  /// http://prng.di.unimi.it/
+  //***************************************************************************
+  class random_xoshiro256ss
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_xoshiro256ss()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      initialise(static_cast<uint64_t>(n));
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    random_xoshiro256ss(uint64_t seed)
+    {
+      initialise(seed);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value.
+    /// The state is expanded from the seed by SplitMix64.
+    ///\param seed The new seed value.
+    //***************************************************************************
+    void initialise(uint64_t seed)
+    {
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        state[i] = private_random::splitmix64(seed);
+      }
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with an explicit state.
+    /// The state must not be all zero.
+    //***************************************************************************
+    void initialise(uint64_t s0, uint64_t s1, uint64_t s2, uint64_t s3)
+    {
+      state[0] = s0;
+      state[1] = s1;
+      state[2] = s2;
+      state[3] = s3;
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint64_t operator()()
+    {
+      const uint64_t result = rotate_left(state[1] * 5U, 7U) * 9U;
+      const uint64_t t      = state[1] << 17U;
+
+      state[2] ^= state[0];
+      state[3] ^= state[1];
+      state[1] ^= state[2];
+      state[0] ^= state[3];
+      state[2] ^= t;
+      state[3]  = rotate_left(state[3], 45U);
+
+      return result;
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint64_t range(uint64_t low, uint64_t high)
+    {
+      return private_random::range64(*this, low, high);
+    }
+
+    //***************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    //***************************************************************************
+    void fill(uint64_t* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = operator()();
+      }
+    }
+
+    //***************************************************************************
+    /// Advances the sequence by 2^128 numbers.
+    //***************************************************************************
+    void jump()
+    {
+      static const uint64_t polynomial[4] = { 0x180EC6D33CFD0ABAULL, 0xD5A61266F0C9392CULL,
+                                              0xA9582618E03FC9AAULL, 0x39ABDC4529B1661CULL };
+      apply(polynomial);
+    }
+
+    //***************************************************************************
+    /// Advances the sequence by 2^192 numbers.
+    //***************************************************************************
+    void long_jump()
+    {
+      static const uint64_t polynomial[4] = { 0x76E15D3EFEFDCBBFULL, 0xC5004E441C522FB3ULL,
+                                              0x77710069854EE241ULL, 0x39109BB02ACBE635ULL };
+      apply(polynomial);
+    }
+
+  private:
+
+    //***************************************************************************
+    static uint64_t rotate_left(uint64_t value, unsigned distance)
+    {
+      return (value << distance) | (value >> (64U - distance));
+    }
+
+    //***************************************************************************
+    /// Applies a jump polynomial to the state.
+    //***************************************************************************
+    void apply(const uint64_t (&polynomial)[4])
+    {
+      uint64_t s[4] = { 0U, 0U, 0U, 0U };
+
+      for (size_t i = 0U; i < 4U; ++i)
+      {
+        for (unsigned b = 0U; b < 64U; ++b)
+        {
+          if ((polynomial[i] & (uint64_t(1U) << b)) != 0U)
+          {
+            s[0] ^= state[0];
+            s[1] ^= state[1];
+            s[2] ^= state[2];
+            s[3] ^= state[3];
+          }
+
+          operator()();
+        }
+      }
+
+      state[0] = s[0];
+      state[1] = s[1];
+      state[2] = s[2];
+      state[3] = s[3];
+    }
+
+    uint64_t state[4];
+  };
+
+  //***************************************************************************
+  /// A 64 bit random number generator.
+  /// PCG XSL RR 128/64, as pcg64 in the reference implementation.
+  /// Not derived from etl::random, as that returns 32 bit numbers.
+  /// Generators with different stream ids give independent sequences from the
+  /// same seed. advance() skips ahead in the sequence.
+  /// http://www.pcg-random.org/
+  //***************************************************************************
+  class random_pcg64
+  {
+  public:
+
+    //***************************************************************************
+    /// Default constructor.
+    /// Attempts to come up with a unique seed.
+    //***************************************************************************
+    random_pcg64()
+    {
+      // An attempt to come up with a unique seed,
+      // based on the address of the instance.
+      uintptr_t n = reinterpret_cast<uintptr_t>(this);
+      initialise(static_cast<uint64_t>(n), 0U);
+    }
+
+    //***************************************************************************
+    /// Constructor with seed value and stream id.
+    ///\param seed   The new seed value.
+    ///\param stream The stream id.
+    //***************************************************************************
+    random_pcg64(uint64_t seed, uint64_t stream = 0U)
+    {
+      initialise(seed, stream);
+    }
+
+    //***************************************************************************
+    /// Initialises the sequence with a new seed value and stream id.
+    ///\param seed   The new seed value.
+    ///\param stream The stream id.
+    //***************************************************************************
+    void initialise(uint64_t seed, uint64_t stream = 0U)
+    {
+      increment.high = stream >> 63U;
+      increment.low  = (stream << 1U) | 1U;
+
+      state.high = 0U;
+      state.low  = 0U;
+      step();
+
+      private_random::uint128 s;
+      s.high = 0U;
+      s.low  = seed;
+      state  = private_random::add(state, s);
+      step();
+    }
+
+    //***************************************************************************
+    /// Get the next random number.
+    //***************************************************************************
+    uint64_t operator()()
+    {
+      step();
+
+      const uint64_t x     = state.high ^ state.low;
+      const unsigned count = static_cast<unsigned>(state.high >> 58U);
+
+      return (x >> count) | (x << ((64U - count) & 63U));
+    }
+
+    //***************************************************************************
+    /// Get the next random number in a specified inclusive range.
+    //***************************************************************************
+    uint64_t range(uint64_t low, uint64_t high)
+    {
+      return private_random::range64(*this, low, high);
+    }
+
+    //***************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    //***************************************************************************
+    void fill(uint64_t* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = operator()();
+      }
+    }
+
+    //***************************************************************************
+    /// Advances the sequence by 'delta' numbers in O(log delta) steps.
+    //***************************************************************************
+    void advance(uint64_t delta)
+    {
+      private_random::uint128 current_multiplier = get_multiplier();
+      private_random::uint128 current_increment  = increment;
+      private_random::uint128 total_multiplier;
+      private_random::uint128 total_increment;
+      private_random::uint128 one;
+
+      total_multiplier.high = 0U;
+      total_multiplier.low  = 1U;
+      total_increment.high  = 0U;
+      total_increment.low   = 0U;
+      one.high              = 0U;
+      one.low               = 1U;
+
+      while (delta != 0U)
+      {
+        if ((delta & 1U) != 0U)
+        {
+          total_multiplier = private_random::multiply(total_multiplier, current_multiplier);
+          total_increment  = private_random::add(private_random::multiply(total_increment, current_multiplier), current_increment);
+        }
+
+        current_increment  = private_random::multiply(current_increment, private_random::add(current_multiplier, one));
+        current_multiplier = private_random::multiply(current_multiplier, current_multiplier);
+        delta >>= 1U;
+      }
+
+      state = private_random::add(private_random::multiply(state, total_multiplier), total_increment);
+    }
+
+  private:
+
+    //***************************************************************************
+    static private_random::uint128 get_multiplier()
+    {
+      private_random::uint128 multiplier;
+
+      multiplier.high = 0x2360ED051FC65DA4ULL;
+      multiplier.low  = 0x4385DF649FCCF645ULL;
+
+      return multiplier;
+    }
+
+    //***************************************************************************
+    void step()
+    {
+      state = private_random::add(private_random::multiply(state, get_multiplier()), increment);
+    }
+
+    private_random::uint128 state;
+    private_random::uint128 increment;
+  };
+
 #if ETL_8BIT_SUPPORT
   //***************************************************************************
   /// A 32 bit random number generator.
@@ -571,12 +1257,18 @@ namespace etl
     //***************************************************************************
     uint32_t range(uint32_t low, uint32_t high)
     {
-      uint32_t r = high - low + 1;
-      uint32_t n = operator()();
-      n %= r;
-      n += low;
+      return private_random::range32(*this, low, high);
+    }
 
-      return n;
+    //***************************************************************************
+    /// Writes 'n' random numbers to 'p_out'.
+    //***************************************************************************
+    void fill(uint32_t* p_out, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        p_out[i] = random_hash::operator()();
+      }
     }
 
   private:
@@ -0,0 +1,502 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_ROPE_INCLUDED
+#define ETL_ROPE_INCLUDED
+
+///\ingroup string
+
+#include <stddef.h>
+#include <string.h>
+
+#include "platform.h"
+#include "basic_string.h"
+#include "string_view.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "57"
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup string
+  /// Exception base for ropes.
+  //***************************************************************************
+  class rope_exception : public etl::exception
+  {
+  public:
+
+    rope_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// No more segments exception.
+  //***************************************************************************
+  class rope_full : public etl::rope_exception
+  {
+  public:
+
+    rope_full(string_type file_name_, numeric_type line_number_)
+      : rope_exception(ETL_ERROR_TEXT("rope:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// No room in the owned buffer exception.
+  //***************************************************************************
+  class rope_buffer_full : public etl::rope_exception
+  {
+  public:
+
+    rope_buffer_full(string_type file_name_, numeric_type line_number_)
+      : rope_exception(ETL_ERROR_TEXT("rope:buffer full", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A segmented string builder.
+  /// Holds a list of views of text that is not copied.
+  /// The referenced text must outlive the rope.
+  /// Text that would not otherwise outlive the rope may be copied into the
+  /// rope's own buffer with append_copy.
+  /// Appending text that directly follows the last segment in memory extends
+  /// that segment.
+  /// The segments may be exported for scatter/gather I/O with to_iovec, or
+  /// copied into a string with flatten_into.
+  //***************************************************************************
+  template <typename T>
+  class ibasic_rope
+  {
+  public:
+
+    typedef T                          value_type;
+    typedef size_t                     size_type;
+    typedef etl::basic_string_view<T>  view_type;
+    typedef const view_type*           const_iterator;
+
+    //*************************************************************************
+    /// Appends a reference to the text.
+    ///\return <b>true</b> if appended, <b>false</b> if there were no free segments.
+    //*************************************************************************
+    bool append(const view_type& view)
+    {
+      return append(view.data(), view.size());
+    }
+
+    //*************************************************************************
+    /// Appends a reference to the text.
+    ///\return <b>true</b> if appended, <b>false</b> if there were no free segments.
+    //*************************************************************************
+    bool append(const T* text, size_t length)
+    {
+      if (length == 0U)
+      {
+        return true;
+      }
+
+      // Extend the last segment if the text follows it.
+      if (n_segments != 0U)
+      {
+        view_type& last = p_segments[n_segments - 1U];
+
+        if ((last.data() + last.size()) == text)
+        {
+          last = view_type(last.data(), last.size() + length);
+          current_size += length;
+          return true;
+        }
+      }
+
+      ETL_ASSERT(n_segments != MAX_SEGMENTS, ETL_ERROR(rope_full));
+
+      if (n_segments == MAX_SEGMENTS)
+      {
+        return false;
+      }
+
+      p_segments[n_segments] = view_type(text, length);
+      ++n_segments;
+      current_size += length;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Appends a reference to the null terminated text.
+    ///\return <b>true</b> if appended, <b>false</b> if there were no free segments.
+    //*************************************************************************
+    bool append(const T* text)
+    {
+      return append(view_type(text));
+    }
+
+    //*************************************************************************
+    /// Appends a reference to the contents of a string.
+    /// The string must not be modified while the rope refers to it.
+    ///\return <b>true</b> if appended, <b>false</b> if there were no free segments.
+    //*************************************************************************
+    bool append(const etl::ibasic_string<T>& str)
+    {
+      return append(str.data(), str.size());
+    }
+
+    //*************************************************************************
+    /// Copies the text into the rope's buffer and appends a reference to it.
+    ///\return <b>true</b> if appended, <b>false</b> if there was no room.
+    //*************************************************************************
+    bool append_copy(const T* text, size_t length)
+    {
+      ETL_ASSERT(length <= buffer_available(), ETL_ERROR(rope_buffer_full));
+
+      if (length > buffer_available())
+      {
+        return false;
+      }
+
+      T* p_destination = p_buffer + buffer_used;
+
+      if (!append(p_destination, length))
+      {
+        return false;
+      }
+
+      memcpy(p_destination, text, length * sizeof(T));
+      buffer_used += length;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Copies the text into the rope's buffer and appends a reference to it.
+    ///\return <b>true</b> if appended, <b>false</b> if there was no room.
+    //*************************************************************************
+    bool append_copy(const view_type& view)
+    {
+      return append_copy(view.data(), view.size());
+    }
+
+    //*************************************************************************
+    /// Copies the character into the rope's buffer and appends a reference to it.
+    ///\return <b>true</b> if appended, <b>false</b> if there was no room.
+    //*************************************************************************
+    bool append_copy(T c)
+    {
+      return append_copy(&c, 1U);
+    }
+
+    //*************************************************************************
+    /// Removes all of the segments and empties the buffer.
+    //*************************************************************************
+    void clear()
+    {
+      n_segments   = 0U;
+      current_size = 0U;
+      buffer_used  = 0U;
+    }
+
+    //*************************************************************************
+    /// The total number of characters.
+    //*************************************************************************
+    size_type size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// The total number of characters.
+    //*************************************************************************
+    size_type length() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if there are no characters.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if all of the segments are used.
+    //*************************************************************************
+    bool full() const
+    {
+      return n_segments == MAX_SEGMENTS;
+    }
+
+    //*************************************************************************
+    /// The number of segments.
+    //*************************************************************************
+    size_type number_of_segments() const
+    {
+      return n_segments;
+    }
+
+    //*************************************************************************
+    /// The maximum number of segments.
+    //*************************************************************************
+    size_type max_segments() const
+    {
+      return MAX_SEGMENTS;
+    }
+
+    //*************************************************************************
+    /// The number of characters free in the rope's buffer.
+    //*************************************************************************
+    size_type buffer_available() const
+    {
+      return BUFFER_SIZE - buffer_used;
+    }
+
+    //*************************************************************************
+    /// Gets a segment.
+    //*************************************************************************
+    const view_type& operator [](size_t i) const
+    {
+      return p_segments[i];
+    }
+
+    //*************************************************************************
+    /// The first segment.
+    //*************************************************************************
+    const_iterator begin() const
+    {
+      return p_segments;
+    }
+
+    //*************************************************************************
+    /// One past the last segment.
+    //*************************************************************************
+    const_iterator end() const
+    {
+      return p_segments + n_segments;
+    }
+
+    //*************************************************************************
+    /// Fills an array of iovec like structures, with members iov_base and
+    /// iov_len, for use with writev style scatter/gather I/O.
+    /// iov_len is in bytes.
+    ///\param p_iovec   The array to fill.
+    ///\param max_count The size of the array.
+    ///\param first     The first segment to export.
+    ///\return The number of entries filled.
+    //*************************************************************************
+    template <typename TIoVec>
+    size_t to_iovec(TIoVec* p_iovec, size_t max_count, size_t first = 0U) const
+    {
+      size_t count = 0U;
+
+      for (size_t i = first; (i < n_segments) && (count < max_count); ++i)
+      {
+        p_iovec[count].iov_base = const_cast<T*>(p_segments[i].data());
+        p_iovec[count].iov_len  = p_segments[i].size() * sizeof(T);
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Copies the text into a contiguous string.
+    /// The text is truncated if the string is too small.
+    ///\param str    The destination string.
+    ///\param append If <b>true</b> the text is appended to the string.
+    //*************************************************************************
+    etl::ibasic_string<T>& flatten_into(etl::ibasic_string<T>& str, const bool append = false) const
+    {
+      if (!append)
+      {
+        str.clear();
+      }
+
+      for (size_t i = 0U; i < n_segments; ++i)
+      {
+        str.append(p_segments[i].data(), p_segments[i].size());
+      }
+
+      return str;
+    }
+
+    //*************************************************************************
+    /// Copies characters from the rope to a buffer.
+    ///\param p_destination The destination buffer.
+    ///\param count         The maximum number of characters to copy.
+    ///\param position      The position of the first character to copy.
+    ///\return The number of characters copied.
+    //*************************************************************************
+    size_t copy(T* p_destination, size_t count, size_t position = 0U) const
+    {
+      size_t copied = 0U;
+
+      for (size_t i = 0U; (i < n_segments) && (copied < count); ++i)
+      {
+        const size_t segment_size = p_segments[i].size();
+
+        if (position >= segment_size)
+        {
+          position -= segment_size;
+        }
+        else
+        {
+          size_t length = segment_size - position;
+          length = (length > (count - copied)) ? (count - copied) : length;
+
+          memcpy(p_destination + copied, p_segments[i].data() + position, length * sizeof(T));
+
+          copied  += length;
+          position = 0U;
+        }
+      }
+
+      return copied;
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ibasic_rope(view_type* p_segments_, size_t max_segments_, T* p_buffer_, size_t buffer_size_)
+      : p_segments(p_segments_),
+        MAX_SEGMENTS(max_segments_),
+        p_buffer(p_buffer_),
+        BUFFER_SIZE(buffer_size_),
+        n_segments(0U),
+        current_size(0U),
+        buffer_used(0U)
+    {
+    }
+
+  private:
+
+    // Disabled. Segments may refer to the rope's own buffer.
+    ibasic_rope(const ibasic_rope&);
+    ibasic_rope& operator =(const ibasic_rope&);
+
+    view_type* const p_segments;
+    const size_t     MAX_SEGMENTS;
+    T* const         p_buffer;
+    const size_t     BUFFER_SIZE;
+    size_t           n_segments;
+    size_t           current_size;
+    size_t           buffer_used;
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A segmented string builder with storage for the segments and copied text.
+  ///\tparam MAX_SEGMENTS_ The maximum number of segments.
+  ///\tparam BUFFER_SIZE_  The number of characters available to append_copy.
+  //***************************************************************************
+  template <typename T, const size_t MAX_SEGMENTS_, const size_t BUFFER_SIZE_ = 0U>
+  class basic_rope : public etl::ibasic_rope<T>
+  {
+  public:
+
+    static const size_t MAX_SEGMENTS = MAX_SEGMENTS_;
+    static const size_t BUFFER_SIZE  = BUFFER_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    basic_rope()
+      : etl::ibasic_rope<T>(segments, MAX_SEGMENTS, buffer, BUFFER_SIZE)
+    {
+    }
+
+  private:
+
+    typename etl::ibasic_rope<T>::view_type segments[MAX_SEGMENTS];
+    T buffer[(BUFFER_SIZE == 0U) ? 1U : BUFFER_SIZE];
+  };
+
+  template <typename T, const size_t MAX_SEGMENTS_, const size_t BUFFER_SIZE_>
+  const size_t basic_rope<T, MAX_SEGMENTS_, BUFFER_SIZE_>::MAX_SEGMENTS;
+
+  template <typename T, const size_t MAX_SEGMENTS_, const size_t BUFFER_SIZE_>
+  const size_t basic_rope<T, MAX_SEGMENTS_, BUFFER_SIZE_>::BUFFER_SIZE;
+
+  typedef etl::ibasic_rope<char>     irope;
+  typedef etl::ibasic_rope<wchar_t>  iwrope;
+  typedef etl::ibasic_rope<char16_t> iu16rope;
+  typedef etl::ibasic_rope<char32_t> iu32rope;
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A segmented string builder for char.
+  //***************************************************************************
+  template <const size_t MAX_SEGMENTS_, const size_t BUFFER_SIZE_ = 0U>
+  class rope : public etl::basic_rope<char, MAX_SEGMENTS_, BUFFER_SIZE_>
+  {
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A segmented string builder for wchar_t.
+  //***************************************************************************
+  template <const size_t MAX_SEGMENTS_, const size_t BUFFER_SIZE_ = 0U>
+  class wrope : public etl::basic_rope<wchar_t, MAX_SEGMENTS_, BUFFER_SIZE_>
+  {
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A segmented string builder for char16_t.
+  //***************************************************************************
+  template <const size_t MAX_SEGMENTS_, const size_t BUFFER_SIZE_ = 0U>
+  class u16rope : public etl::basic_rope<char16_t, MAX_SEGMENTS_, BUFFER_SIZE_>
+  {
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A segmented string builder for char32_t.
+  //***************************************************************************
+  template <const size_t MAX_SEGMENTS_, const size_t BUFFER_SIZE_ = 0U>
+  class u32rope : public etl::basic_rope<char32_t, MAX_SEGMENTS_, BUFFER_SIZE_>
+  {
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -39,6 +39,9 @@ SOFTWARE.
 #include "task.h"
 #include "type_traits.h"
 #include "function.h"
+#include "atomic.h"
+#include "binary.h"
+#include "task_statistics.h"
 
 #undef ETL_FILE
 #define ETL_FILE "36"
@@ -97,6 +100,48 @@ namespace etl
     }
   };
 
+  namespace private_scheduler
+  {
+    //*************************************************************************
+    /// Asks the task for work, noting when work is first seen for tasks with statistics.
+    /// Scheduler policies call the task through these so that statistics are recorded.
+    //*************************************************************************
+    inline uint32_t request_work(const etl::task& task)
+    {
+      const uint32_t n_work = task.task_request_work();
+
+#if ETL_HAS_ATOMIC
+      if ((n_work > 0) && (task.get_task_statistics() != nullptr))
+      {
+        task.get_task_statistics()->work_available();
+      }
+#endif
+
+      return n_work;
+    }
+
+    //*************************************************************************
+    /// Calls the task to process work, timing it for tasks with statistics.
+    //*************************************************************************
+    inline void process_work(etl::task& task)
+    {
+#if ETL_HAS_ATOMIC
+      etl::task_statistics* p_statistics = task.get_task_statistics();
+
+      if (p_statistics != nullptr)
+      {
+        p_statistics->begin_run();
+        task.task_process_work();
+        p_statistics->end_run();
+      }
+      else
+#endif
+      {
+        task.task_process_work();
+      }
+    }
+  }
+
   //***************************************************************************
   /// Sequencial Single.
   /// A policy the scheduler can use to decide what to do next.
@@ -112,9 +157,9 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        if (task.task_request_work() > 0)
+        if (private_scheduler::request_work(task) > 0)
         {
-          task.task_process_work();
+          private_scheduler::process_work(task);
           idle = false;
         }
       }
@@ -138,9 +183,9 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        while (task.task_request_work() > 0)
+        while (private_scheduler::request_work(task) > 0)
         {
-          task.task_process_work();
+          private_scheduler::process_work(task);
           idle = false;
         }
       }
@@ -165,9 +210,9 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        if (task.task_request_work() > 0)
+        if (private_scheduler::request_work(task) > 0)
         {
-          task.task_process_work();
+          private_scheduler::process_work(task);
           idle = false;
           break;
         }
@@ -200,7 +245,7 @@ namespace etl
       {
         etl::task& task = *(task_list[index]);
 
-        uint_least8_t n_work = task.task_request_work();
+        uint_least8_t n_work = private_scheduler::request_work(task);
 
         if (n_work > most_work)
         {
@@ -212,7 +257,7 @@ namespace etl
 
       if (!idle)
       {
-        task_list[most_index]->task_process_work();
+        private_scheduler::process_work(*task_list[most_index]);
       }
 
       return idle;
@@ -270,7 +315,7 @@ namespace etl
     //*******************************************
     /// Force the scheduler to exit.
     //*******************************************
-    void exit_scheduler()
+    virtual void exit_scheduler()
     {
       scheduler_exit = true;
     }
@@ -278,6 +323,7 @@ namespace etl
     //*******************************************
     /// Add a task.
     /// Add to the task list in priority order.
+    /// The task's id is set to its position in the list.
     //*******************************************
     void add_task(etl::task& task)
     {
@@ -290,7 +336,13 @@ namespace etl
                                                                 task.get_task_priority(),
                                                                 compare_priority());
 
-        task_list.insert(itask, &task);
+        itask = task_list.insert(itask, &task);
+
+        // Renumber the tasks that have moved.
+        for (; itask != task_list.end(); ++itask)
+        {
+          (*itask)->set_task_id(size_t(itask - task_list.begin()));
+        }
       }
     }
 
@@ -402,6 +454,181 @@ namespace etl
     typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
     task_list_t task_list;
   };
+
+#if ETL_HAS_ATOMIC
+  //***************************************************************************
+  /// Ready set scheduler.
+  /// Tasks, interrupts or other threads call signal_task() when a task has
+  /// work. Each pass, only the signalled tasks are given to the policy, so
+  /// idle tasks are not polled. Tasks that still have work after the pass
+  /// stay in the ready set.
+  /// Tasks are identified by the id set by add_task().
+  /// Every task is polled once when the scheduler starts.
+  /// The idle callback is called when the ready set is empty and may be used
+  /// to sleep until has_ready_tasks() is true. The wake callback is called by
+  /// signal_task(), from the signalling context, to end the sleep.
+  /// All tasks must be added before the scheduler is started.
+  //***************************************************************************
+  template <typename TSchedulerPolicy, size_t MAX_TASKS_>
+  class ready_scheduler : public etl::ischeduler, protected TSchedulerPolicy
+  {
+  public:
+
+    enum
+    {
+      MAX_TASKS = MAX_TASKS_,
+    };
+
+    ready_scheduler()
+      : ischeduler(task_list),
+        p_wake_callback(nullptr)
+    {
+      for (size_t i = 0; i < READY_WORDS; ++i)
+      {
+        ready[i].store(0);
+      }
+    }
+
+    //*******************************************
+    /// Set the wake callback.
+    //*******************************************
+    void set_wake_callback(etl::ifunction<void>& callback)
+    {
+      p_wake_callback = &callback;
+    }
+
+    //*******************************************
+    /// Signals that the task has work.
+    /// May be called from an interrupt or another thread.
+    //*******************************************
+    void signal_task(const etl::task& task)
+    {
+      const size_t id = task.get_task_id();
+
+      if (task.get_task_statistics() != nullptr)
+      {
+        task.get_task_statistics()->work_available();
+      }
+
+      if (id < MAX_TASKS)
+      {
+        ready[id / BITS_PER_WORD].fetch_or(uint32_t(1) << (id % BITS_PER_WORD));
+      }
+
+      if (p_wake_callback)
+      {
+        (*p_wake_callback)();
+      }
+    }
+
+    //*******************************************
+    /// Are any tasks signalled?
+    //*******************************************
+    bool has_ready_tasks() const
+    {
+      for (size_t i = 0; i < READY_WORDS; ++i)
+      {
+        if (ready[i].load() != 0)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Start the scheduler.
+    //*******************************************
+    void start()
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+
+      // Poll every task on the first pass.
+      for (size_t i = 0; i < task_list.size(); ++i)
+      {
+        set_ready(i);
+      }
+
+      scheduler_running = true;
+
+      while (!scheduler_exit)
+      {
+        if (scheduler_running)
+        {
+          bool idle = true;
+
+          take_ready_tasks();
+
+          if (!ready_list.empty())
+          {
+            idle = TSchedulerPolicy::schedule_tasks(ready_list);
+
+            // Keep the tasks that still have work in the ready set.
+            for (size_t i = 0; i < ready_list.size(); ++i)
+            {
+              if (private_scheduler::request_work(*ready_list[i]) > 0)
+              {
+                set_ready(ready_list[i]->get_task_id());
+              }
+            }
+          }
+
+          if (p_watchdog_callback)
+          {
+            (*p_watchdog_callback)();
+          }
+
+          if (idle && p_idle_callback)
+          {
+            (*p_idle_callback)();
+          }
+        }
+      }
+    }
+
+  private:
+
+    static const size_t BITS_PER_WORD = 32U;
+    static const size_t READY_WORDS   = (MAX_TASKS + BITS_PER_WORD - 1U) / BITS_PER_WORD;
+
+    //*******************************************
+    /// Sets the ready bit for a task id.
+    //*******************************************
+    void set_ready(size_t id)
+    {
+      ready[id / BITS_PER_WORD].fetch_or(uint32_t(1) << (id % BITS_PER_WORD));
+    }
+
+    //*******************************************
+    /// Moves the signalled tasks to the ready list, in priority order.
+    //*******************************************
+    void take_ready_tasks()
+    {
+      ready_list.clear();
+
+      for (size_t i = 0; i < READY_WORDS; ++i)
+      {
+        uint32_t bits = ready[i].exchange(0);
+
+        while (bits != 0)
+        {
+          const size_t bit = etl::count_trailing_zeros(bits);
+          bits &= (bits - 1);
+
+          ready_list.push_back(task_list[(i * BITS_PER_WORD) + bit]);
+        }
+      }
+    }
+
+    typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
+    task_list_t task_list;
+    task_list_t ready_list;
+
+    etl::ifunction<void>* p_wake_callback;
+    etl::atomic<uint32_t> ready[READY_WORDS];
+  };
+#endif
 }
 
 #undef ETL_FILE
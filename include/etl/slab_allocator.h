@@ -0,0 +1,497 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SLAB_ALLOCATOR_INCLUDED
+#define ETL_SLAB_ALLOCATOR_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "pool.h"
+#include "alignment.h"
+#include "log.h"
+#include "power.h"
+#include "nullptr.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#if ETL_CPP17_SUPPORTED && !defined(ETL_NO_STL) && defined(__has_include)
+  #if __has_include(<memory_resource>)
+    #include <memory_resource>
+    #define ETL_SLAB_MEMORY_RESOURCE_SUPPORTED 1
+  #endif
+#endif
+
+#undef ETL_FILE
+#define ETL_FILE "61"
+
+//*****************************************************************************
+///\defgroup slab_allocator slab_allocator
+/// A fixed footprint allocator for blocks of mixed sizes.
+/// Each size class has a pool in its own equal sized slab of one buffer, so
+/// the class of a block is found from its address with a shift.
+///\ingroup memory
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for slab_allocator exceptions.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  class slab_allocator_exception : public etl::exception
+  {
+  public:
+
+    slab_allocator_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// There is no free block large enough.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  class slab_allocator_no_allocation : public etl::slab_allocator_exception
+  {
+  public:
+
+    slab_allocator_no_allocation(string_type file_name_, numeric_type line_number_)
+      : slab_allocator_exception(ETL_ERROR_TEXT("slab_allocator:allocation", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The block does not belong to the allocator.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  class slab_allocator_not_in_slab : public etl::slab_allocator_exception
+  {
+  public:
+
+    slab_allocator_not_in_slab(string_type file_name_, numeric_type line_number_)
+      : slab_allocator_exception(ETL_ERROR_TEXT("slab_allocator:not in slab", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The size classes are not valid.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  class slab_allocator_class_size : public etl::slab_allocator_exception
+  {
+  public:
+
+    slab_allocator_class_size(string_type file_name_, numeric_type line_number_)
+      : slab_allocator_exception(ETL_ERROR_TEXT("slab_allocator:class size", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The statistics for one size class.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  struct slab_class_statistics
+  {
+    size_t block_size;  ///< The size of the blocks.
+    size_t capacity;    ///< The number of blocks in the slab.
+    size_t in_use;      ///< The number of blocks allocated now.
+    size_t peak;        ///< The largest number of blocks allocated at once.
+    size_t allocations; ///< The number of blocks allocated in total.
+    size_t overflows;   ///< The number of requests passed to a larger class because this one was full.
+  };
+
+  namespace private_slab_allocator
+  {
+    //*************************************************************************
+    /// A pool over a slab of the allocator's buffer.
+    //*************************************************************************
+    class slab_pool : public etl::ipool
+    {
+    public:
+
+      slab_pool(char* p_buffer_, uint32_t item_size_, uint32_t max_size_)
+        : etl::ipool(p_buffer_, item_size_, max_size_)
+      {
+      }
+    };
+
+    //*************************************************************************
+    /// A size class.
+    //*************************************************************************
+    struct slab_class
+    {
+      size_t block_size;
+      size_t peak;
+      size_t allocations;
+      size_t overflows;
+    };
+  }
+
+  //***************************************************************************
+  /// The interface of a slab allocator.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  class islab_allocator
+  {
+  public:
+
+    typedef private_slab_allocator::slab_pool  slab_pool;
+    typedef private_slab_allocator::slab_class slab_class;
+
+    //*************************************************************************
+    /// Allocates a block of at least 'size' bytes, aligned to 'alignment'.
+    /// Uses the smallest suitable class with a free block.
+    /// If there is none and asserts or exceptions are enabled an
+    /// etl::slab_allocator_no_allocation is thrown, otherwise a nullptr is
+    /// returned.
+    /// An alignment of zero is treated as one.
+    //*************************************************************************
+    void* allocate(size_t size, size_t alignment = 1U)
+    {
+      if (alignment == 0U)
+      {
+        alignment = 1U;
+      }
+
+      if (alignment <= ALIGNMENT)
+      {
+        for (size_t i = 0U; i < CLASS_COUNT; ++i)
+        {
+          slab_class& sc = p_classes[i];
+
+          if ((sc.block_size >= size) && ((sc.block_size % alignment) == 0U))
+          {
+            slab_pool& pool = p_pools[i];
+
+            if (pool.full())
+            {
+              ++sc.overflows;
+            }
+            else
+            {
+              void* p = pool.allocate<char>();
+
+              ++sc.allocations;
+
+              if (pool.size() > sc.peak)
+              {
+                sc.peak = pool.size();
+              }
+
+              return p;
+            }
+          }
+        }
+      }
+
+      ETL_ASSERT(false, ETL_ERROR(slab_allocator_no_allocation));
+
+      return nullptr;
+    }
+
+    //*************************************************************************
+    /// Returns a block to its class.
+    /// If asserts or exceptions are enabled and the block does not belong to
+    /// the allocator an etl::slab_allocator_not_in_slab is thrown.
+    //*************************************************************************
+    void deallocate(void* p)
+    {
+      if (p != nullptr)
+      {
+        if (is_in_slab(p))
+        {
+          p_pools[class_index(p)].release(p);
+        }
+        else
+        {
+          ETL_ASSERT(false, ETL_ERROR(slab_allocator_not_in_slab));
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Checks to see if the block is inside the allocator's buffer.
+    //*************************************************************************
+    bool is_in_slab(const void* p) const
+    {
+      const char* pc = static_cast<const char*>(p);
+
+      return (pc >= p_buffer) && (pc < (p_buffer + (CLASS_COUNT << SLAB_SHIFT)));
+    }
+
+    //*************************************************************************
+    /// The index of the class that the block belongs to.
+    /// The block must be in the allocator's buffer.
+    //*************************************************************************
+    size_t class_index(const void* p) const
+    {
+      return size_t(static_cast<const char*>(p) - p_buffer) >> SLAB_SHIFT;
+    }
+
+    //*************************************************************************
+    /// The number of size classes.
+    //*************************************************************************
+    size_t class_count() const
+    {
+      return CLASS_COUNT;
+    }
+
+    //*************************************************************************
+    /// The largest block that can be allocated.
+    //*************************************************************************
+    size_t max_block_size() const
+    {
+      return p_classes[CLASS_COUNT - 1U].block_size;
+    }
+
+    //*************************************************************************
+    /// The statistics for the class at 'index'.
+    //*************************************************************************
+    etl::slab_class_statistics statistics(size_t index) const
+    {
+      const slab_class& sc  = p_classes[index];
+      const slab_pool& pool = p_pools[index];
+
+      etl::slab_class_statistics result;
+
+      result.block_size  = sc.block_size;
+      result.capacity    = pool.max_size();
+      result.in_use      = pool.size();
+      result.peak        = sc.peak;
+      result.allocations = sc.allocations;
+      result.overflows   = sc.overflows;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Clears the statistics, apart from the blocks in use.
+    //*************************************************************************
+    void reset_statistics()
+    {
+      for (size_t i = 0U; i < CLASS_COUNT; ++i)
+      {
+        p_classes[i].peak        = p_pools[i].size();
+        p_classes[i].allocations = 0U;
+        p_classes[i].overflows   = 0U;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns every block to its class.
+    //*************************************************************************
+    void release_all()
+    {
+      for (size_t i = 0U; i < CLASS_COUNT; ++i)
+      {
+        p_pools[i].release_all();
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    islab_allocator(char* p_buffer_, slab_pool* p_pools_, slab_class* p_classes_, size_t class_count_, size_t slab_shift_, size_t alignment_)
+      : p_buffer(p_buffer_),
+        p_pools(p_pools_),
+        p_classes(p_classes_),
+        CLASS_COUNT(class_count_),
+        SLAB_SHIFT(slab_shift_),
+        ALIGNMENT(alignment_)
+    {
+    }
+
+    //*************************************************************************
+    /// Creates the classes.
+    /// The block sizes must be in increasing order, fit in a slab, and be
+    /// able to hold and align a pointer.
+    //*************************************************************************
+    void initialise(const size_t* p_block_sizes)
+    {
+      const size_t slab_size = size_t(1U) << SLAB_SHIFT;
+
+      for (size_t i = 0U; i < CLASS_COUNT; ++i)
+      {
+        const size_t block_size = p_block_sizes[i];
+
+        ETL_ASSERT((block_size >= sizeof(void*)) &&
+                   ((block_size % etl::alignment_of<void*>::value) == 0U) &&
+                   (block_size <= slab_size) &&
+                   ((i == 0U) || (block_size > p_block_sizes[i - 1U])), ETL_ERROR(slab_allocator_class_size));
+
+        ::new (&p_pools[i]) slab_pool(p_buffer + (i * slab_size), uint32_t(block_size), uint32_t(slab_size / block_size));
+
+        p_classes[i].block_size  = block_size;
+        p_classes[i].peak        = 0U;
+        p_classes[i].allocations = 0U;
+        p_classes[i].overflows   = 0U;
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    islab_allocator(const islab_allocator&);
+    islab_allocator& operator =(const islab_allocator&);
+
+    char*       p_buffer;
+    slab_pool*  p_pools;
+    slab_class* p_classes;
+
+    const size_t CLASS_COUNT;
+    const size_t SLAB_SHIFT;
+    const size_t ALIGNMENT;
+  };
+
+  //***************************************************************************
+  /// A slab allocator with CLASS_COUNT size classes, each with a slab of
+  /// SLAB_SIZE bytes.
+  /// The default classes are powers of two, starting at the size of a pointer.
+  ///\tparam SLAB_SIZE_   The bytes for each class. Must be a power of two.
+  ///\tparam CLASS_COUNT_ The number of size classes.
+  ///\tparam ALIGNMENT_   The alignment of the slabs.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  template <const size_t SLAB_SIZE_, const size_t CLASS_COUNT_, const size_t ALIGNMENT_ = etl::alignment_of<double>::value>
+  class slab_allocator : public etl::islab_allocator
+  {
+  public:
+
+    static const size_t SLAB_SIZE   = SLAB_SIZE_;
+    static const size_t CLASS_COUNT = CLASS_COUNT_;
+    static const size_t ALIGNMENT   = ALIGNMENT_;
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<SLAB_SIZE_>::value, "The slab size must be a power of two");
+    ETL_STATIC_ASSERT(CLASS_COUNT_ > 0U, "There must be at least one class");
+    ETL_STATIC_ASSERT(SLAB_SIZE_ >= ALIGNMENT_, "The slab size must be at least the alignment");
+
+    //*************************************************************************
+    /// Constructor.
+    /// Power of two block sizes, starting at the size of a pointer.
+    //*************************************************************************
+    slab_allocator()
+      : islab_allocator(reinterpret_cast<char*>(&buffer), reinterpret_cast<slab_pool*>(&pools[0]), classes, CLASS_COUNT_, etl::log2<SLAB_SIZE_>::value, ALIGNMENT_)
+    {
+      ETL_STATIC_ASSERT((sizeof(void*) << (CLASS_COUNT_ - 1U)) <= SLAB_SIZE_, "The largest default class is larger than the slab size");
+
+      size_t block_sizes[CLASS_COUNT_];
+
+      for (size_t i = 0U; i < CLASS_COUNT_; ++i)
+      {
+        block_sizes[i] = sizeof(void*) << i;
+      }
+
+      this->initialise(block_sizes);
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// User specified block sizes, in increasing order.
+    //*************************************************************************
+    explicit slab_allocator(const size_t (&block_sizes)[CLASS_COUNT_])
+      : islab_allocator(reinterpret_cast<char*>(&buffer), reinterpret_cast<slab_pool*>(&pools[0]), classes, CLASS_COUNT_, etl::log2<SLAB_SIZE_>::value, ALIGNMENT_)
+    {
+      this->initialise(block_sizes);
+    }
+
+  private:
+
+    typename etl::aligned_storage<SLAB_SIZE_ * CLASS_COUNT_, ALIGNMENT_>::type buffer;
+    typename etl::aligned_storage<sizeof(slab_pool), etl::alignment_of<slab_pool>::value>::type pools[CLASS_COUNT_];
+    slab_class classes[CLASS_COUNT_];
+  };
+
+  template <const size_t SLAB_SIZE_, const size_t CLASS_COUNT_, const size_t ALIGNMENT_>
+  const size_t slab_allocator<SLAB_SIZE_, CLASS_COUNT_, ALIGNMENT_>::SLAB_SIZE;
+
+  template <const size_t SLAB_SIZE_, const size_t CLASS_COUNT_, const size_t ALIGNMENT_>
+  const size_t slab_allocator<SLAB_SIZE_, CLASS_COUNT_, ALIGNMENT_>::CLASS_COUNT;
+
+  template <const size_t SLAB_SIZE_, const size_t CLASS_COUNT_, const size_t ALIGNMENT_>
+  const size_t slab_allocator<SLAB_SIZE_, CLASS_COUNT_, ALIGNMENT_>::ALIGNMENT;
+
+#if defined(ETL_SLAB_MEMORY_RESOURCE_SUPPORTED)
+  //***************************************************************************
+  /// A std::pmr::memory_resource that allocates from a slab allocator.
+  /// If asserts or exceptions are not enabled then a failed allocation
+  /// returns a nullptr.
+  ///\ingroup slab_allocator
+  //***************************************************************************
+  class slab_memory_resource : public std::pmr::memory_resource
+  {
+  public:
+
+    explicit slab_memory_resource(etl::islab_allocator& slab_)
+      : slab(slab_)
+    {
+    }
+
+    //*************************************************************************
+    /// The slab allocator.
+    //*************************************************************************
+    etl::islab_allocator& get_slab_allocator() const
+    {
+      return slab;
+    }
+
+  private:
+
+    void* do_allocate(size_t bytes, size_t alignment) override
+    {
+      return slab.allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* p, size_t, size_t) override
+    {
+      slab.deallocate(p);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+    {
+      return this == &other;
+    }
+
+    etl::islab_allocator& slab;
+  };
+#endif
+}
+
+#undef ETL_FILE
+
+#endif
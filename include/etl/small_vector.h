@@ -0,0 +1,304 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SMALL_VECTOR_INCLUDED
+#define ETL_SMALL_VECTOR_INCLUDED
+
+///\ingroup vector
+
+#include "platform.h"
+#include "vector.h"
+#include "pool.h"
+#include "arena.h"
+#include "memory.h"
+#include "alignment.h"
+#include "type_traits.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A vector that stores up to INLINE_SIZE elements inline and moves them to
+  /// a block of MAX_SIZE elements when it grows beyond that.
+  /// The block is taken from an etl::ipool, whose items must be at least as
+  /// large as block_type, for example
+  /// etl::pool<etl::small_vector<T, INLINE_SIZE, MAX_SIZE>::block_type, N>,
+  /// or from an etl::arena.
+  /// capacity() is the size of the current buffer. If no block is available
+  /// the vector stays inline and is full at INLINE_SIZE, as for etl::vector.
+  /// It spills through an etl::ivector reference as well.
+  /// A pool block is kept until shrink_to_fit() or destruction. An arena
+  /// block is reclaimed when the arena is reset or rolled back.
+  ///\tparam INLINE_SIZE_ The number of elements stored inline.
+  ///\tparam MAX_SIZE_    The maximum number of elements.
+  ///\ingroup vector
+  //***************************************************************************
+  template <typename T, const size_t INLINE_SIZE_, const size_t MAX_SIZE_>
+  class small_vector : public etl::ivector<T>
+  {
+  public:
+
+    typedef etl::ivector<T> base_type;
+
+    static const size_t INLINE_SIZE = INLINE_SIZE_;
+    static const size_t MAX_SIZE    = MAX_SIZE_;
+
+    ETL_STATIC_ASSERT(INLINE_SIZE_ <= MAX_SIZE_, "Inline size larger than the maximum size");
+    ETL_STATIC_ASSERT(!etl::is_pointer<T>::value, "Vectors of pointers do not support spilling");
+
+    //*************************************************************************
+    /// The spilled storage for a vector.
+    //*************************************************************************
+    struct block_type
+    {
+      typename etl::aligned_storage<sizeof(T) * MAX_SIZE_, etl::alignment_of<T>::value>::type buffer;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pool_ The pool to take a block from when the elements do not fit inline.
+    //*************************************************************************
+    explicit small_vector(etl::ipool& pool_)
+      : base_type(reinterpret_cast<T*>(&inline_buffer), INLINE_SIZE),
+        p_pool(&pool_),
+        p_arena(nullptr),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&small_vector::grow);
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param arena_ The arena to take a block from when the elements do not fit inline.
+    //*************************************************************************
+    explicit small_vector(etl::arena& arena_)
+      : base_type(reinterpret_cast<T*>(&inline_buffer), INLINE_SIZE),
+        p_pool(nullptr),
+        p_arena(&arena_),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&small_vector::grow);
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Uses the same pool or arena as the other vector.
+    //*************************************************************************
+    small_vector(const small_vector& other)
+      : base_type(reinterpret_cast<T*>(&inline_buffer), INLINE_SIZE),
+        p_pool(other.p_pool),
+        p_arena(other.p_arena),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&small_vector::grow);
+      this->initialise();
+      this->assign(other.begin(), other.end());
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns a pool block to the pool.
+    //*************************************************************************
+    ~small_vector()
+    {
+      this->clear();
+      release_block();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    small_vector& operator = (const small_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    small_vector& operator = (const base_type& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs.begin(), rhs.end());
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if the elements are stored inline.
+    //*************************************************************************
+    bool is_inline() const
+    {
+      return p_block == nullptr;
+    }
+
+    //*************************************************************************
+    /// Moves the elements back inline and returns the block, if they fit.
+    //*************************************************************************
+    void shrink_to_fit()
+    {
+      if ((p_block != nullptr) && (this->size() <= INLINE_SIZE))
+      {
+        T* p_inline = reinterpret_cast<T*>(&inline_buffer);
+
+        move_elements(this->p_buffer, this->p_end, p_inline, relocatable_tag());
+        this->set_buffer(p_inline, INLINE_SIZE);
+        release_block();
+      }
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    //*************************************************************************
+#ifdef ETL_IVECTOR_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+      if (p_block == nullptr)
+      {
+        base_type::repair_buffer(reinterpret_cast<T*>(&inline_buffer));
+      }
+    }
+
+  private:
+
+    typedef etl::integral_constant<bool, etl::is_trivially_relocatable<T>::value> relocatable_tag;
+
+    //*************************************************************************
+    /// Moves the elements to a block from the pool or arena.
+    //*************************************************************************
+    static bool grow(base_type& vec, size_t new_size)
+    {
+      small_vector& self = static_cast<small_vector&>(vec);
+
+      if ((self.p_block != nullptr) || (new_size > MAX_SIZE))
+      {
+        return false;
+      }
+
+      block_type* p_new = self.allocate_block();
+
+      if (p_new == nullptr)
+      {
+        return false;
+      }
+
+      T* p_buffer = reinterpret_cast<T*>(&p_new->buffer);
+
+      move_elements(self.p_buffer, self.p_end, p_buffer, relocatable_tag());
+      self.set_buffer(p_buffer, MAX_SIZE);
+      self.p_block = p_new;
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Gets a block, or nullptr if none is available.
+    //*************************************************************************
+    block_type* allocate_block()
+    {
+      if (p_pool != nullptr)
+      {
+        return p_pool->full() ? nullptr : p_pool->allocate<block_type>();
+      }
+      else if (p_arena->can_allocate(sizeof(block_type), etl::alignment_of<block_type>::value))
+      {
+        return static_cast<block_type*>(p_arena->allocate(sizeof(block_type), etl::alignment_of<block_type>::value));
+      }
+      else
+      {
+        return nullptr;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns a pool block to the pool.
+    //*************************************************************************
+    void release_block()
+    {
+      if ((p_block != nullptr) && (p_pool != nullptr))
+      {
+        p_pool->release(p_block);
+      }
+
+      p_block = nullptr;
+    }
+
+    //*************************************************************************
+    /// Moves trivially relocatable elements by copying their bytes.
+    //*************************************************************************
+    static void move_elements(T* first, T* last, T* d_first, etl::true_type)
+    {
+      etl::relocate(first, last, d_first);
+    }
+
+    //*************************************************************************
+    /// Moves other elements by construction and destroys the originals.
+    //*************************************************************************
+    static void move_elements(T* first, T* last, T* d_first, etl::false_type)
+    {
+      while (first != last)
+      {
+#if ETL_CPP11_SUPPORTED
+        ::new (d_first) T(std::move(*first));
+#else
+        ::new (d_first) T(*first);
+#endif
+        first->~T();
+        ++first;
+        ++d_first;
+      }
+    }
+
+    etl::ipool* p_pool;
+    etl::arena* p_arena;
+    block_type* p_block;
+    typename etl::aligned_storage<sizeof(T) * INLINE_SIZE_, etl::alignment_of<T>::value>::type inline_buffer;
+  };
+
+  template <typename T, const size_t INLINE_SIZE_, const size_t MAX_SIZE_>
+  const size_t small_vector<T, INLINE_SIZE_, MAX_SIZE_>::INLINE_SIZE;
+
+  template <typename T, const size_t INLINE_SIZE_, const size_t MAX_SIZE_>
+  const size_t small_vector<T, INLINE_SIZE_, MAX_SIZE_>::MAX_SIZE;
+}
+
+#endif
@@ -0,0 +1,720 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SOA_VECTOR_INCLUDED
+#define ETL_SOA_VECTOR_INCLUDED
+
+#include <stddef.h>
+#include <new>
+
+#include "platform.h"
+
+#include "stl/functional.h"
+#include "stl/utility.h"
+
+#include "alignment.h"
+#include "array_view.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
+
+#undef ETL_FILE
+#define ETL_FILE "63"
+
+//*****************************************************************************
+///\defgroup soa_vector soa_vector
+/// A fixed capacity vector of records, stored as one array per field.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// The base class for soa_vector exceptions.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_exception : public etl::exception
+  {
+  public:
+
+    soa_vector_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The soa_vector is full.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_full : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_full(string_type file_name_, numeric_type line_number_)
+      : soa_vector_exception(ETL_ERROR_TEXT("soa_vector:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The soa_vector is empty.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_empty : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_empty(string_type file_name_, numeric_type line_number_)
+      : soa_vector_exception(ETL_ERROR_TEXT("soa_vector:empty", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// The row index is out of bounds.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  class soa_vector_out_of_bounds : public etl::soa_vector_exception
+  {
+  public:
+
+    soa_vector_out_of_bounds(string_type file_name_, numeric_type line_number_)
+      : soa_vector_exception(ETL_ERROR_TEXT("soa_vector:bounds", ETL_FILE"C"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_soa_vector
+  {
+    //*************************************************************************
+    /// The column arrays, one level per type.
+    //*************************************************************************
+    template <const size_t N, typename... TTypes>
+    struct columns;
+
+    template <const size_t N>
+    struct columns<N>
+    {
+      void construct(size_t)                           {}
+      void copy_construct(size_t, const columns&)      {}
+      void destroy(size_t)                             {}
+      void move_assign(size_t, size_t)                 {}
+      void swap_rows(size_t, size_t)                   {}
+    };
+
+    template <const size_t N, typename T, typename... TRest>
+    struct columns<N, T, TRest...> : public columns<N, TRest...>
+    {
+      typedef columns<N, TRest...> rest_type;
+
+      T* data()
+      {
+        return reinterpret_cast<T*>(&buffer);
+      }
+
+      const T* data() const
+      {
+        return reinterpret_cast<const T*>(&buffer);
+      }
+
+      // Default constructs the row.
+      void construct(size_t i)
+      {
+        ::new (data() + i) T();
+        rest_type::construct(i);
+      }
+
+      // Constructs the row from one value per column.
+      template <typename U, typename... URest>
+      void construct(size_t i, U&& value, URest&&... rest)
+      {
+        ::new (data() + i) T(std::forward<U>(value));
+        rest_type::construct(i, std::forward<URest>(rest)...);
+      }
+
+      void copy_construct(size_t i, const columns& other)
+      {
+        ::new (data() + i) T(other.data()[i]);
+        rest_type::copy_construct(i, other);
+      }
+
+      void destroy(size_t i)
+      {
+        data()[i].~T();
+        rest_type::destroy(i);
+      }
+
+      void move_assign(size_t to, size_t from)
+      {
+        data()[to] = std::move(data()[from]);
+        rest_type::move_assign(to, from);
+      }
+
+      void swap_rows(size_t a, size_t b)
+      {
+        using std::swap;
+        swap(data()[a], data()[b]);
+        rest_type::swap_rows(a, b);
+      }
+
+      typename etl::aligned_storage<sizeof(T) * N, etl::alignment_of<T>::value>::type buffer;
+    };
+
+    //*************************************************************************
+    /// The type and the column level of column I.
+    //*************************************************************************
+    template <const size_t I, const size_t N, typename... TTypes>
+    struct column_at;
+
+    template <const size_t I, const size_t N, typename T, typename... TRest>
+    struct column_at<I, N, T, TRest...> : public column_at<I - 1U, N, TRest...>
+    {
+    };
+
+    template <const size_t N, typename T, typename... TRest>
+    struct column_at<0U, N, T, TRest...>
+    {
+      typedef T                        type;
+      typedef columns<N, T, TRest...> columns_type;
+    };
+  }
+
+  //***************************************************************************
+  /// A fixed capacity vector of records, where each field is kept in its own
+  /// contiguous array. Loops that touch a few fields of every record only
+  /// read the columns they use.
+  /// Rows are added, erased and reordered in every column together.
+  ///\tparam MAX_SIZE_ The maximum number of rows.
+  ///\tparam TTypes    The type of each column.
+  ///\ingroup soa_vector
+  //***************************************************************************
+  template <const size_t MAX_SIZE_, typename... TTypes>
+  class soa_vector
+  {
+  private:
+
+    typedef private_soa_vector::columns<MAX_SIZE_, TTypes...> columns_type;
+
+  public:
+
+    static const size_t MAX_SIZE     = MAX_SIZE_;
+    static const size_t COLUMN_COUNT = sizeof...(TTypes);
+
+    ETL_STATIC_ASSERT(sizeof...(TTypes) > 0U, "There must be at least one column");
+
+    typedef size_t size_type;
+
+    //*************************************************************************
+    /// The type of column I.
+    //*************************************************************************
+    template <const size_t I>
+    struct column_type
+    {
+      ETL_STATIC_ASSERT(I < sizeof...(TTypes), "Column index out of range");
+
+      typedef typename private_soa_vector::column_at<I, MAX_SIZE_, TTypes...>::type type;
+    };
+
+    //*************************************************************************
+    /// A reference to a row.
+    //*************************************************************************
+    class row_reference
+    {
+    public:
+
+      //***********************************************************************
+      /// The field in column I.
+      //***********************************************************************
+      template <const size_t I>
+      typename column_type<I>::type& get() const
+      {
+        return p_vector->template get<I>(row);
+      }
+
+      //***********************************************************************
+      /// The index of the row.
+      //***********************************************************************
+      size_t index() const
+      {
+        return row;
+      }
+
+    private:
+
+      friend class soa_vector;
+
+      row_reference(soa_vector& vector_, size_t row_)
+        : p_vector(&vector_),
+          row(row_)
+      {
+      }
+
+      soa_vector* p_vector;
+      size_t      row;
+    };
+
+    //*************************************************************************
+    /// A const reference to a row.
+    //*************************************************************************
+    class const_row_reference
+    {
+    public:
+
+      //***********************************************************************
+      /// The field in column I.
+      //***********************************************************************
+      template <const size_t I>
+      const typename column_type<I>::type& get() const
+      {
+        return p_vector->template get<I>(row);
+      }
+
+      //***********************************************************************
+      /// The index of the row.
+      //***********************************************************************
+      size_t index() const
+      {
+        return row;
+      }
+
+    private:
+
+      friend class soa_vector;
+
+      const_row_reference(const soa_vector& vector_, size_t row_)
+        : p_vector(&vector_),
+          row(row_)
+      {
+      }
+
+      const soa_vector* p_vector;
+      size_t            row;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    soa_vector()
+      : current_size(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    soa_vector(const soa_vector& other)
+      : current_size(0U)
+    {
+      assign(other);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~soa_vector()
+    {
+      clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    soa_vector& operator = (const soa_vector& rhs)
+    {
+      if (&rhs != this)
+      {
+        clear();
+        assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// The contents of column I.
+    //*************************************************************************
+    template <const size_t I>
+    etl::array_view<typename column_type<I>::type> column()
+    {
+      return etl::array_view<typename column_type<I>::type>(data<I>(), current_size);
+    }
+
+    //*************************************************************************
+    /// The contents of column I.
+    //*************************************************************************
+    template <const size_t I>
+    etl::array_view<const typename column_type<I>::type> column() const
+    {
+      return etl::array_view<const typename column_type<I>::type>(data<I>(), current_size);
+    }
+
+    //*************************************************************************
+    /// A pointer to the array for column I.
+    //*************************************************************************
+    template <const size_t I>
+    typename column_type<I>::type* data()
+    {
+      typedef typename private_soa_vector::column_at<I, MAX_SIZE_, TTypes...>::columns_type level_type;
+
+      return static_cast<level_type&>(cols).data();
+    }
+
+    //*************************************************************************
+    /// A pointer to the array for column I.
+    //*************************************************************************
+    template <const size_t I>
+    const typename column_type<I>::type* data() const
+    {
+      typedef typename private_soa_vector::column_at<I, MAX_SIZE_, TTypes...>::columns_type level_type;
+
+      return static_cast<const level_type&>(cols).data();
+    }
+
+    //*************************************************************************
+    /// The field in column I of row 'i'.
+    //*************************************************************************
+    template <const size_t I>
+    typename column_type<I>::type& get(size_t i)
+    {
+      return data<I>()[i];
+    }
+
+    //*************************************************************************
+    /// The field in column I of row 'i'.
+    //*************************************************************************
+    template <const size_t I>
+    const typename column_type<I>::type& get(size_t i) const
+    {
+      return data<I>()[i];
+    }
+
+    //*************************************************************************
+    /// The field in column I of row 'i'.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if
+    /// the row does not exist.
+    //*************************************************************************
+    template <const size_t I>
+    typename column_type<I>::type& at(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+      return data<I>()[i];
+    }
+
+    //*************************************************************************
+    /// The field in column I of row 'i'.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if
+    /// the row does not exist.
+    //*************************************************************************
+    template <const size_t I>
+    const typename column_type<I>::type& at(size_t i) const
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+      return data<I>()[i];
+    }
+
+    //*************************************************************************
+    /// A reference to row 'i'.
+    //*************************************************************************
+    row_reference operator [](size_t i)
+    {
+      return row_reference(*this, i);
+    }
+
+    //*************************************************************************
+    /// A reference to row 'i'.
+    //*************************************************************************
+    const_row_reference operator [](size_t i) const
+    {
+      return const_row_reference(*this, i);
+    }
+
+    //*************************************************************************
+    /// A reference to the first row.
+    //*************************************************************************
+    row_reference front()
+    {
+      return row_reference(*this, 0U);
+    }
+
+    //*************************************************************************
+    /// A reference to the last row.
+    //*************************************************************************
+    row_reference back()
+    {
+      return row_reference(*this, current_size - 1U);
+    }
+
+    //*************************************************************************
+    /// Adds a row with one value per column.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the
+    /// vector is already full.
+    //*************************************************************************
+    template <typename... TValues>
+    void push_back(TValues&&... values)
+    {
+      ETL_STATIC_ASSERT(sizeof...(TValues) == sizeof...(TTypes), "One value per column is required");
+
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(current_size != MAX_SIZE, ETL_ERROR(soa_vector_full));
+#endif
+      cols.construct(current_size, std::forward<TValues>(values)...);
+      ++current_size;
+    }
+
+    //*************************************************************************
+    /// Adds a default constructed row.
+    /// If asserts or exceptions are enabled, emits soa_vector_full if the
+    /// vector is already full.
+    //*************************************************************************
+    row_reference emplace_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(current_size != MAX_SIZE, ETL_ERROR(soa_vector_full));
+#endif
+      cols.construct(current_size);
+
+      return row_reference(*this, current_size++);
+    }
+
+    //*************************************************************************
+    /// Removes the last row.
+    /// If asserts or exceptions are enabled, emits soa_vector_empty if the
+    /// vector is empty.
+    //*************************************************************************
+    void pop_back()
+    {
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(current_size > 0U, ETL_ERROR(soa_vector_empty));
+#endif
+      --current_size;
+      cols.destroy(current_size);
+    }
+
+    //*************************************************************************
+    /// Removes row 'i', keeping the order of the rows after it.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if
+    /// the row does not exist.
+    //*************************************************************************
+    void erase(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      for (size_t j = i + 1U; j < current_size; ++j)
+      {
+        cols.move_assign(j - 1U, j);
+      }
+
+      pop_back();
+    }
+
+    //*************************************************************************
+    /// Removes row 'i' by moving the last row into its place.
+    /// If asserts or exceptions are enabled, emits soa_vector_out_of_bounds if
+    /// the row does not exist.
+    //*************************************************************************
+    void erase_unordered(size_t i)
+    {
+      ETL_ASSERT(i < current_size, ETL_ERROR(soa_vector_out_of_bounds));
+
+      if (i != (current_size - 1U))
+      {
+        cols.move_assign(i, current_size - 1U);
+      }
+
+      pop_back();
+    }
+
+    //*************************************************************************
+    /// Swaps two rows.
+    //*************************************************************************
+    void swap_rows(size_t a, size_t b)
+    {
+      if (a != b)
+      {
+        cols.swap_rows(a, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts the rows by the values in column I, in ascending order.
+    /// The sort is not stable.
+    //*************************************************************************
+    template <const size_t I>
+    void sort_by()
+    {
+      sort_by<I>(std::less<typename column_type<I>::type>());
+    }
+
+    //*************************************************************************
+    /// Sorts the rows by the values in column I, using 'compare'.
+    /// The sort is an in place heap sort that swaps whole rows, so it needs
+    /// no extra storage. It is not stable.
+    //*************************************************************************
+    template <const size_t I, typename TCompare>
+    void sort_by(TCompare compare)
+    {
+      const typename column_type<I>::type* keys = data<I>();
+
+      if (current_size < 2U)
+      {
+        return;
+      }
+
+      for (size_t i = current_size / 2U; i > 0U; --i)
+      {
+        sift_down(keys, i - 1U, current_size, compare);
+      }
+
+      for (size_t end = current_size - 1U; end > 0U; --end)
+      {
+        cols.swap_rows(0U, end);
+        sift_down(keys, 0U, end, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Removes all of the rows.
+    //*************************************************************************
+    void clear()
+    {
+      while (current_size > 0U)
+      {
+        --current_size;
+        cols.destroy(current_size);
+      }
+    }
+
+    //*************************************************************************
+    /// The number of rows.
+    //*************************************************************************
+    size_t size() const
+    {
+      return current_size;
+    }
+
+    //*************************************************************************
+    /// The maximum number of rows.
+    //*************************************************************************
+    size_t max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The maximum number of rows.
+    //*************************************************************************
+    size_t capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// The number of rows that can still be added.
+    //*************************************************************************
+    size_t available() const
+    {
+      return MAX_SIZE - current_size;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if there are no rows.
+    //*************************************************************************
+    bool empty() const
+    {
+      return current_size == 0U;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if no more rows can be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return current_size == MAX_SIZE;
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Copies the rows of another vector into this empty one.
+    //*************************************************************************
+    void assign(const soa_vector& other)
+    {
+      while (current_size < other.current_size)
+      {
+        cols.copy_construct(current_size, other.cols);
+        ++current_size;
+      }
+    }
+
+    //*************************************************************************
+    /// Restores the heap below 'root', for the first 'count' rows.
+    //*************************************************************************
+    template <typename TKey, typename TCompare>
+    void sift_down(const TKey* keys, size_t root, size_t count, TCompare& compare)
+    {
+      size_t child = (2U * root) + 1U;
+
+      while (child < count)
+      {
+        if (((child + 1U) < count) && compare(keys[child], keys[child + 1U]))
+        {
+          ++child;
+        }
+
+        if (!compare(keys[root], keys[child]))
+        {
+          return;
+        }
+
+        cols.swap_rows(root, child);
+        root  = child;
+        child = (2U * root) + 1U;
+      }
+    }
+
+    columns_type cols;
+    size_t       current_size;
+  };
+
+  template <const size_t MAX_SIZE_, typename... TTypes>
+  const size_t soa_vector<MAX_SIZE_, TTypes...>::MAX_SIZE;
+
+  template <const size_t MAX_SIZE_, typename... TTypes>
+  const size_t soa_vector<MAX_SIZE_, TTypes...>::COLUMN_COUNT;
+}
+
+#undef ETL_FILE
+
+#endif
+
+#endif
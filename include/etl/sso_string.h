@@ -0,0 +1,448 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_SSO_STRING_INCLUDED
+#define ETL_SSO_STRING_INCLUDED
+
+///\ingroup string
+
+#include "platform.h"
+#include "basic_string.h"
+#include "pool.h"
+#include "arena.h"
+#include "memory.h"
+#include "nullptr.h"
+#include "static_assert.h"
+
+namespace etl
+{
+  //***************************************************************************
+  /// A string that stores short contents inline and moves longer contents to
+  /// a block allocated from a pool or an arena.
+  /// The pool's items must hold at least MAX_SIZE + 1 characters, for example
+  /// etl::pool<etl::basic_sso_string<T, INLINE_SIZE, MAX_SIZE>::block_type, N>
+  /// capacity() is the size of the current buffer. It grows to MAX_SIZE when
+  /// the contents no longer fit inline. If no block is available the string
+  /// is truncated to INLINE_SIZE, as for any full etl::string.
+  /// A pool block is kept until shrink_to_fit() or destruction. An arena
+  /// block is reclaimed when the arena is reset or rolled back.
+  ///\tparam INLINE_SIZE_ The number of characters stored inline.
+  ///\tparam MAX_SIZE_    The maximum number of characters.
+  ///\ingroup string
+  //***************************************************************************
+  template <typename T, const size_t INLINE_SIZE_, const size_t MAX_SIZE_>
+  class basic_sso_string : public etl::ibasic_string<T>
+  {
+  public:
+
+    typedef etl::ibasic_string<T> base_type;
+    typedef etl::ibasic_string<T> interface_type;
+
+    typedef T value_type;
+
+    static const size_t INLINE_SIZE = INLINE_SIZE_;
+    static const size_t MAX_SIZE    = MAX_SIZE_;
+
+    ETL_STATIC_ASSERT(INLINE_SIZE <= MAX_SIZE, "Inline size larger than the maximum size");
+
+    //*************************************************************************
+    /// The spilled storage for a string.
+    //*************************************************************************
+    struct block_type
+    {
+      value_type buffer[MAX_SIZE + 1];
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param pool_ The pool to take a block from when the contents do not fit inline.
+    //*************************************************************************
+    explicit basic_sso_string(etl::ipool& pool_)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(&pool_),
+        p_arena(nullptr),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    ///\param arena_ The arena to take a block from when the contents do not fit inline.
+    //*************************************************************************
+    explicit basic_sso_string(etl::arena& arena_)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(nullptr),
+        p_arena(&arena_),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    /// Uses the same pool or arena as the other string.
+    //*************************************************************************
+    basic_sso_string(const basic_sso_string& other)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(other.p_pool),
+        p_arena(other.p_arena),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// From other string.
+    //*************************************************************************
+    basic_sso_string(etl::ipool& pool_, const interface_type& other)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(&pool_),
+        p_arena(nullptr),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// From other string, using an arena.
+    //*************************************************************************
+    basic_sso_string(etl::arena& arena_, const interface_type& other)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(nullptr),
+        p_arena(&arena_),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->assign(other);
+    }
+
+    //*************************************************************************
+    /// From null terminated text.
+    //*************************************************************************
+    basic_sso_string(etl::ipool& pool_, const value_type* text)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(&pool_),
+        p_arena(nullptr),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// From null terminated text, using an arena.
+    //*************************************************************************
+    basic_sso_string(etl::arena& arena_, const value_type* text)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(nullptr),
+        p_arena(&arena_),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->assign(text);
+    }
+
+    //*************************************************************************
+    /// From text and length.
+    //*************************************************************************
+    basic_sso_string(etl::ipool& pool_, const value_type* text, size_t count)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(&pool_),
+        p_arena(nullptr),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->assign(text, count);
+    }
+
+    //*************************************************************************
+    /// From text and length, using an arena.
+    //*************************************************************************
+    basic_sso_string(etl::arena& arena_, const value_type* text, size_t count)
+      : base_type(inline_buffer, INLINE_SIZE),
+        p_pool(nullptr),
+        p_arena(&arena_),
+        p_block(nullptr)
+    {
+      this->set_grow_function(&basic_sso_string::grow);
+      this->assign(text, count);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    /// Returns a pool block to the pool.
+    //*************************************************************************
+    ~basic_sso_string()
+    {
+      if (p_block != nullptr)
+      {
+        // The base destructor must not touch the released block.
+        this->set_buffer(inline_buffer, INLINE_SIZE);
+        this->current_size = 0;
+        inline_buffer[0]   = 0;
+
+        release_block();
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    basic_sso_string& operator = (const basic_sso_string& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    basic_sso_string& operator = (const interface_type& rhs)
+    {
+      if (&rhs != this)
+      {
+        this->assign(rhs);
+      }
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    basic_sso_string& operator = (const value_type* text)
+    {
+      this->assign(text);
+
+      return *this;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if the contents are stored inline.
+    //*************************************************************************
+    bool is_inline() const
+    {
+      return p_block == nullptr;
+    }
+
+    //*************************************************************************
+    /// Moves the contents back inline and returns a pool block to the pool, if
+    /// the contents fit.
+    //*************************************************************************
+    void shrink_to_fit()
+    {
+      if ((p_block != nullptr) && (this->size() <= INLINE_SIZE))
+      {
+        etl::copy_n(p_block->buffer, this->size() + 1, inline_buffer);
+        this->set_buffer(inline_buffer, INLINE_SIZE);
+        release_block();
+      }
+    }
+
+    //*************************************************************************
+    /// Fix the internal pointers after a low level memory copy.
+    //*************************************************************************
+#ifdef ETL_ISTRING_REPAIR_ENABLE
+    virtual
+#endif
+    void repair()
+    {
+      if (p_block == nullptr)
+      {
+        base_type::repair_buffer(inline_buffer);
+      }
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Moves the contents to a block from the pool or arena.
+    //*************************************************************************
+    static bool grow(base_type& str, size_t new_size)
+    {
+      basic_sso_string& self = static_cast<basic_sso_string&>(str);
+
+      if (self.p_block != nullptr)
+      {
+        return false;
+      }
+
+      self.p_block = self.allocate_block();
+
+      if (self.p_block == nullptr)
+      {
+        return false;
+      }
+
+      etl::copy_n(self.inline_buffer, self.size() + 1, self.p_block->buffer);
+      self.set_buffer(self.p_block->buffer, MAX_SIZE);
+
+      return new_size <= MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// Gets a block, or nullptr if none is available.
+    //*************************************************************************
+    block_type* allocate_block()
+    {
+      if (p_pool != nullptr)
+      {
+        return p_pool->full() ? nullptr : p_pool->allocate<block_type>();
+      }
+      else if (p_arena->can_allocate(sizeof(block_type), etl::alignment_of<block_type>::value))
+      {
+        return static_cast<block_type*>(p_arena->allocate(sizeof(block_type), etl::alignment_of<block_type>::value));
+      }
+      else
+      {
+        return nullptr;
+      }
+    }
+
+    //*************************************************************************
+    /// Returns a pool block to the pool.
+    //*************************************************************************
+    void release_block()
+    {
+      if (p_block != nullptr)
+      {
+        if (this->is_secure())
+        {
+          etl::memory_clear(*p_block);
+        }
+
+        if (p_pool != nullptr)
+        {
+          p_pool->release(p_block);
+        }
+
+        p_block = nullptr;
+      }
+    }
+
+    etl::ipool* p_pool;
+    etl::arena* p_arena;
+    block_type* p_block;
+    value_type  inline_buffer[INLINE_SIZE + 1];
+  };
+
+  template <typename T, const size_t INLINE_SIZE_, const size_t MAX_SIZE_>
+  const size_t basic_sso_string<T, INLINE_SIZE_, MAX_SIZE_>::INLINE_SIZE;
+
+  template <typename T, const size_t INLINE_SIZE_, const size_t MAX_SIZE_>
+  const size_t basic_sso_string<T, INLINE_SIZE_, MAX_SIZE_>::MAX_SIZE;
+
+  //***************************************************************************
+  /// A char string that stores short contents inline and longer contents in
+  /// a block from a pool or an arena.
+  ///\ingroup string
+  //***************************************************************************
+  template <const size_t INLINE_SIZE_, const size_t MAX_SIZE_>
+  class sso_string : public etl::basic_sso_string<char, INLINE_SIZE_, MAX_SIZE_>
+  {
+  public:
+
+    typedef etl::basic_sso_string<char, INLINE_SIZE_, MAX_SIZE_> sso_type;
+
+    explicit sso_string(etl::ipool& pool_)
+      : sso_type(pool_)
+    {
+    }
+
+    sso_string(const sso_string& other)
+      : sso_type(other)
+    {
+    }
+
+    sso_string(etl::ipool& pool_, const etl::ibasic_string<char>& other)
+      : sso_type(pool_, other)
+    {
+    }
+
+    sso_string(etl::ipool& pool_, const char* text)
+      : sso_type(pool_, text)
+    {
+    }
+
+    sso_string(etl::ipool& pool_, const char* text, size_t count)
+      : sso_type(pool_, text, count)
+    {
+    }
+
+    explicit sso_string(etl::arena& arena_)
+      : sso_type(arena_)
+    {
+    }
+
+    sso_string(etl::arena& arena_, const etl::ibasic_string<char>& other)
+      : sso_type(arena_, other)
+    {
+    }
+
+    sso_string(etl::arena& arena_, const char* text)
+      : sso_type(arena_, text)
+    {
+    }
+
+    sso_string(etl::arena& arena_, const char* text, size_t count)
+      : sso_type(arena_, text, count)
+    {
+    }
+
+    sso_string& operator = (const sso_string& rhs)
+    {
+      sso_type::operator =(rhs);
+      return *this;
+    }
+
+    sso_string& operator = (const etl::ibasic_string<char>& rhs)
+    {
+      sso_type::operator =(rhs);
+      return *this;
+    }
+
+    sso_string& operator = (const char* text)
+    {
+      sso_type::operator =(text);
+      return *this;
+    }
+  };
+}
+
+#endif
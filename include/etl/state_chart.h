@@ -35,6 +35,7 @@ SOFTWARE.
 #include "etl/nullptr.h"
 #include "etl/array.h"
 #include "etl/array_view.h"
+#include "etl/stl/algorithm.h"
 
 namespace etl
 {
@@ -156,7 +157,11 @@ namespace etl
       : istate_chart(state_id_),
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
-        started(false)
+        started(false),
+        p_transition_index(nullptr),
+        transition_index_valid(false),
+        number_of_indexed_states(0),
+        number_of_indexed_events(0)
     {
     }
 
@@ -179,7 +184,11 @@ namespace etl
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
         state_table(state_table_begin_, state_table_end_),
-        started(false)
+        started(false),
+        p_transition_index(nullptr),
+        transition_index_valid(false),
+        number_of_indexed_states(0),
+        number_of_indexed_events(0)
     {
     }
 
@@ -192,6 +201,7 @@ namespace etl
                               const transition* transition_table_end_)
     {
       transition_table.assign(transition_table_begin_, transition_table_end_);
+      build_transition_index();
     }
 
     //*************************************************************************
@@ -274,7 +284,7 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = transition_table.begin();
+        const transition* t = find_first_transition(event_id);
 
         // Keep looping until we execute a transition or reach the end of the table.
         while (t != transition_table.end())
@@ -337,8 +347,104 @@ namespace etl
       }
     }
 
+  protected:
+
+    typedef uint16_t transition_index_t;
+
+    //*************************************************************************
+    /// Sets the storage for the transition index and builds it.
+    /// The index holds, for each state/event pair, the position of the first
+    /// matching transition. Ids outside of the index fall back to a linear search.
+    /// \param p_transition_index_      Storage for number_of_states_ * number_of_events_ entries.
+    /// \param number_of_indexed_states_ The number of state ids covered by the index.
+    /// \param number_of_indexed_events_ The number of event ids covered by the index.
+    //*************************************************************************
+    void set_transition_index(transition_index_t* p_transition_index_,
+                              size_t              number_of_indexed_states_,
+                              size_t              number_of_indexed_events_)
+    {
+      p_transition_index       = p_transition_index_;
+      number_of_indexed_states = number_of_indexed_states_;
+      number_of_indexed_events = number_of_indexed_events_;
+
+      build_transition_index();
+    }
+
   private:
 
+    /// Marks an index entry that has no matching transition.
+    static const transition_index_t NO_TRANSITION = 0xFFFFU;
+
+    //*************************************************************************
+    /// Fills the transition index from the transition table.
+    /// The table is walked backwards so that the first match in the table wins.
+    //*************************************************************************
+    void build_transition_index()
+    {
+      // Too many transitions to be represented by the index type?
+      transition_index_valid = (p_transition_index != nullptr) &&
+                               (transition_table.size() < size_t(NO_TRANSITION));
+
+      if (!transition_index_valid)
+      {
+        return;
+      }
+
+      std::fill_n(p_transition_index, number_of_indexed_states * number_of_indexed_events, NO_TRANSITION);
+
+      size_t i = transition_table.size();
+
+      while (i != 0)
+      {
+        --i;
+
+        const transition& t = transition_table[i];
+
+        if (is_indexed(t.event_id, number_of_indexed_events))
+        {
+          if (t.from_any_state)
+          {
+            for (size_t s = 0; s < number_of_indexed_states; ++s)
+            {
+              p_transition_index[(s * number_of_indexed_events) + size_t(t.event_id)] = transition_index_t(i);
+            }
+          }
+          else if (is_indexed(t.current_state_id, number_of_indexed_states))
+          {
+            p_transition_index[(size_t(t.current_state_id) * number_of_indexed_events) + size_t(t.event_id)] = transition_index_t(i);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Finds the first transition for the event in the current state.
+    /// \return A pointer to the transition or the end of the table if none.
+    //*************************************************************************
+    const transition* find_first_transition(const event_id_t event_id) const
+    {
+      if (transition_index_valid &&
+          is_indexed(current_state_id, number_of_indexed_states) &&
+          is_indexed(event_id, number_of_indexed_events))
+      {
+        const transition_index_t i = p_transition_index[(size_t(current_state_id) * number_of_indexed_events) + size_t(event_id)];
+
+        return (i == NO_TRANSITION) ? transition_table.end() : transition_table.begin() + i;
+      }
+      else
+      {
+        return std::find_if(transition_table.begin(),
+                            transition_table.end(),
+                            is_transition(event_id, current_state_id));
+      }
+    }
+
+    //*************************************************************************
+    static bool is_indexed(int id, size_t n)
+    {
+      return (id >= 0) && (size_t(id) < n);
+    }
+
     //*************************************************************************
     struct is_transition
     {
@@ -377,10 +483,75 @@ namespace etl
     state_chart(const state_chart&) ETL_DELETE;
     state_chart& operator =(const state_chart&) ETL_DELETE;
 
-    TObject&                                object;           ///< The object that supplies guard and action member functions.
-    const etl::array_view<const transition> transition_table; ///< The table of transitions.
-    etl::array_view<const state>            state_table;      ///< The table of states.
-    bool                                    started;          ///< Set if the state chart has been started.
+    TObject&                          object;                   ///< The object that supplies guard and action member functions.
+    etl::array_view<const transition> transition_table;         ///< The table of transitions.
+    etl::array_view<const state>      state_table;              ///< The table of states.
+    bool                              started;                  ///< Set if the state chart has been started.
+    transition_index_t*               p_transition_index;       ///< The state/event to first transition index, if supplied.
+    bool                              transition_index_valid;   ///< Set if the index matches the transition table.
+    size_t                            number_of_indexed_states; ///< The number of states covered by the index.
+    size_t                            number_of_indexed_events; ///< The number of events covered by the index.
+  };
+
+  template <typename TObject>
+  const typename state_chart<TObject>::transition_index_t state_chart<TObject>::NO_TRANSITION;
+
+  //***************************************************************************
+  /// Finite State Machine with a constant time transition lookup.
+  /// Transitions for state ids in the range [0, Number_Of_States) and event ids
+  /// in the range [0, Number_Of_Events) are found through a
+  /// Number_Of_States * Number_Of_Events table built at construction.
+  /// Any other ids use the linear search of etl::state_chart.
+  //***************************************************************************
+  template <typename TObject, const size_t Number_Of_States, const size_t Number_Of_Events>
+  class indexed_state_chart : public etl::state_chart<TObject>
+  {
+  public:
+
+    typedef etl::state_chart<TObject>         base_t;
+    typedef typename base_t::transition       transition;
+    typedef typename base_t::state            state;
+    typedef typename base_t::state_id_t       state_id_t;
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    indexed_state_chart(TObject& object_,
+                        const transition* transition_table_begin_,
+                        const transition* transition_table_end_,
+                        const state_id_t state_id_)
+      : base_t(object_, transition_table_begin_, transition_table_end_, state_id_)
+    {
+      this->set_transition_index(transition_index.data(), Number_Of_States, Number_Of_Events);
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_table_begin_      The start of the state table.
+    /// \param state_table_end_        The end of the state table.
+    /// \param state_id_               The initial state id.
+    //*************************************************************************
+    indexed_state_chart(TObject& object_,
+                        const transition* transition_table_begin_,
+                        const transition* transition_table_end_,
+                        const state* state_table_begin_,
+                        const state* state_table_end_,
+                        const state_id_t state_id_)
+      : base_t(object_, transition_table_begin_, transition_table_end_, state_table_begin_, state_table_end_, state_id_)
+    {
+      this->set_transition_index(transition_index.data(), Number_Of_States, Number_Of_Events);
+    }
+
+  private:
+
+    etl::array<typename base_t::transition_index_t, Number_Of_States * Number_Of_Events> transition_index;
   };
 }
 
@@ -0,0 +1,548 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STATE_CHART_POOL_INCLUDED
+#define ETL_STATE_CHART_POOL_INCLUDED
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "platform.h"
+#include "nullptr.h"
+#include "array.h"
+#include "array_view.h"
+#include "smallest.h"
+#include "state_chart.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#include "stl/algorithm.h"
+
+#undef ETL_FILE
+#define ETL_FILE "54"
+
+namespace etl
+{
+  //***************************************************************************
+  /// Base exception class for state_chart_pool.
+  //***************************************************************************
+  class state_chart_pool_exception : public etl::exception
+  {
+  public:
+
+    state_chart_pool_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for a state or event id outside of the range of the pool.
+  //***************************************************************************
+  class state_chart_pool_id_exception : public etl::state_chart_pool_exception
+  {
+  public:
+
+    state_chart_pool_id_exception(string_type file_name_, numeric_type line_number_)
+      : etl::state_chart_pool_exception(ETL_ERROR_TEXT("state_chart_pool:id", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Exception for an instance index outside of the pool.
+  //***************************************************************************
+  class state_chart_pool_instance_exception : public etl::state_chart_pool_exception
+  {
+  public:
+
+    state_chart_pool_instance_exception(string_type file_name_, numeric_type line_number_)
+      : etl::state_chart_pool_exception(ETL_ERROR_TEXT("state_chart_pool:instance", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A pool of identical state charts sharing one transition and state table.
+  /// The current state of every instance is stored in one contiguous array
+  /// and transitions are found through a state/event index, so processing an
+  /// event is a table lookup followed by the guard, action and entry/exit calls.
+  /// Guards, actions and entry/exit functions receive the index of the instance.
+  /// State ids must be in the range [0, Number_Of_States) and event ids in the
+  /// range [0, Number_Of_Events).
+  //***************************************************************************
+  template <typename TObject, const size_t Size, const size_t Number_Of_States, const size_t Number_Of_Events>
+  class state_chart_pool
+  {
+  public:
+
+    typedef istate_chart::state_id_t state_id_t;
+    typedef istate_chart::event_id_t event_id_t;
+
+    /// The type used to hold the state of each instance.
+    typedef typename etl::smallest_uint_for_value<Number_Of_States>::type packed_state_id_t;
+
+    static const size_t SIZE             = Size;
+    static const size_t NUMBER_OF_STATES = Number_Of_States;
+    static const size_t NUMBER_OF_EVENTS = Number_Of_Events;
+
+    //*************************************************************************
+    /// Transition definition
+    //*************************************************************************
+    struct transition
+    {
+      transition(const state_id_t current_state_id_,
+                 const event_id_t event_id_,
+                 const state_id_t next_state_id_,
+                 void (TObject::* const action_)(size_t) = nullptr,
+                 bool (TObject::* const guard_)(size_t)  = nullptr)
+        : from_any_state(false),
+          current_state_id(current_state_id_),
+          event_id(event_id_),
+          next_state_id(next_state_id_),
+          action(action_),
+          guard(guard_)
+      {
+      }
+
+      transition(const event_id_t event_id_,
+                 const state_id_t next_state_id_,
+                 void (TObject::* const action_)(size_t) = nullptr,
+                 bool (TObject::* const guard_)(size_t)  = nullptr)
+        : from_any_state(true),
+          current_state_id(0),
+          event_id(event_id_),
+          next_state_id(next_state_id_),
+          action(action_),
+          guard(guard_)
+      {
+      }
+
+      const bool       from_any_state;
+      const state_id_t current_state_id;
+      const event_id_t event_id;
+      const state_id_t next_state_id;
+      void (TObject::* const action)(size_t);
+      bool (TObject::* const guard)(size_t);
+    };
+
+    //*************************************************************************
+    /// State definition
+    //*************************************************************************
+    struct state
+    {
+      state(const state_id_t state_id_,
+            void (TObject::* const on_entry_)(size_t) = nullptr,
+            void (TObject::* const on_exit_)(size_t)  = nullptr)
+        : state_id(state_id_),
+          on_entry(on_entry_),
+          on_exit(on_exit_)
+      {
+      }
+
+      state_id_t state_id;
+      void (TObject::* const on_entry)(size_t);
+      void (TObject::* const on_exit)(size_t);
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_id_               The initial state id of every instance.
+    //*************************************************************************
+    state_chart_pool(TObject& object_,
+                     const transition* transition_table_begin_,
+                     const transition* transition_table_end_,
+                     const state_id_t state_id_)
+      : object(object_),
+        transition_table(transition_table_begin_, transition_table_end_),
+        started(false)
+    {
+      build_transition_index();
+      build_state_index();
+      reset(state_id_);
+    }
+
+    //*************************************************************************
+    /// Constructor.
+    /// \param object_                 A reference to the implementation object.
+    /// \param transition_table_begin_ The start of the table of transitions.
+    /// \param transition_table_end_   The end of the table of transitions.
+    /// \param state_table_begin_      The start of the state table.
+    /// \param state_table_end_        The end of the state table.
+    /// \param state_id_               The initial state id of every instance.
+    //*************************************************************************
+    state_chart_pool(TObject& object_,
+                     const transition* transition_table_begin_,
+                     const transition* transition_table_end_,
+                     const state* state_table_begin_,
+                     const state* state_table_end_,
+                     const state_id_t state_id_)
+      : object(object_),
+        transition_table(transition_table_begin_, transition_table_end_),
+        state_table(state_table_begin_, state_table_end_),
+        started(false)
+    {
+      build_transition_index();
+      build_state_index();
+      reset(state_id_);
+    }
+
+    //*************************************************************************
+    /// Sets every instance to the specified state and clears the started flag.
+    /// No entry or exit functions are called.
+    /// \param state_id_ The state id to set.
+    //*************************************************************************
+    void reset(const state_id_t state_id_)
+    {
+      ETL_ASSERT(is_valid_state(state_id_), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+      std::fill_n(state_ids.begin(), Size, packed_state_id_t(state_id_));
+      started = false;
+    }
+
+    //*************************************************************************
+    /// Starts all of the instances.
+    /// \param on_entry_initial Call the 'on_entry' function of the initial state of each instance.
+    //*************************************************************************
+    void start(const bool on_entry_initial = true)
+    {
+      if (!started)
+      {
+        if (on_entry_initial)
+        {
+          for (size_t id = 0; id < Size; ++id)
+          {
+            const state* s = state_index[state_ids[id]];
+
+            if ((s != nullptr) && (s->on_entry != nullptr))
+            {
+              (object.*(s->on_entry))(id);
+            }
+          }
+        }
+
+        started = true;
+      }
+    }
+
+    //*************************************************************************
+    /// Gets the current state id of an instance.
+    /// \param id The index of the instance.
+    /// \return The current state id.
+    //*************************************************************************
+    state_id_t get_state_id(const size_t id) const
+    {
+      ETL_ASSERT(id < Size, ETL_ERROR(etl::state_chart_pool_instance_exception));
+
+      return state_id_t(state_ids[id]);
+    }
+
+    //*************************************************************************
+    /// Gets the array of current states, one per instance.
+    //*************************************************************************
+    const packed_state_id_t* state_ids_data() const
+    {
+      return state_ids.data();
+    }
+
+    //*************************************************************************
+    /// Counts the number of instances in the specified state.
+    //*************************************************************************
+    size_t count(const state_id_t state_id_) const
+    {
+      return std::count(state_ids.begin(), state_ids.end(), packed_state_id_t(state_id_));
+    }
+
+    //*************************************************************************
+    /// Gets a reference to the implementation object.
+    //*************************************************************************
+    TObject& get_object()
+    {
+      return object;
+    }
+
+    //*************************************************************************
+    /// Gets a const reference to the implementation object.
+    //*************************************************************************
+    const TObject& get_object() const
+    {
+      return object;
+    }
+
+    //*************************************************************************
+    /// Gets the number of instances.
+    //*************************************************************************
+    size_t size() const
+    {
+      return Size;
+    }
+
+    //*************************************************************************
+    /// Processes an event for one instance.
+    /// As with etl::state_chart, the <b>first</b> matching transition whose
+    /// guard passes is actioned.
+    /// \param id       The index of the instance.
+    /// \param event_id The id of the event to process.
+    //*************************************************************************
+    void process_event(const size_t id, const event_id_t event_id)
+    {
+      ETL_ASSERT(id < Size, ETL_ERROR(etl::state_chart_pool_instance_exception));
+      ETL_ASSERT(is_valid_event(event_id), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+      if (started)
+      {
+        process(id, event_id);
+      }
+    }
+
+    //*************************************************************************
+    /// Processes a batch of events.
+    /// ids[i] receives events[i]. Events are processed in the order given, so
+    /// an instance that appears more than once sees its events in sequence.
+    /// \param ids    The indexes of the instances.
+    /// \param events The ids of the events.
+    /// \param count  The number of entries in each array.
+    //*************************************************************************
+    void process_event_batch(const size_t* ids, const event_id_t* events, const size_t count)
+    {
+      if (started)
+      {
+        for (size_t i = 0; i < count; ++i)
+        {
+          ETL_ASSERT(ids[i] < Size, ETL_ERROR(etl::state_chart_pool_instance_exception));
+          ETL_ASSERT(is_valid_event(events[i]), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+          process(ids[i], events[i]);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Processes an event for every instance.
+    /// The column of the index for the event is loaded once, and instances in
+    /// states that have no transition for the event are skipped by a single
+    /// table lookup.
+    /// \param event_id The id of the event to process.
+    //*************************************************************************
+    void process_event_all(const event_id_t event_id)
+    {
+      ETL_ASSERT(is_valid_event(event_id), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+      if (started)
+      {
+        transition_index_t first[Number_Of_States];
+
+        for (size_t s = 0; s < Number_Of_States; ++s)
+        {
+          first[s] = transition_index[(s * Number_Of_Events) + size_t(event_id)];
+        }
+
+        for (size_t id = 0; id < Size; ++id)
+        {
+          const transition_index_t i = first[state_ids[id]];
+
+          if (i != NO_TRANSITION)
+          {
+            process_from(id, event_id, i);
+          }
+        }
+      }
+    }
+
+  private:
+
+    typedef uint16_t transition_index_t;
+
+    /// Marks an index entry that has no matching transition.
+    static const transition_index_t NO_TRANSITION = 0xFFFFU;
+
+    //*************************************************************************
+    static bool is_valid_state(int id)
+    {
+      return (id >= 0) && (size_t(id) < Number_Of_States);
+    }
+
+    //*************************************************************************
+    static bool is_valid_event(int id)
+    {
+      return (id >= 0) && (size_t(id) < Number_Of_Events);
+    }
+
+    //*************************************************************************
+    /// Fills the transition index from the transition table.
+    /// The table is walked backwards so that the first match in the table wins.
+    //*************************************************************************
+    void build_transition_index()
+    {
+      ETL_ASSERT(transition_table.size() < size_t(NO_TRANSITION), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+      std::fill_n(transition_index.begin(), transition_index.size(), transition_index_t(NO_TRANSITION));
+
+      size_t i = transition_table.size();
+
+      while (i != 0)
+      {
+        --i;
+
+        const transition& t = transition_table[i];
+
+        ETL_ASSERT(is_valid_event(t.event_id), ETL_ERROR(etl::state_chart_pool_id_exception));
+        ETL_ASSERT(is_valid_state(t.next_state_id), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+        if (t.from_any_state)
+        {
+          for (size_t s = 0; s < Number_Of_States; ++s)
+          {
+            transition_index[(s * Number_Of_Events) + size_t(t.event_id)] = transition_index_t(i);
+          }
+        }
+        else
+        {
+          ETL_ASSERT(is_valid_state(t.current_state_id), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+          transition_index[(size_t(t.current_state_id) * Number_Of_Events) + size_t(t.event_id)] = transition_index_t(i);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Maps each state id to its entry in the state table, if any.
+    //*************************************************************************
+    void build_state_index()
+    {
+      std::fill_n(state_index.begin(), state_index.size(), static_cast<const state*>(nullptr));
+
+      // Walk backwards so that the first entry for a state id wins, as for etl::state_chart.
+      size_t i = state_table.size();
+
+      while (i != 0)
+      {
+        --i;
+
+        const state& s = state_table[i];
+
+        ETL_ASSERT(is_valid_state(s.state_id), ETL_ERROR(etl::state_chart_pool_id_exception));
+
+        state_index[s.state_id] = &s;
+      }
+    }
+
+    //*************************************************************************
+    /// Processes an event for one instance.
+    //*************************************************************************
+    void process(const size_t id, const event_id_t event_id)
+    {
+      const transition_index_t i = transition_index[(size_t(state_ids[id]) * Number_Of_Events) + size_t(event_id)];
+
+      if (i != NO_TRANSITION)
+      {
+        process_from(id, event_id, i);
+      }
+    }
+
+    //*************************************************************************
+    /// Processes an event for one instance, starting from the first matching transition.
+    //*************************************************************************
+    void process_from(const size_t id, const event_id_t event_id, transition_index_t i)
+    {
+      const state_id_t current_state_id = state_ids[id];
+
+      const transition* t   = transition_table.begin() + i;
+      const transition* end = transition_table.end();
+
+      // Keep looping until we execute a transition or reach the end of the table.
+      while (t != end)
+      {
+        // Shall we execute the transition?
+        if ((t->guard == nullptr) || ((object.*t->guard)(id)))
+        {
+          const state_id_t next_state_id = t->next_state_id;
+
+          // Shall we execute the action?
+          if (t->action != nullptr)
+          {
+            (object.*t->action)(id);
+          }
+
+          // Changing state?
+          if (current_state_id != next_state_id)
+          {
+            const state* s = state_index[current_state_id];
+
+            // If the current state has an 'on_exit' then call it.
+            if ((s != nullptr) && (s->on_exit != nullptr))
+            {
+              (object.*(s->on_exit))(id);
+            }
+
+            state_ids[id] = packed_state_id_t(next_state_id);
+
+            s = state_index[next_state_id];
+
+            // If the new state has an 'on_entry' then call it.
+            if ((s != nullptr) && (s->on_entry != nullptr))
+            {
+              (object.*(s->on_entry))(id);
+            }
+          }
+
+          t = end;
+        }
+        else
+        {
+          // The guard failed, so search for the next match in the table.
+          ++t;
+
+          while ((t != end) && !((t->event_id == event_id) && (t->from_any_state || (t->current_state_id == current_state_id))))
+          {
+            ++t;
+          }
+        }
+      }
+    }
+
+    // Disabled
+    state_chart_pool(const state_chart_pool&) ETL_DELETE;
+    state_chart_pool& operator =(const state_chart_pool&) ETL_DELETE;
+
+    TObject&                                                             object;           ///< The object that supplies guard and action member functions.
+    const etl::array_view<const transition>                              transition_table; ///< The table of transitions.
+    const etl::array_view<const state>                                   state_table;      ///< The table of states.
+    etl::array<transition_index_t, Number_Of_States * Number_Of_Events>  transition_index; ///< The state/event to first transition index.
+    etl::array<const state*, Number_Of_States>                           state_index;      ///< The state id to state table entry index.
+    etl::array<packed_state_id_t, Size>                                  state_ids;        ///< The current state of each instance.
+    bool                                                                 started;          ///< Set if the pool has been started.
+  };
+}
+
+#undef ETL_FILE
+
+#endif
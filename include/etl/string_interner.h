@@ -0,0 +1,495 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_INTERNER_INCLUDED
+#define ETL_STRING_INTERNER_INCLUDED
+
+///\ingroup string
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "platform.h"
+#include "string_view.h"
+#include "hash.h"
+#include "power.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "58"
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup string
+  /// Exception base for string interners.
+  //***************************************************************************
+  class string_interner_exception : public etl::exception
+  {
+  public:
+
+    string_interner_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// No room for the string exception.
+  //***************************************************************************
+  class string_interner_full : public etl::string_interner_exception
+  {
+  public:
+
+    string_interner_full(string_type file_name_, numeric_type line_number_)
+      : string_interner_exception(ETL_ERROR_TEXT("string_interner:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// Invalid handle exception.
+  //***************************************************************************
+  class string_interner_invalid_handle : public etl::string_interner_exception
+  {
+  public:
+
+    string_interner_invalid_handle(string_type file_name_, numeric_type line_number_)
+      : string_interner_exception(ETL_ERROR_TEXT("string_interner:invalid handle", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A handle to an interned string.
+  /// Equal strings in the same interner have equal handles, so handles may be
+  /// compared instead of the text.
+  /// The ordering of handles is the order in which the strings were interned.
+  //***************************************************************************
+  class intern_handle
+  {
+  public:
+
+    static const uint32_t INVALID = 0xFFFFFFFFUL;
+
+    //*************************************************************************
+    /// Constructs an invalid handle.
+    //*************************************************************************
+    ETL_CONSTEXPR intern_handle()
+      : id(INVALID)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructs from an id.
+    //*************************************************************************
+    ETL_CONSTEXPR explicit intern_handle(uint32_t id_)
+      : id(id_)
+    {
+    }
+
+    //*************************************************************************
+    /// Gets the id.
+    //*************************************************************************
+    ETL_CONSTEXPR uint32_t get() const
+    {
+      return id;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if the handle refers to a string.
+    //*************************************************************************
+    ETL_CONSTEXPR bool is_valid() const
+    {
+      return id != INVALID;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator ==(const intern_handle& lhs, const intern_handle& rhs)
+    {
+      return lhs.id == rhs.id;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator !=(const intern_handle& lhs, const intern_handle& rhs)
+    {
+      return lhs.id != rhs.id;
+    }
+
+    //*************************************************************************
+    friend ETL_CONSTEXPR bool operator <(const intern_handle& lhs, const intern_handle& rhs)
+    {
+      return lhs.id < rhs.id;
+    }
+
+  private:
+
+    uint32_t id;
+  };
+
+  //***************************************************************************
+  /// Hash function for intern_handle.
+  //***************************************************************************
+  template <>
+  struct hash<etl::intern_handle>
+  {
+    size_t operator ()(const etl::intern_handle& handle) const
+    {
+      return etl::hash<uint32_t>()(handle.get());
+    }
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A string interning table.
+  /// Each distinct string is stored once, null terminated, in an append only
+  /// arena and is identified by a 32 bit handle.
+  /// The strings are found by an open addressing index keyed by etl::hash.
+  /// Strings cannot be removed individually; clear() removes all of them.
+  //***************************************************************************
+  template <typename T>
+  class ibasic_string_interner
+  {
+  public:
+
+    typedef T                         value_type;
+    typedef size_t                    size_type;
+    typedef etl::basic_string_view<T> view_type;
+
+    //*************************************************************************
+    /// Interns the string.
+    ///\return The handle of the string, or an invalid handle if there was no room.
+    //*************************************************************************
+    etl::intern_handle intern(const view_type& text)
+    {
+      const size_t hash_value = etl::hash<view_type>()(text);
+      const size_t slot       = lookup(text, hash_value);
+
+      if (p_index[slot] != EMPTY)
+      {
+        return etl::intern_handle(p_index[slot]);
+      }
+
+      const bool has_room = (n_strings != MAX_STRINGS) && ((ARENA_SIZE - arena_used) > text.size());
+
+      ETL_ASSERT(has_room, ETL_ERROR(string_interner_full));
+
+      if (!has_room)
+      {
+        return etl::intern_handle();
+      }
+
+      entry& e = p_entries[n_strings];
+      e.offset = uint32_t(arena_used);
+      e.length = uint32_t(text.size());
+      e.hash   = uint32_t(hash_value);
+
+      memcpy(p_arena + arena_used, text.data(), text.size() * sizeof(T));
+      arena_used += text.size();
+      p_arena[arena_used++] = T(0);
+
+      p_index[slot] = uint32_t(n_strings);
+
+      return etl::intern_handle(uint32_t(n_strings++));
+    }
+
+    //*************************************************************************
+    /// Interns the null terminated string.
+    //*************************************************************************
+    etl::intern_handle intern(const T* text)
+    {
+      return intern(view_type(text));
+    }
+
+    //*************************************************************************
+    /// Finds the string without interning it.
+    ///\return The handle of the string, or an invalid handle if not found.
+    //*************************************************************************
+    etl::intern_handle find(const view_type& text) const
+    {
+      const size_t slot = lookup(text, etl::hash<view_type>()(text));
+
+      return (p_index[slot] != EMPTY) ? etl::intern_handle(p_index[slot]) : etl::intern_handle();
+    }
+
+    //*************************************************************************
+    /// Finds the null terminated string without interning it.
+    //*************************************************************************
+    etl::intern_handle find(const T* text) const
+    {
+      return find(view_type(text));
+    }
+
+    //*************************************************************************
+    /// Gets a view of the interned string.
+    //*************************************************************************
+    view_type view(etl::intern_handle handle) const
+    {
+      ETL_ASSERT(handle.get() < n_strings, ETL_ERROR(string_interner_invalid_handle));
+
+      const entry& e = p_entries[handle.get()];
+
+      return view_type(p_arena + e.offset, size_t(e.length));
+    }
+
+    //*************************************************************************
+    /// Gets a pointer to the null terminated interned string.
+    //*************************************************************************
+    const T* c_str(etl::intern_handle handle) const
+    {
+      ETL_ASSERT(handle.get() < n_strings, ETL_ERROR(string_interner_invalid_handle));
+
+      return p_arena + p_entries[handle.get()].offset;
+    }
+
+    //*************************************************************************
+    /// Removes all of the strings.
+    /// All handles become invalid.
+    //*************************************************************************
+    void clear()
+    {
+      for (size_t i = 0U; i < INDEX_SIZE; ++i)
+      {
+        p_index[i] = EMPTY;
+      }
+
+      n_strings  = 0U;
+      arena_used = 0U;
+    }
+
+    //*************************************************************************
+    /// The number of interned strings.
+    //*************************************************************************
+    size_type size() const
+    {
+      return n_strings;
+    }
+
+    //*************************************************************************
+    /// The maximum number of interned strings.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_STRINGS;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if there are no strings.
+    //*************************************************************************
+    bool empty() const
+    {
+      return n_strings == 0U;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if no more strings may be added.
+    //*************************************************************************
+    bool full() const
+    {
+      return n_strings == MAX_STRINGS;
+    }
+
+    //*************************************************************************
+    /// The number of characters free in the arena.
+    /// Each string uses one more than its length for the terminator.
+    //*************************************************************************
+    size_type arena_available() const
+    {
+      return ARENA_SIZE - arena_used;
+    }
+
+  protected:
+
+    static const uint32_t EMPTY = etl::intern_handle::INVALID;
+
+    //*************************************************************************
+    /// The location and hash of an interned string.
+    //*************************************************************************
+    struct entry
+    {
+      uint32_t offset;
+      uint32_t length;
+      uint32_t hash;
+    };
+
+    //*************************************************************************
+    /// Constructor.
+    /// index_size_ must be a power of 2 and larger than max_strings_.
+    //*************************************************************************
+    ibasic_string_interner(entry* p_entries_, size_t max_strings_, uint32_t* p_index_, size_t index_size_, T* p_arena_, size_t arena_size_)
+      : p_entries(p_entries_),
+        MAX_STRINGS(max_strings_),
+        p_index(p_index_),
+        INDEX_SIZE(index_size_),
+        p_arena(p_arena_),
+        ARENA_SIZE(arena_size_),
+        n_strings(0U),
+        arena_used(0U)
+    {
+      clear();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Finds the index slot that holds the string, or the empty slot where
+    /// it would be inserted.
+    //*************************************************************************
+    size_t lookup(const view_type& text, size_t hash_value) const
+    {
+      const size_t mask = INDEX_SIZE - 1U;
+      size_t       slot = hash_value & mask;
+
+      // The index is never full, so an empty slot will be found.
+      while (p_index[slot] != EMPTY)
+      {
+        const entry& e = p_entries[p_index[slot]];
+
+        if ((e.hash == uint32_t(hash_value)) &&
+            (e.length == text.size()) &&
+            (memcmp(p_arena + e.offset, text.data(), text.size() * sizeof(T)) == 0))
+        {
+          break;
+        }
+
+        slot = (slot + 1U) & mask;
+      }
+
+      return slot;
+    }
+
+    // Disabled
+    ibasic_string_interner(const ibasic_string_interner&);
+    ibasic_string_interner& operator =(const ibasic_string_interner&);
+
+    entry* const    p_entries;
+    const size_t    MAX_STRINGS;
+    uint32_t* const p_index;
+    const size_t    INDEX_SIZE;
+    T* const        p_arena;
+    const size_t    ARENA_SIZE;
+    size_t          n_strings;
+    size_t          arena_used;
+  };
+
+  template <typename T>
+  const uint32_t ibasic_string_interner<T>::EMPTY;
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A string interning table with storage.
+  ///\tparam MAX_STRINGS_ The maximum number of distinct strings.
+  ///\tparam ARENA_SIZE_  The number of characters for the strings and their terminators.
+  //***************************************************************************
+  template <typename T, const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  class basic_string_interner : public etl::ibasic_string_interner<T>
+  {
+  public:
+
+    static const size_t MAX_STRINGS = MAX_STRINGS_;
+    static const size_t ARENA_SIZE  = ARENA_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    basic_string_interner()
+      : etl::ibasic_string_interner<T>(entries, MAX_STRINGS, index, INDEX_SIZE, arena, ARENA_SIZE)
+    {
+    }
+
+  private:
+
+    // At most half full, to keep the probe sequences short.
+    static const size_t INDEX_SIZE = etl::power_of_2_round_up<MAX_STRINGS * 2>::value;
+
+    typename etl::ibasic_string_interner<T>::entry entries[MAX_STRINGS];
+    uint32_t index[INDEX_SIZE];
+    T        arena[ARENA_SIZE];
+  };
+
+  template <typename T, const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  const size_t basic_string_interner<T, MAX_STRINGS_, ARENA_SIZE_>::MAX_STRINGS;
+
+  template <typename T, const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  const size_t basic_string_interner<T, MAX_STRINGS_, ARENA_SIZE_>::ARENA_SIZE;
+
+  template <typename T, const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  const size_t basic_string_interner<T, MAX_STRINGS_, ARENA_SIZE_>::INDEX_SIZE;
+
+  typedef etl::ibasic_string_interner<char>     istring_interner;
+  typedef etl::ibasic_string_interner<wchar_t>  iwstring_interner;
+  typedef etl::ibasic_string_interner<char16_t> iu16string_interner;
+  typedef etl::ibasic_string_interner<char32_t> iu32string_interner;
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A string interning table for char.
+  //***************************************************************************
+  template <const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  class string_interner : public etl::basic_string_interner<char, MAX_STRINGS_, ARENA_SIZE_>
+  {
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A string interning table for wchar_t.
+  //***************************************************************************
+  template <const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  class wstring_interner : public etl::basic_string_interner<wchar_t, MAX_STRINGS_, ARENA_SIZE_>
+  {
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A string interning table for char16_t.
+  //***************************************************************************
+  template <const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  class u16string_interner : public etl::basic_string_interner<char16_t, MAX_STRINGS_, ARENA_SIZE_>
+  {
+  };
+
+  //***************************************************************************
+  ///\ingroup string
+  /// A string interning table for char32_t.
+  //***************************************************************************
+  template <const size_t MAX_STRINGS_, const size_t ARENA_SIZE_>
+  class u32string_interner : public etl::basic_string_interner<char32_t, MAX_STRINGS_, ARENA_SIZE_>
+  {
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -40,6 +40,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "hash.h"
 #include "basic_string.h"
+#include "private/string_search.h"
 
 #include "algorithm.h"
 
@@ -495,7 +496,7 @@ namespace etl
         return npos;
       }
 
-      const_iterator iposition = std::search(begin() + position, end(), view.begin(), view.end());
+      const_iterator iposition = etl::private_string_search::find_substring(begin() + position, end(), view.data(), view.size());
 
       if (iposition == end())
       {
@@ -569,21 +570,13 @@ namespace etl
     //*************************************************************************
     size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
+        const_iterator i = etl::private_string_search::find_first_of(begin() + position, end(), view.data(), view.size(), true);
+
+        if (i != end())
         {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
+          return std::distance(begin(), i);
         }
       }
 
@@ -617,25 +610,17 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_iterator last = begin() + position + 1;
+      const_iterator i    = etl::private_string_search::find_last_of(begin(), last, view.data(), view.size(), true);
 
-      while (it != rend())
+      if (i == last)
       {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
+        return npos;
+      }
+      else
+      {
+        return size_type(std::distance(begin(), i));
       }
-
-      return npos;
     }
 
     size_type find_last_of(T c, size_type position = npos) const
@@ -658,28 +643,13 @@ namespace etl
     //*************************************************************************
     size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
+      if (position < size())
       {
-        for (size_t i = position; i < lengthtext; ++i)
+        const_iterator i = etl::private_string_search::find_first_of(begin() + position, end(), view.data(), view.size(), false);
+
+        if (i != end())
         {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
+          return std::distance(begin(), i);
         }
       }
 
@@ -713,32 +683,17 @@ namespace etl
 
       position = std::min(position, size() - 1);
 
-      const_reverse_iterator it = rbegin() + size() - position - 1;
+      const_iterator last = begin() + position + 1;
+      const_iterator i    = etl::private_string_search::find_last_of(begin(), last, view.data(), view.size(), false);
 
-      while (it != rend())
+      if (i == last)
       {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
+        return npos;
+      }
+      else
+      {
+        return size_type(std::distance(begin(), i));
       }
-
-      return npos;
     }
 
     size_type find_last_not_of(T c, size_type position = npos) const
@@ -30,8 +30,10 @@ SOFTWARE.
 #define ETL_TASK_INCLUDED
 
 #include <stdint.h>
+#include <stddef.h>
 
 #include "platform.h"
+#include "nullptr.h"
 #include "error_handler.h"
 #include "exception.h"
 
@@ -55,6 +57,8 @@ namespace etl
 
   typedef uint_least8_t task_priority_t;
 
+  class task_statistics;
+
   //***************************************************************************
   /// Scheduler.
   //***************************************************************************
@@ -67,7 +71,9 @@ namespace etl
     //*******************************************
     task(task_priority_t priority)
       : task_running(true),
-        task_priority(priority)
+        task_priority(priority),
+        task_id(NO_TASK_ID),
+        p_task_statistics(nullptr)
     {
     }
 
@@ -114,10 +120,50 @@ namespace etl
       return task_priority;
     }
 
+    //*******************************************
+    /// Set the id of the task.
+    /// Called by schedulers that identify tasks by index.
+    //*******************************************
+    void set_task_id(size_t task_id_)
+    {
+      task_id = task_id_;
+    }
+
+    //*******************************************
+    /// Get the id of the task.
+    /// Returns NO_TASK_ID if no id has been set.
+    //*******************************************
+    size_t get_task_id() const
+    {
+      return task_id;
+    }
+
+    //*******************************************
+    /// Attach statistics to the task.
+    /// The scheduler records timings for tasks that have statistics.
+    /// Pass nullptr to detach.
+    //*******************************************
+    void set_task_statistics(etl::task_statistics* p_task_statistics_)
+    {
+      p_task_statistics = p_task_statistics_;
+    }
+
+    //*******************************************
+    /// Get the statistics for the task, if any.
+    //*******************************************
+    etl::task_statistics* get_task_statistics() const
+    {
+      return p_task_statistics;
+    }
+
+    static const size_t NO_TASK_ID = ~size_t(0);
+
   private:
 
     bool task_running;
     etl::task_priority_t task_priority;
+    size_t task_id;
+    etl::task_statistics* p_task_statistics;
   };
 }
 
@@ -0,0 +1,275 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TASK_STATISTICS_INCLUDED
+#define ETL_TASK_STATISTICS_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "nullptr.h"
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  //***************************************************************************
+  /// A copy of the statistics of a task.
+  /// Histogram bucket 0 counts times of 0 ticks, bucket 'n' counts times in the
+  /// range [2^(n-1), 2^n) ticks and the last bucket counts everything larger.
+  //***************************************************************************
+  struct task_statistics_snapshot
+  {
+    static const size_t NUMBER_OF_BUCKETS = 16U;
+
+    uint32_t invocations;                           ///< The number of calls to task_process_work.
+    uint64_t total_run_time;                        ///< The cumulative time spent in task_process_work.
+    uint32_t max_run_time;                          ///< The longest call to task_process_work.
+    uint32_t max_latency;                           ///< The longest time from work available to run.
+    uint32_t run_time_histogram[NUMBER_OF_BUCKETS]; ///< Histogram of task_process_work times.
+    uint32_t latency_histogram[NUMBER_OF_BUCKETS];  ///< Histogram of work available to run times.
+  };
+
+  //***************************************************************************
+  /// Run time and latency statistics for a task.
+  /// Attach to a task with etl::task::set_task_statistics.
+  /// The scheduler records when work was first seen to be available and how
+  /// long each call to task_process_work took, using the supplied clock.
+  /// The clock may count in any unit and is allowed to wrap.
+  /// snapshot() may be called from any thread while the scheduler is running.
+  //***************************************************************************
+  class task_statistics
+  {
+  public:
+
+    typedef uint32_t (*clock_function_t)();
+
+    static const size_t NUMBER_OF_BUCKETS = task_statistics_snapshot::NUMBER_OF_BUCKETS;
+
+    //*******************************************
+    /// Constructor.
+    /// \param clock_ The function that returns the current time.
+    //*******************************************
+    task_statistics(clock_function_t clock_)
+      : clock(clock_),
+        sequence(0),
+        available_time(0),
+        start_time(0),
+        run_available_time(0)
+    {
+      clear();
+    }
+
+    //*******************************************
+    /// Clears the statistics.
+    /// Must not be called while the task is running.
+    //*******************************************
+    void clear()
+    {
+      begin_write();
+
+      invocations.store(0, etl::memory_order_release);
+      total_run_time_low.store(0, etl::memory_order_release);
+      total_run_time_high.store(0, etl::memory_order_release);
+      max_run_time.store(0, etl::memory_order_release);
+      max_latency.store(0, etl::memory_order_release);
+
+      for (size_t i = 0; i < NUMBER_OF_BUCKETS; ++i)
+      {
+        run_time_histogram[i].store(0, etl::memory_order_release);
+        latency_histogram[i].store(0, etl::memory_order_release);
+      }
+
+      end_write();
+
+      available_time.store(0);
+    }
+
+    //*******************************************
+    /// Copies a consistent set of statistics.
+    /// Retries if the scheduler updates them during the copy.
+    //*******************************************
+    void snapshot(task_statistics_snapshot& s) const
+    {
+      uint32_t before;
+      uint32_t after;
+
+      do
+      {
+        before = sequence.load(etl::memory_order_acquire);
+
+        s.invocations    = invocations.load(etl::memory_order_acquire);
+        s.total_run_time = (uint64_t(total_run_time_high.load(etl::memory_order_acquire)) << 32U) |
+                            uint64_t(total_run_time_low.load(etl::memory_order_acquire));
+        s.max_run_time   = max_run_time.load(etl::memory_order_acquire);
+        s.max_latency    = max_latency.load(etl::memory_order_acquire);
+
+        for (size_t i = 0; i < NUMBER_OF_BUCKETS; ++i)
+        {
+          s.run_time_histogram[i] = run_time_histogram[i].load(etl::memory_order_acquire);
+          s.latency_histogram[i]  = latency_histogram[i].load(etl::memory_order_acquire);
+        }
+
+        after = sequence.load(etl::memory_order_acquire);
+      } while ((before != after) || ((before & 1U) != 0U));
+    }
+
+    //*******************************************
+    /// Records that the task has work.
+    /// Only the first call since the last run is recorded.
+    /// May be called from any thread.
+    //*******************************************
+    void work_available()
+    {
+      uint32_t expected = 0;
+
+      // Zero means 'none recorded', so a time of zero is recorded as one.
+      uint32_t now = clock();
+      now = (now == 0) ? 1 : now;
+
+      available_time.compare_exchange_strong(expected, now);
+    }
+
+    //*******************************************
+    /// Called by the scheduler before task_process_work.
+    //*******************************************
+    void begin_run()
+    {
+      start_time         = clock();
+      run_available_time = available_time.exchange(0);
+    }
+
+    //*******************************************
+    /// Called by the scheduler after task_process_work.
+    //*******************************************
+    void end_run()
+    {
+      const uint32_t end_time = clock();
+      const uint32_t run_time = end_time - start_time;
+
+      begin_write();
+
+      invocations.store(invocations.load(etl::memory_order_relaxed) + 1, etl::memory_order_release);
+
+      const uint32_t low = total_run_time_low.load(etl::memory_order_relaxed) + run_time;
+      total_run_time_low.store(low, etl::memory_order_release);
+
+      if (low < run_time)
+      {
+        total_run_time_high.store(total_run_time_high.load(etl::memory_order_relaxed) + 1, etl::memory_order_release);
+      }
+
+      if (run_time > max_run_time.load(etl::memory_order_relaxed))
+      {
+        max_run_time.store(run_time, etl::memory_order_release);
+      }
+
+      increment(run_time_histogram[bucket(run_time)]);
+
+      if (run_available_time != 0)
+      {
+        // Clamp the 'time of zero recorded as one' case.
+        const uint32_t latency = (int32_t(start_time - run_available_time) < 0) ? 0U : start_time - run_available_time;
+
+        if (latency > max_latency.load(etl::memory_order_relaxed))
+        {
+          max_latency.store(latency, etl::memory_order_release);
+        }
+
+        increment(latency_histogram[bucket(latency)]);
+      }
+
+      end_write();
+    }
+
+    //*******************************************
+    /// Gets the histogram bucket for a time.
+    //*******************************************
+    static size_t bucket(uint32_t time)
+    {
+      size_t b = 0U;
+
+      while ((time != 0U) && (b < (NUMBER_OF_BUCKETS - 1U)))
+      {
+        time >>= 1U;
+        ++b;
+      }
+
+      return b;
+    }
+
+  private:
+
+    //*******************************************
+    void begin_write()
+    {
+      sequence.store(sequence.load(etl::memory_order_relaxed) + 1, etl::memory_order_release);
+    }
+
+    //*******************************************
+    void end_write()
+    {
+      sequence.store(sequence.load(etl::memory_order_relaxed) + 1, etl::memory_order_release);
+    }
+
+    //*******************************************
+    static void increment(etl::atomic<uint32_t>& value)
+    {
+      value.store(value.load(etl::memory_order_relaxed) + 1, etl::memory_order_release);
+    }
+
+    // Disabled
+    task_statistics(const task_statistics&);
+    task_statistics& operator =(const task_statistics&);
+
+    clock_function_t clock;
+
+    // Odd while the scheduler is writing.
+    // The statistics are written with release and read with acquire, so a
+    // reader that sees any new value also sees the sequence change.
+    etl::atomic<uint32_t> sequence;
+
+    etl::atomic<uint32_t> invocations;
+    etl::atomic<uint32_t> total_run_time_low;
+    etl::atomic<uint32_t> total_run_time_high;
+    etl::atomic<uint32_t> max_run_time;
+    etl::atomic<uint32_t> max_latency;
+    etl::atomic<uint32_t> run_time_histogram[NUMBER_OF_BUCKETS];
+    etl::atomic<uint32_t> latency_histogram[NUMBER_OF_BUCKETS];
+
+    etl::atomic<uint32_t> available_time;
+    uint32_t              start_time;
+    uint32_t              run_available_time;
+  };
+}
+
+#endif
+
+#endif
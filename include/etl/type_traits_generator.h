@@ -304,6 +304,10 @@ namespace etl
   /// is_trivially_copy_assignable
   ///\ingroup type_traits
   template <typename T> struct is_trivially_copy_assignable : std::is_trivially_copy_assignable<T> {};
+
+  /// is_trivially_copyable
+  ///\ingroup type_traits
+  template <typename T> struct is_trivially_copyable : std::is_trivially_copyable<T> {};
 #else
   /// is_trivially_constructible
   /// For C++03, only POD types are recognised.
@@ -324,6 +328,24 @@ namespace etl
   /// For C++03, only POD types are recognised.
   ///\ingroup type_traits
   template <typename T> struct is_trivially_copy_assignable : etl::is_pod<T> {};
+
+  /// is_trivially_copyable
+  /// For C++03, only POD types are recognised.
+  ///\ingroup type_traits
+  template <typename T> struct is_trivially_copyable : etl::is_pod<T> {};
+#endif
+
+  /// is_trivially_relocatable
+  /// Objects of the type may be moved to new storage by copying their bytes,
+  /// after which the old storage is treated as uninitialised.
+  /// True for trivially copyable types. Specialise as etl::true_type for other
+  /// types that qualify, such as those that own a pointer to external memory
+  /// but hold no pointer into themselves.
+  ///\ingroup type_traits
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 5)) || (defined(_MSC_VER) && (_MSC_VER >= 1900))
+  template <typename T> struct is_trivially_relocatable : etl::integral_constant<bool, etl::is_trivially_copyable<T>::value || __is_trivially_copyable(T)> {};
+#else
+  template <typename T> struct is_trivially_relocatable : etl::is_trivially_copyable<T> {};
 #endif
 
 #if ETL_CPP11_SUPPORTED
@@ -231,6 +231,7 @@ namespace etl
     //*********************************************************************
     void resize(size_t new_size, T value)
     {
+      ensure_capacity(new_size);
       ETL_ASSERT(new_size <= CAPACITY, ETL_ERROR(vector_full));
 
       const size_t current_size = size();
@@ -367,6 +368,11 @@ namespace etl
     {
       ETL_STATIC_ASSERT((etl::is_same<typename etl::remove_cv<T>::type, typename etl::remove_cv<typename std::iterator_traits<TIterator>::value_type>::type>::value), "Iterator type does not match container type");
 
+      if (p_grow != nullptr)
+      {
+        ensure_capacity(size_t(std::distance(first, last)));
+      }
+
 #if defined(ETL_DEBUG)
       difference_type d = std::distance(first, last);
       ETL_ASSERT(static_cast<size_t>(d) <= CAPACITY, ETL_ERROR(vector_full));
@@ -386,6 +392,7 @@ namespace etl
     //*********************************************************************
     void assign(size_t n, parameter_t value)
     {
+      ensure_capacity(n);
       ETL_ASSERT(n <= CAPACITY, ETL_ERROR(vector_full));
 
       initialise();
@@ -404,44 +411,61 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a value at the end of the vector.
-    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    /// If the vector is full the grow function, if any, is asked for a larger buffer.
+    /// If it is still full, emits vector_full if ETL_CHECK_PUSH_POP is defined and
+    /// asserts or exceptions are enabled. Otherwise the value is not added.
     ///\param value The value to add.
     //*********************************************************************
     void push_back(const_reference value)
     {
-#if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
-#endif
-      create_back(value);
+      if (p_end == (p_buffer + CAPACITY))
+      {
+        push_back_full(value);
+      }
+      else
+      {
+        create_back(value);
+      }
     }
 
 #if ETL_CPP11_SUPPORTED
     //*********************************************************************
     /// Inserts a value at the end of the vector.
-    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    /// If the vector is full the grow function, if any, is asked for a larger buffer.
+    /// If it is still full, emits vector_full if ETL_CHECK_PUSH_POP is defined and
+    /// asserts or exceptions are enabled. Otherwise the value is not added.
     ///\param value The value to add.
     //*********************************************************************
     void push_back(rvalue_reference value)
     {
-#if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
-#endif
-      create_back(std::move(value));
+      if (p_end == (p_buffer + CAPACITY))
+      {
+        push_back_full(std::move(value));
+      }
+      else
+      {
+        create_back(std::move(value));
+      }
     }
 #endif
 
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_VECTOR_FORCE_CPP03)
     //*********************************************************************
     /// Constructs a value at the end of the vector.
-    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    /// If the vector is full the grow function, if any, is asked for a larger buffer.
+    /// If it is still full, emits vector_full if ETL_CHECK_PUSH_POP is defined and
+    /// asserts or exceptions are enabled. Otherwise the value is not added.
     ///\param value The value to add.
     //*********************************************************************
     template <typename ... Args>
     void emplace_back(Args && ... args)
     {
-#if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
-#endif
+      if (p_end == (p_buffer + CAPACITY))
+      {
+        emplace_back_full(movable_tag(), std::forward<Args>(args)...);
+        return;
+      }
+
       ::new (p_end) T(std::forward<Args>(args)...);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT
@@ -449,15 +473,20 @@ namespace etl
 #else
     //*********************************************************************
     /// Constructs a value at the end of the vector.
-    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    /// If the vector is full the grow function, if any, is asked for a larger buffer.
+    /// If it is still full, emits vector_full if ETL_CHECK_PUSH_POP is defined and
+    /// asserts or exceptions are enabled. Otherwise the value is not added.
     ///\param value The value to add.
     //*********************************************************************
     template <typename T1>
     void emplace_back(const T1& value1)
     {
-#if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
-#endif
+      if (p_end == (p_buffer + CAPACITY))
+      {
+        emplace_back_full(movable_tag(), value1);
+        return;
+      }
+
       ::new (p_end) T(value1);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT
@@ -465,15 +494,20 @@ namespace etl
 
     //*********************************************************************
     /// Constructs a value at the end of the vector.
-    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    /// If the vector is full the grow function, if any, is asked for a larger buffer.
+    /// If it is still full, emits vector_full if ETL_CHECK_PUSH_POP is defined and
+    /// asserts or exceptions are enabled. Otherwise the value is not added.
     ///\param value The value to add.
     //*********************************************************************
     template <typename T1, typename T2>
     void emplace_back(const T1& value1, const T2& value2)
     {
-#if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
-#endif
+      if (p_end == (p_buffer + CAPACITY))
+      {
+        emplace_back_full(movable_tag(), value1, value2);
+        return;
+      }
+
       ::new (p_end) T(value1, value2);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT
@@ -481,15 +515,20 @@ namespace etl
 
     //*********************************************************************
     /// Constructs a value at the end of the vector.
-    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    /// If the vector is full the grow function, if any, is asked for a larger buffer.
+    /// If it is still full, emits vector_full if ETL_CHECK_PUSH_POP is defined and
+    /// asserts or exceptions are enabled. Otherwise the value is not added.
     ///\param value The value to add.
     //*********************************************************************
     template <typename T1, typename T2, typename T3>
     void emplace_back(const T1& value1, const T2& value2, const T3& value3)
     {
-#if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
-#endif
+      if (p_end == (p_buffer + CAPACITY))
+      {
+        emplace_back_full(movable_tag(), value1, value2, value3);
+        return;
+      }
+
       ::new (p_end) T(value1, value2, value3);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT
@@ -497,15 +536,20 @@ namespace etl
 
     //*********************************************************************
     /// Constructs a value at the end of the vector.
-    /// If asserts or exceptions are enabled, emits vector_full if the vector is already full.
+    /// If the vector is full the grow function, if any, is asked for a larger buffer.
+    /// If it is still full, emits vector_full if ETL_CHECK_PUSH_POP is defined and
+    /// asserts or exceptions are enabled. Otherwise the value is not added.
     ///\param value The value to add.
     //*********************************************************************
     template <typename T1, typename T2, typename T3, typename T4>
     void emplace_back(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
-#if defined(ETL_CHECK_PUSH_POP)
-      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
-#endif
+      if (p_end == (p_buffer + CAPACITY))
+      {
+        emplace_back_full(movable_tag(), value1, value2, value3, value4);
+        return;
+      }
+
       ::new (p_end) T(value1, value2, value3, value4);
       ++p_end;
       ETL_INCREMENT_DEBUG_COUNT
@@ -532,17 +576,19 @@ namespace etl
     //*********************************************************************
     iterator insert(iterator position, const_reference value)
     {
+      // The value may be one of the elements, which move if the buffer grows.
+      const_pointer p_value = etl::addressof(value);
+
+      position = ensure_capacity(position, 1U, p_value);
       ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
 
       if (position == end())
       {
-        create_back(value);
+        create_back(*p_value);
       }
       else
       {
-        create_back(back());
-        std::copy_backward(position, p_end - 2, p_end - 1);
-        *position = value;
+        insert_value(position, *p_value, relocatable_tag());
       }
 
       return position;
@@ -557,17 +603,19 @@ namespace etl
     //*********************************************************************
     iterator insert(iterator position, rvalue_reference value)
     {
+      // The value may be one of the elements, which move if the buffer grows.
+      pointer p_value = etl::addressof(value);
+
+      position = ensure_capacity(position, 1U, p_value);
       ETL_ASSERT(size() + 1 <= CAPACITY, ETL_ERROR(vector_full));
 
       if (position == end())
       {
-        create_back(std::move(value));
+        create_back(std::move(*p_value));
       }
       else
       {
-        create_back(std::move(back()));
-        std::move_backward(position, p_end - 2, p_end - 1);
-        *position = std::move(value);
+        insert_value(position, std::move(*p_value), relocatable_tag());
       }
 
       return position;
@@ -581,6 +629,13 @@ namespace etl
     template <typename ... Args>
     iterator emplace(iterator position, Args && ... args)
     {
+      if (must_grow(1U))
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        return insert(position, T(std::forward<Args>(args)...));
+      }
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       void* p;
@@ -593,9 +648,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+        open_gap(position, relocatable_tag());
       }
 
       ::new (p) T(std::forward<Args>(args)...);
@@ -606,6 +659,13 @@ namespace etl
     template <typename T1>
     iterator emplace(iterator position, const T1& value1)
     {
+      if (must_grow(1U))
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        return insert(position, T(value1));
+      }
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       void* p;
@@ -618,9 +678,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+        open_gap(position, relocatable_tag());
       }
 
       ::new (p) T(value1);
@@ -631,6 +689,13 @@ namespace etl
     template <typename T1, typename T2>
     iterator emplace(iterator position, const T1& value1, const T2& value2)
     {
+      if (must_grow(1U))
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        return insert(position, T(value1, value2));
+      }
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       void* p;
@@ -643,9 +708,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+        open_gap(position, relocatable_tag());
       }
 
       ::new (p) T(value1, value2);
@@ -656,6 +719,13 @@ namespace etl
     template <typename T1, typename T2, typename T3>
     iterator emplace(iterator position, const T1& value1, const T2& value2, const T3& value3)
     {
+      if (must_grow(1U))
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        return insert(position, T(value1, value2, value3));
+      }
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       void* p;
@@ -668,9 +738,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+        open_gap(position, relocatable_tag());
       }
 
       ::new (p) T(value1, value2, value3);
@@ -681,6 +749,13 @@ namespace etl
     template <typename T1, typename T2, typename T3, typename T4>
     iterator emplace(iterator position, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
     {
+      if (must_grow(1U))
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        return insert(position, T(value1, value2, value3, value4));
+      }
+
       ETL_ASSERT(!full(), ETL_ERROR(vector_full));
 
       void* p;
@@ -693,9 +768,7 @@ namespace etl
       else
       {
         p = etl::addressof(*position);
-        create_back(back());
-        std::copy_backward(position, p_end - 2, p_end - 1);
-        (*position).~T();
+        open_gap(position, relocatable_tag());
       }
 
       ::new (p) T(value1, value2, value3, value4);
@@ -713,48 +786,10 @@ namespace etl
     //*********************************************************************
     void insert(iterator position, size_t n, parameter_t value)
     {
+      position = ensure_capacity(position, n);
       ETL_ASSERT((size() + n) <= CAPACITY, ETL_ERROR(vector_full));
 
-      size_t insert_n = n;
-      size_t insert_begin = std::distance(begin(), position);
-      size_t insert_end = insert_begin + insert_n;
-
-      // Copy old data.
-      size_t copy_old_n;
-      size_t construct_old_n;
-      iterator p_construct_old;
-
-      if (insert_end > size())
-      {
-        copy_old_n = 0;
-        construct_old_n = size() - insert_begin;
-        p_construct_old = p_buffer + insert_end;
-      }
-      else
-      {
-        copy_old_n = size() - insert_begin - insert_n;
-        construct_old_n = insert_n;
-        p_construct_old = p_end;
-      }
-
-      size_t copy_new_n = construct_old_n;
-      size_t construct_new_n = insert_n - copy_new_n;
-
-      // Construct old.
-      etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
-      ETL_ADD_DEBUG_COUNT(construct_old_n)
-
-      // Copy old.
-      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
-
-      // Construct new.
-      etl::uninitialized_fill_n(p_end, construct_new_n, value);
-      ETL_ADD_DEBUG_COUNT(construct_new_n)
-
-        // Copy new.
-        std::fill_n(p_buffer + insert_begin, copy_new_n, value);
-
-      p_end += n;
+      insert_n(position, n, value, relocatable_tag());
     }
 
     //*********************************************************************
@@ -770,48 +805,10 @@ namespace etl
     {
       size_t count = std::distance(first, last);
 
+      position = ensure_capacity(position, count);
       ETL_ASSERT((size() + count) <= CAPACITY, ETL_ERROR(vector_full));
 
-      size_t insert_n = count;
-      size_t insert_begin = std::distance(begin(), position);
-      size_t insert_end = insert_begin + insert_n;
-
-      // Copy old data.
-      size_t copy_old_n;
-      size_t construct_old_n;
-      iterator p_construct_old;
-
-      if (insert_end > size())
-      {
-        copy_old_n = 0;
-        construct_old_n = size() - insert_begin;
-        p_construct_old = p_buffer + insert_end;
-      }
-      else
-      {
-        copy_old_n = size() - insert_begin - insert_n;
-        construct_old_n = insert_n;
-        p_construct_old = p_end;
-      }
-
-      size_t copy_new_n = construct_old_n;
-      size_t construct_new_n = insert_n - copy_new_n;
-
-      // Construct old.
-      etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
-      ETL_ADD_DEBUG_COUNT(construct_old_n)
-
-      // Copy old.
-      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
-
-      // Construct new.
-      etl::uninitialized_copy_n(first + copy_new_n, construct_new_n, p_end);
-      ETL_ADD_DEBUG_COUNT(construct_new_n)
-
-      // Copy new.
-      etl::copy_n(first, copy_new_n, p_buffer + insert_begin);
-
-      p_end += count;
+      insert_range(position, first, last, count, relocatable_tag());
     }
 
     //*********************************************************************
@@ -821,8 +818,7 @@ namespace etl
     //*********************************************************************
     iterator erase(iterator i_element)
     {
-      std::copy(i_element + 1, end(), i_element);
-      destroy_back();
+      erase_range(i_element, i_element + 1, relocatable_tag());
 
       return i_element;
     }
@@ -843,13 +839,7 @@ namespace etl
       }
       else
       {
-        std::copy(last, end(), first);
-        size_t n_delete = std::distance(first, last);
-
-        // Destroy the elements left over at the end.
-        etl::destroy(p_end - n_delete, p_end);
-        ETL_SUBTRACT_DEBUG_COUNT(n_delete)
-          p_end -= n_delete;
+        erase_range(first, last, relocatable_tag());
       }
 
       return first;
@@ -942,7 +932,8 @@ namespace etl
     ivector(T* p_buffer_, size_t MAX_SIZE)
       : vector_base(MAX_SIZE),
       p_buffer(p_buffer_),
-      p_end(p_buffer_)
+      p_end(p_buffer_),
+      p_grow(nullptr)
     {
     }
 
@@ -985,55 +976,647 @@ namespace etl
       p_end    = p_buffer_ + length;
     }
 
+    //*************************************************************************
+    /// Called when an operation needs more than the current capacity.
+    /// May move the contents to a larger buffer with set_buffer.
+    /// Returns true if the capacity is now at least new_size.
+    //*************************************************************************
+    typedef bool (*grow_function_t)(ivector& vec, size_t new_size);
+
+    //*************************************************************************
+    /// Sets the function to call when the vector needs a larger buffer.
+    //*************************************************************************
+    void set_grow_function(grow_function_t p_grow_)
+    {
+      p_grow = p_grow_;
+    }
+
+    //*************************************************************************
+    /// Replaces the buffer. The elements must already have been relocated.
+    //*************************************************************************
+    void set_buffer(T* p_buffer_, size_t capacity_)
+    {
+      p_end    = p_buffer_ + (p_end - p_buffer);
+      p_buffer = p_buffer_;
+      CAPACITY = capacity_;
+    }
+
     pointer p_buffer; ///< Pointer to the start of the buffer.
     pointer p_end;    ///< Pointer to one past the last element in the buffer.
 
   private:
 
-    //*********************************************************************
-    /// Create a new element with a default value at the back.
-    //*********************************************************************
-    inline void create_back()
+    //*************************************************************************
+    /// Asks for a larger buffer if new_size will not fit.
+    //*************************************************************************
+    void ensure_capacity(size_t new_size)
     {
-      etl::create_value_at(p_end);
-      ETL_INCREMENT_DEBUG_COUNT
+      if ((new_size > CAPACITY) && (p_grow != nullptr))
+      {
+        p_grow(*this, new_size);
+      }
+    }
 
-      ++p_end;
+    //*************************************************************************
+    /// Asks for a larger buffer if 'n' more elements will not fit.
+    /// Returns the insert position in the current buffer.
+    //*************************************************************************
+    iterator ensure_capacity(iterator position, size_t n)
+    {
+      if (must_grow(n))
+      {
+        const size_t index = size_t(position - p_buffer);
+        p_grow(*this, size() + n);
+        position = p_buffer + index;
+      }
+
+      return position;
     }
 
-    //*********************************************************************
-    /// Create a new element with a value at the back
-    //*********************************************************************
-    inline void create_back(const_reference value)
+    //*************************************************************************
+    /// Asks for a larger buffer if 'n' more elements will not fit.
+    /// If 'p_value' points to an element it is moved to point to the same
+    /// element in the new buffer.
+    /// Returns the insert position in the current buffer.
+    //*************************************************************************
+    template <typename TPointer>
+    iterator ensure_capacity(iterator position, size_t n, TPointer& p_value)
     {
-      etl::create_copy_at(p_end, value);
-      ETL_INCREMENT_DEBUG_COUNT
+      if (must_grow(n))
+      {
+        const_pointer p_old_buffer = p_buffer;
+        const_pointer p_old_end    = p_end;
 
-      ++p_end;
+        position = ensure_capacity(position, n);
+
+        if ((p_value >= p_old_buffer) && (p_value < p_old_end))
+        {
+          p_value = p_buffer + (p_value - p_old_buffer);
+        }
+      }
+
+      return position;
+    }
+
+    //*************************************************************************
+    /// <b>true</b> if 'n' more elements will not fit and there is a grow function.
+    //*************************************************************************
+    bool must_grow(size_t n) const
+    {
+      return ((size() + n) > CAPACITY) && (p_grow != nullptr);
+    }
+
+    //*************************************************************************
+    /// Called by push_back when the vector is full.
+    /// Asks for a larger buffer and adds the value if there is now room.
+    /// The value may be one of the elements, which move if the buffer grows.
+    //*************************************************************************
+    void push_back_full(const_reference value)
+    {
+      const_pointer p_value = etl::addressof(value);
+
+      ensure_capacity(end(), 1U, p_value);
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+
+      if (size() != CAPACITY)
+      {
+        create_back(*p_value);
+      }
     }
 
 #if ETL_CPP11_SUPPORTED
-    //*********************************************************************
-    /// Create a new element with a value at the back
-    //*********************************************************************
-    inline void create_back(rvalue_reference value)
+    //*************************************************************************
+    /// Called by push_back when the vector is full.
+    //*************************************************************************
+    void push_back_full(rvalue_reference value)
     {
-      etl::create_copy_at(p_end, std::move(value));
-      ETL_INCREMENT_DEBUG_COUNT
+      pointer p_value = etl::addressof(value);
 
-      ++p_end;
+      ensure_capacity(end(), 1U, p_value);
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+
+      if (size() != CAPACITY)
+      {
+        create_back(std::move(*p_value));
+      }
     }
 #endif
 
-    //*********************************************************************
-    /// Destroy an element at the back.
-    //*********************************************************************
-    inline void destroy_back()
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_VECTOR_FORCE_CPP03)
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T may be moved.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back_full(etl::true_type, Args && ... args)
     {
-      --p_end;
+      if (p_grow != nullptr)
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        push_back(T(std::forward<Args>(args)...));
+      }
+      else
+      {
+        emplace_back_full(etl::false_type(), std::forward<Args>(args)...);
+      }
+    }
 
-      etl::destroy_at(p_end);
-      ETL_DECREMENT_DEBUG_COUNT
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T cannot be moved.
+    //*************************************************************************
+    template <typename ... Args>
+    void emplace_back_full(etl::false_type, Args && ... args)
+    {
+      ensure_capacity(size() + 1U);
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+
+      if (size() != CAPACITY)
+      {
+        ::new (p_end) T(std::forward<Args>(args)...);
+        ++p_end;
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+    }
+#else
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T may be moved.
+    //*************************************************************************
+    template <typename T1>
+    void emplace_back_full(etl::true_type, const T1& value1)
+    {
+      if (p_grow != nullptr)
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        push_back(T(value1));
+      }
+      else
+      {
+        emplace_back_full(etl::false_type(), value1);
+      }
+    }
+
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T cannot be moved.
+    //*************************************************************************
+    template <typename T1>
+    void emplace_back_full(etl::false_type, const T1& value1)
+    {
+      ensure_capacity(size() + 1U);
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+
+      if (size() != CAPACITY)
+      {
+        ::new (p_end) T(value1);
+        ++p_end;
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+    }
+
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T may be moved.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    void emplace_back_full(etl::true_type, const T1& value1, const T2& value2)
+    {
+      if (p_grow != nullptr)
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        push_back(T(value1, value2));
+      }
+      else
+      {
+        emplace_back_full(etl::false_type(), value1, value2);
+      }
+    }
+
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T cannot be moved.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    void emplace_back_full(etl::false_type, const T1& value1, const T2& value2)
+    {
+      ensure_capacity(size() + 1U);
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+
+      if (size() != CAPACITY)
+      {
+        ::new (p_end) T(value1, value2);
+        ++p_end;
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+    }
+
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T may be moved.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    void emplace_back_full(etl::true_type, const T1& value1, const T2& value2, const T3& value3)
+    {
+      if (p_grow != nullptr)
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        push_back(T(value1, value2, value3));
+      }
+      else
+      {
+        emplace_back_full(etl::false_type(), value1, value2, value3);
+      }
+    }
+
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T cannot be moved.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    void emplace_back_full(etl::false_type, const T1& value1, const T2& value2, const T3& value3)
+    {
+      ensure_capacity(size() + 1U);
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+
+      if (size() != CAPACITY)
+      {
+        ::new (p_end) T(value1, value2, value3);
+        ++p_end;
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+    }
+
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T may be moved.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    void emplace_back_full(etl::true_type, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      if (p_grow != nullptr)
+      {
+        // The arguments may refer to elements, which move if the buffer grows,
+        // so construct the value first.
+        push_back(T(value1, value2, value3, value4));
+      }
+      else
+      {
+        emplace_back_full(etl::false_type(), value1, value2, value3, value4);
+      }
+    }
+
+    //*************************************************************************
+    /// Called by emplace_back when the vector is full and T cannot be moved.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    void emplace_back_full(etl::false_type, const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      ensure_capacity(size() + 1U);
+#if defined(ETL_CHECK_PUSH_POP)
+      ETL_ASSERT(size() != CAPACITY, ETL_ERROR(vector_full));
+#endif
+
+      if (size() != CAPACITY)
+      {
+        ::new (p_end) T(value1, value2, value3, value4);
+        ++p_end;
+        ETL_INCREMENT_DEBUG_COUNT
+      }
+    }
+#endif
+
+    grow_function_t p_grow; ///< Called when more capacity is needed, or nullptr.
+
+    //*********************************************************************
+    /// Create a new element with a default value at the back.
+    //*********************************************************************
+    inline void create_back()
+    {
+      etl::create_value_at(p_end);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      ++p_end;
+    }
+
+    //*********************************************************************
+    /// Create a new element with a value at the back
+    //*********************************************************************
+    inline void create_back(const_reference value)
+    {
+      etl::create_copy_at(p_end, value);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      ++p_end;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Create a new element with a value at the back
+    //*********************************************************************
+    inline void create_back(rvalue_reference value)
+    {
+      etl::create_copy_at(p_end, std::move(value));
+      ETL_INCREMENT_DEBUG_COUNT
+
+      ++p_end;
+    }
+#endif
+
+    //*********************************************************************
+    /// Destroy an element at the back.
+    //*********************************************************************
+    inline void destroy_back()
+    {
+      --p_end;
+
+      etl::destroy_at(p_end);
+      ETL_DECREMENT_DEBUG_COUNT
+    }
+
+    //*********************************************************************
+    /// Element types that may be moved by copying their bytes.
+    //*********************************************************************
+    typedef etl::integral_constant<bool, etl::is_trivially_relocatable<T>::value> relocatable_tag;
+
+    //*********************************************************************
+    /// Element types that may be constructed from a temporary.
+    /// Types that cannot are constructed in place, even if the buffer grows.
+    //*********************************************************************
+#if ETL_CPP11_SUPPORTED && !defined(ETL_NO_STL) && !defined(ETL_STLPORT)
+    typedef etl::integral_constant<bool, std::is_move_constructible<T>::value> movable_tag;
+#elif defined(__clang__) || (defined(__GNUC__) && (__GNUC__ >= 8)) || (defined(_MSC_VER) && (_MSC_VER >= 1900))
+  #if ETL_CPP11_SUPPORTED
+    typedef etl::integral_constant<bool, __is_constructible(T, T&&)> movable_tag;
+  #else
+    typedef etl::integral_constant<bool, __is_constructible(T, const T&)> movable_tag;
+  #endif
+#else
+    typedef etl::false_type movable_tag;
+#endif
+
+    //*********************************************************************
+    /// Opens an uninitialised gap of one element at position.
+    /// Shifts the following elements by copy assignment.
+    //*********************************************************************
+    void open_gap(iterator position, etl::false_type)
+    {
+      create_back(back());
+      std::copy_backward(position, p_end - 2, p_end - 1);
+      (*position).~T();
+    }
+
+    //*********************************************************************
+    /// Opens an uninitialised gap of one element at position.
+    /// Relocates the following elements.
+    //*********************************************************************
+    void open_gap(iterator position, etl::true_type)
+    {
+      etl::relocate(position, p_end, position + 1);
+      ETL_INCREMENT_DEBUG_COUNT
+
+      ++p_end;
+    }
+
+    //*********************************************************************
+    /// Inserts a value before position, which is not end().
+    /// If the value is one of the elements then it moves with them.
+    //*********************************************************************
+    void insert_value(iterator position, const_reference value, etl::false_type)
+    {
+      const_pointer p_value = etl::addressof(value);
+
+      if ((p_value >= position) && (p_value < p_end))
+      {
+        ++p_value;
+      }
+
+      create_back(back());
+      std::copy_backward(position, p_end - 2, p_end - 1);
+      *position = *p_value;
+    }
+
+    //*********************************************************************
+    /// Inserts a value before position, which is not end().
+    /// If the value is one of the elements then it moves with them.
+    //*********************************************************************
+    void insert_value(iterator position, const_reference value, etl::true_type)
+    {
+      const_pointer p_value = etl::addressof(value);
+
+      if ((p_value >= position) && (p_value < p_end))
+      {
+        ++p_value;
+      }
+
+      open_gap(position, etl::true_type());
+      etl::create_copy_at(etl::addressof(*position), *p_value);
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*********************************************************************
+    /// Inserts a value before position, which is not end().
+    /// If the value is one of the elements then it moves with them.
+    //*********************************************************************
+    void insert_value(iterator position, rvalue_reference value, etl::false_type)
+    {
+      pointer p_value = etl::addressof(value);
+
+      if ((p_value >= position) && (p_value < p_end))
+      {
+        ++p_value;
+      }
+
+      create_back(std::move(back()));
+      std::move_backward(position, p_end - 2, p_end - 1);
+      *position = std::move(*p_value);
+    }
+
+    //*********************************************************************
+    /// Inserts a value before position, which is not end().
+    /// If the value is one of the elements then it moves with them.
+    //*********************************************************************
+    void insert_value(iterator position, rvalue_reference value, etl::true_type)
+    {
+      pointer p_value = etl::addressof(value);
+
+      if ((p_value >= position) && (p_value < p_end))
+      {
+        ++p_value;
+      }
+
+      open_gap(position, etl::true_type());
+      etl::create_copy_at(etl::addressof(*position), std::move(*p_value));
+    }
+#endif
+
+    //*********************************************************************
+    /// Inserts 'n' values before position.
+    /// Shifts the following elements by copy construction and assignment.
+    //*********************************************************************
+    void insert_n(iterator position, size_t n, parameter_t value, etl::false_type)
+    {
+      size_t insert_n = n;
+      size_t insert_begin = std::distance(begin(), position);
+      size_t insert_end = insert_begin + insert_n;
+
+      // Copy old data.
+      size_t copy_old_n;
+      size_t construct_old_n;
+      iterator p_construct_old;
+
+      if (insert_end > size())
+      {
+        copy_old_n = 0;
+        construct_old_n = size() - insert_begin;
+        p_construct_old = p_buffer + insert_end;
+      }
+      else
+      {
+        copy_old_n = size() - insert_begin - insert_n;
+        construct_old_n = insert_n;
+        p_construct_old = p_end;
+      }
+
+      size_t copy_new_n = construct_old_n;
+      size_t construct_new_n = insert_n - copy_new_n;
+
+      // Construct old.
+      etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
+      ETL_ADD_DEBUG_COUNT(construct_old_n)
+
+      // Copy old.
+      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
+
+      // Construct new.
+      etl::uninitialized_fill_n(p_end, construct_new_n, value);
+      ETL_ADD_DEBUG_COUNT(construct_new_n)
+
+      // Copy new.
+      std::fill_n(p_buffer + insert_begin, copy_new_n, value);
+
+      p_end += n;
+    }
+
+    //*********************************************************************
+    /// Inserts 'n' values before position.
+    /// Relocates the following elements.
+    /// If the value is one of the elements then it moves with them.
+    //*********************************************************************
+    void insert_n(iterator position, size_t n, parameter_t value, etl::true_type)
+    {
+      const_pointer p_value = etl::addressof(value);
+
+      if ((p_value >= position) && (p_value < p_end))
+      {
+        p_value += n;
+      }
+
+      etl::relocate(position, p_end, position + n);
+      p_end += n;
+
+      etl::uninitialized_fill_n(position, n, *p_value);
+      ETL_ADD_DEBUG_COUNT(n)
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values before position.
+    /// Shifts the following elements by copy construction and assignment.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(iterator position, TIterator first, TIterator /*last*/, size_t count, etl::false_type)
+    {
+      size_t insert_n = count;
+      size_t insert_begin = std::distance(begin(), position);
+      size_t insert_end = insert_begin + insert_n;
+
+      // Copy old data.
+      size_t copy_old_n;
+      size_t construct_old_n;
+      iterator p_construct_old;
+
+      if (insert_end > size())
+      {
+        copy_old_n = 0;
+        construct_old_n = size() - insert_begin;
+        p_construct_old = p_buffer + insert_end;
+      }
+      else
+      {
+        copy_old_n = size() - insert_begin - insert_n;
+        construct_old_n = insert_n;
+        p_construct_old = p_end;
+      }
+
+      size_t copy_new_n = construct_old_n;
+      size_t construct_new_n = insert_n - copy_new_n;
+
+      // Construct old.
+      etl::uninitialized_copy_n(p_end - construct_old_n, construct_old_n, p_construct_old);
+      ETL_ADD_DEBUG_COUNT(construct_old_n)
+
+      // Copy old.
+      std::copy_backward(p_buffer + insert_begin, p_buffer + insert_begin + copy_old_n, p_buffer + insert_end + copy_old_n);
+
+      // Construct new.
+      etl::uninitialized_copy_n(first + copy_new_n, construct_new_n, p_end);
+      ETL_ADD_DEBUG_COUNT(construct_new_n)
+
+      // Copy new.
+      etl::copy_n(first, copy_new_n, p_buffer + insert_begin);
+
+      p_end += count;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values before position.
+    /// Relocates the following elements.
+    //*********************************************************************
+    template <class TIterator>
+    void insert_range(iterator position, TIterator first, TIterator last, size_t count, etl::true_type)
+    {
+      etl::relocate(position, p_end, position + count);
+      p_end += count;
+
+      etl::uninitialized_copy(first, last, position);
+      ETL_ADD_DEBUG_COUNT(count)
+    }
+
+    //*********************************************************************
+    /// Erases the elements in [first, last).
+    /// Shifts the following elements by copy assignment.
+    //*********************************************************************
+    void erase_range(iterator first, iterator last, etl::false_type)
+    {
+      std::copy(last, end(), first);
+      size_t n_delete = std::distance(first, last);
+
+      // Destroy the elements left over at the end.
+      etl::destroy(p_end - n_delete, p_end);
+      ETL_SUBTRACT_DEBUG_COUNT(n_delete)
+      p_end -= n_delete;
+    }
+
+    //*********************************************************************
+    /// Erases the elements in [first, last).
+    /// Relocates the following elements.
+    //*********************************************************************
+    void erase_range(iterator first, iterator last, etl::true_type)
+    {
+      size_t n_delete = std::distance(first, last);
+
+      etl::destroy(first, last);
+      ETL_SUBTRACT_DEBUG_COUNT(n_delete)
+
+      etl::relocate(last, p_end, first);
+      p_end -= n_delete;
     }
 
     // Disable copy construction.
@@ -0,0 +1,338 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WORK_STEALING_SCHEDULER_INCLUDED
+#define ETL_WORK_STEALING_SCHEDULER_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "atomic.h"
+#include "scheduler.h"
+#include "vector.h"
+#include "power.h"
+#include "static_assert.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#if ETL_HAS_ATOMIC
+
+#undef ETL_FILE
+#define ETL_FILE "55"
+
+namespace etl
+{
+  //***************************************************************************
+  /// 'Invalid worker id' exception.
+  //***************************************************************************
+  class work_stealing_scheduler_worker_id_exception : public etl::scheduler_exception
+  {
+  public:
+
+    work_stealing_scheduler_worker_id_exception(string_type file_name_, numeric_type line_number_)
+      : etl::scheduler_exception(ETL_ERROR_TEXT("work_stealing_scheduler:worker id", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_work_stealing_scheduler
+  {
+    //*************************************************************************
+    /// A fixed capacity Chase-Lev work stealing deque of task indexes.
+    /// The owning worker pushes and pops at the bottom.
+    /// Other workers steal from the top.
+    /// CAPACITY must be a power of 2.
+    //*************************************************************************
+    template <const size_t CAPACITY>
+    class worker_deque
+    {
+    public:
+
+      worker_deque()
+        : top(0),
+          bottom(0)
+      {
+      }
+
+      //***********************************************************************
+      /// Pushes an index to the bottom. Owner only.
+      /// \return <b>true</b> if pushed, <b>false</b> if the deque was full.
+      //***********************************************************************
+      bool push(uint32_t index)
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed);
+        const uint32_t t = top.load(etl::memory_order_acquire);
+
+        if ((b - t) >= CAPACITY)
+        {
+          return false;
+        }
+
+        buffer[b & MASK].store(index, etl::memory_order_relaxed);
+        bottom.store(b + 1, etl::memory_order_release);
+
+        return true;
+      }
+
+      //***********************************************************************
+      /// Pops an index from the bottom. Owner only.
+      /// \return <b>true</b> if an index was popped.
+      //***********************************************************************
+      bool pop(uint32_t& index)
+      {
+        const uint32_t b = bottom.load(etl::memory_order_relaxed) - 1;
+        bottom.store(b, etl::memory_order_seq_cst);
+        uint32_t t = top.load(etl::memory_order_seq_cst);
+
+        // Empty?
+        if (int32_t(b - t) < 0)
+        {
+          bottom.store(b + 1, etl::memory_order_relaxed);
+          return false;
+        }
+
+        index = buffer[b & MASK].load(etl::memory_order_relaxed);
+
+        if (b != t)
+        {
+          return true;
+        }
+
+        // The last item, so race any thieves for it.
+        const bool won = top.compare_exchange_strong(t, t + 1, etl::memory_order_seq_cst);
+        bottom.store(b + 1, etl::memory_order_relaxed);
+
+        return won;
+      }
+
+      //***********************************************************************
+      /// Steals an index from the top. Any worker.
+      /// \return <b>true</b> if an index was stolen, <b>false</b> if empty or another worker won the race.
+      //***********************************************************************
+      bool steal(uint32_t& index)
+      {
+        uint32_t t = top.load(etl::memory_order_seq_cst);
+        const uint32_t b = bottom.load(etl::memory_order_seq_cst);
+
+        if (int32_t(b - t) <= 0)
+        {
+          return false;
+        }
+
+        index = buffer[t & MASK].load(etl::memory_order_relaxed);
+
+        return top.compare_exchange_strong(t, t + 1, etl::memory_order_seq_cst);
+      }
+
+    private:
+
+      static const uint32_t MASK = uint32_t(CAPACITY - 1);
+
+      etl::atomic<uint32_t> top;
+      etl::atomic<uint32_t> bottom;
+      etl::atomic<uint32_t> buffer[CAPACITY];
+    };
+  }
+
+  //***************************************************************************
+  /// Multi-core work stealing scheduler.
+  /// Each of the NUMBER_OF_WORKERS workers runs start(worker_id) on its own
+  /// thread or core. Worker 'w' polls the tasks at positions w, w + N, w + 2N...
+  /// of the priority ordered task list and queues those that have work on its
+  /// own deque. Queued tasks are called once per pass, like
+  /// etl::scheduler_policy_sequencial_single. A worker whose deque is empty
+  /// steals queued tasks from the other workers.
+  /// A task is never called by more than one worker at a time.
+  /// Higher priority tasks are taken first by their owner; thieves take the
+  /// lowest priority queued tasks.
+  /// The watchdog and idle callbacks are called by every worker after each
+  /// pass, so they may be called concurrently and must be thread safe.
+  /// All tasks must be added before any worker is started.
+  //***************************************************************************
+  template <size_t MAX_TASKS_, size_t NUMBER_OF_WORKERS_>
+  class work_stealing_scheduler : public etl::ischeduler
+  {
+  public:
+
+    enum
+    {
+      MAX_TASKS         = MAX_TASKS_,
+      NUMBER_OF_WORKERS = NUMBER_OF_WORKERS_
+    };
+
+    ETL_STATIC_ASSERT(NUMBER_OF_WORKERS > 0, "Must have at least one worker");
+
+    work_stealing_scheduler()
+      : ischeduler(task_list),
+        exit_requested(0)
+    {
+      for (size_t i = 0; i < MAX_TASKS; ++i)
+      {
+        queued[i].store(0);
+      }
+    }
+
+    //*******************************************
+    /// Runs worker 0 on the calling thread.
+    //*******************************************
+    void start()
+    {
+      start(0);
+    }
+
+    //*******************************************
+    /// Runs the specified worker on the calling thread.
+    /// Returns when exit_scheduler() is called.
+    //*******************************************
+    void start(size_t worker_id)
+    {
+      ETL_ASSERT(task_list.size() > 0, ETL_ERROR(etl::scheduler_no_tasks_exception));
+      ETL_ASSERT(worker_id < NUMBER_OF_WORKERS, ETL_ERROR(etl::work_stealing_scheduler_worker_id_exception));
+
+      deque_t& own = deques[worker_id];
+
+      while (exit_requested.load(etl::memory_order_acquire) == 0)
+      {
+        bool idle = true;
+        uint32_t index;
+
+        queue_ready_tasks(worker_id);
+
+        while (own.pop(index))
+        {
+          run_task(index);
+          idle = false;
+        }
+
+        while (steal(worker_id, index))
+        {
+          run_task(index);
+          idle = false;
+        }
+
+        if (p_watchdog_callback)
+        {
+          (*p_watchdog_callback)();
+        }
+
+        if (idle && p_idle_callback)
+        {
+          (*p_idle_callback)();
+        }
+      }
+    }
+
+    //*******************************************
+    /// Force all of the workers to exit.
+    /// May be called from any worker or thread.
+    //*******************************************
+    void exit_scheduler()
+    {
+      exit_requested.store(1, etl::memory_order_release);
+    }
+
+  private:
+
+    // The deques only ever hold each task once, so MAX_TASKS entries is enough.
+    typedef private_work_stealing_scheduler::worker_deque<etl::power_of_2_round_up<MAX_TASKS + 1>::value> deque_t;
+
+    //*******************************************
+    /// Queues this worker's tasks that have work.
+    /// Pushed lowest priority first, so that the owner pops the highest first.
+    //*******************************************
+    void queue_ready_tasks(size_t worker_id)
+    {
+      const size_t size = task_list.size();
+
+      if (worker_id >= size)
+      {
+        return;
+      }
+
+      size_t index = worker_id + (((size - 1 - worker_id) / NUMBER_OF_WORKERS) * NUMBER_OF_WORKERS);
+
+      while (true)
+      {
+        // Only the owner sets the flag, so a plain store is enough.
+        if ((queued[index].load(etl::memory_order_acquire) == 0) && (private_scheduler::request_work(*task_list[index]) > 0))
+        {
+          queued[index].store(1, etl::memory_order_relaxed);
+          deques[worker_id].push(uint32_t(index));
+        }
+
+        if (index < NUMBER_OF_WORKERS)
+        {
+          break;
+        }
+
+        index -= NUMBER_OF_WORKERS;
+      }
+    }
+
+    //*******************************************
+    /// Tries to steal a task from each of the other workers in turn.
+    //*******************************************
+    bool steal(size_t worker_id, uint32_t& index)
+    {
+      for (size_t i = 1; i < NUMBER_OF_WORKERS; ++i)
+      {
+        const size_t victim = (worker_id + i) % NUMBER_OF_WORKERS;
+
+        if (deques[victim].steal(index))
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    //*******************************************
+    /// Calls the task and releases it so that its owner may queue it again.
+    //*******************************************
+    void run_task(uint32_t index)
+    {
+      private_scheduler::process_work(*task_list[index]);
+      queued[index].store(0, etl::memory_order_release);
+    }
+
+    typedef etl::vector<etl::task*, MAX_TASKS> task_list_t;
+    task_list_t task_list;
+
+    etl::atomic<uint32_t> exit_requested;
+    etl::atomic<uint32_t> queued[MAX_TASKS];
+    deque_t               deques[NUMBER_OF_WORKERS];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
+
+#endif
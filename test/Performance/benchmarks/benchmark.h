@@ -0,0 +1,303 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_BENCHMARK_INCLUDED
+#define ETL_BENCHMARK_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <algorithm>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+  #else
+    #include <x86intrin.h>
+  #endif
+  #define ETL_BENCHMARK_HAS_CYCLES 1
+#else
+  #define ETL_BENCHMARK_HAS_CYCLES 0
+#endif
+
+//*****************************************************************************
+/// A small benchmark harness.
+/// Each benchmark is run for a number of warm-up repetitions, then timed for
+/// a number of measured repetitions. Every repetition performs a known number
+/// of operations. The median and 99th percentile of the time per operation,
+/// and the median cycles per operation, are taken over the repetitions.
+/// Cycles are time stamp counter cycles, and are only available on x86.
+//*****************************************************************************
+namespace etl_benchmark
+{
+  //***************************************************************************
+  /// Stops the compiler from optimising away a value.
+  //***************************************************************************
+  template <typename T>
+  inline void do_not_optimise(const T& value)
+  {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* p_sink;
+    p_sink = &value;
+#endif
+  }
+
+  //***************************************************************************
+  /// The time stamp counter, or zero if there is none.
+  //***************************************************************************
+  inline uint64_t read_cycles()
+  {
+#if ETL_BENCHMARK_HAS_CYCLES
+    return uint64_t(__rdtsc());
+#else
+    return 0U;
+#endif
+  }
+
+  //***************************************************************************
+  /// Command line options.
+  //***************************************************************************
+  struct options
+  {
+    options()
+      : warmup(3),
+        repetitions(31)
+    {
+    }
+
+    size_t      warmup;      ///< Untimed repetitions.
+    size_t      repetitions; ///< Timed repetitions.
+    std::string filter;      ///< Only run benchmarks whose 'group/name' contains this.
+  };
+
+  //***************************************************************************
+  /// The result of one benchmark.
+  //***************************************************************************
+  struct result
+  {
+    std::string group;
+    std::string name;
+    size_t      size;       ///< The size parameter, e.g. number of elements or bytes.
+    size_t      operations; ///< Operations per repetition.
+    double      median_ns;  ///< Median nanoseconds per operation.
+    double      p99_ns;     ///< 99th percentile nanoseconds per operation.
+    double      cycles;     ///< Median cycles per operation, or negative if unavailable.
+  };
+
+  //***************************************************************************
+  /// Runs benchmarks and collects the results.
+  //***************************************************************************
+  class harness
+  {
+  public:
+
+    explicit harness(const options& options_)
+      : settings(options_)
+    {
+    }
+
+    //*************************************************************************
+    /// Runs a benchmark.
+    /// setup() is called before every repetition and is not timed.
+    /// measure() is timed and must perform 'operations' operations.
+    //*************************************************************************
+    template <typename TSetup, typename TMeasure>
+    void run(const std::string& group, const std::string& name, size_t size, size_t operations, TSetup setup, TMeasure measure)
+    {
+      if (!selected(group, name))
+      {
+        return;
+      }
+
+      for (size_t i = 0U; i < settings.warmup; ++i)
+      {
+        setup();
+        measure();
+      }
+
+      std::vector<double> times;
+      std::vector<double> cycles;
+
+      for (size_t i = 0U; i < settings.repetitions; ++i)
+      {
+        setup();
+
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        const uint64_t start_cycles = read_cycles();
+
+        measure();
+
+        const uint64_t stop_cycles = read_cycles();
+        const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+
+        const double ns = double(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+
+        times.push_back(ns / double(operations));
+        cycles.push_back(double(stop_cycles - start_cycles) / double(operations));
+      }
+
+      std::sort(times.begin(), times.end());
+      std::sort(cycles.begin(), cycles.end());
+
+      result r;
+      r.group      = group;
+      r.name       = name;
+      r.size       = size;
+      r.operations = operations;
+      r.median_ns  = percentile(times, 50U);
+      r.p99_ns     = percentile(times, 99U);
+      r.cycles     = ETL_BENCHMARK_HAS_CYCLES ? percentile(cycles, 50U) : -1.0;
+
+      results.push_back(r);
+    }
+
+    //*************************************************************************
+    /// Runs a benchmark that needs no setup.
+    //*************************************************************************
+    template <typename TMeasure>
+    void run(const std::string& group, const std::string& name, size_t size, size_t operations, TMeasure measure)
+    {
+      run(group, name, size, operations, no_setup, measure);
+    }
+
+    //*************************************************************************
+    /// Writes the results as a table.
+    //*************************************************************************
+    void write_table(std::ostream& os) const
+    {
+      char line[256];
+
+      snprintf(line, sizeof(line), "%-12s %-40s %8s %12s %12s %12s\n", "group", "name", "size", "median ns", "p99 ns", "cycles");
+      os << line;
+
+      for (size_t i = 0U; i < results.size(); ++i)
+      {
+        const result& r = results[i];
+
+        snprintf(line, sizeof(line), "%-12s %-40s %8zu %12.2f %12.2f %12.1f\n",
+                 r.group.c_str(), r.name.c_str(), r.size, r.median_ns, r.p99_ns, r.cycles);
+        os << line;
+      }
+    }
+
+    //*************************************************************************
+    /// Writes the results as JSON.
+    //*************************************************************************
+    void write_json(std::ostream& os, const std::string& version) const
+    {
+      char number[64];
+
+      os << "{\n";
+      os << "  \"library\": \"etl\",\n";
+      os << "  \"version\": \"" << version << "\",\n";
+      os << "  \"warmup\": " << settings.warmup << ",\n";
+      os << "  \"repetitions\": " << settings.repetitions << ",\n";
+      os << "  \"benchmarks\": [\n";
+
+      for (size_t i = 0U; i < results.size(); ++i)
+      {
+        const result& r = results[i];
+
+        os << "    { \"group\": \"" << r.group << "\", \"name\": \"" << r.name << "\"";
+        os << ", \"size\": " << r.size << ", \"operations\": " << r.operations;
+
+        snprintf(number, sizeof(number), "%.3f", r.median_ns);
+        os << ", \"median_ns\": " << number;
+
+        snprintf(number, sizeof(number), "%.3f", r.p99_ns);
+        os << ", \"p99_ns\": " << number;
+
+        if (r.cycles >= 0.0)
+        {
+          snprintf(number, sizeof(number), "%.2f", r.cycles);
+          os << ", \"cycles\": " << number;
+        }
+        else
+        {
+          os << ", \"cycles\": null";
+        }
+
+        os << " }" << ((i + 1U) < results.size() ? "," : "") << "\n";
+      }
+
+      os << "  ]\n";
+      os << "}\n";
+    }
+
+  private:
+
+    static void no_setup()
+    {
+    }
+
+    //*************************************************************************
+    /// Nearest rank percentile of sorted values.
+    //*************************************************************************
+    static double percentile(const std::vector<double>& sorted, size_t percent)
+    {
+      if (sorted.empty())
+      {
+        return 0.0;
+      }
+
+      size_t rank = ((percent * sorted.size()) + 99U) / 100U;
+      rank = std::max(rank, size_t(1U));
+
+      return sorted[rank - 1U];
+    }
+
+    //*************************************************************************
+    bool selected(const std::string& group, const std::string& name) const
+    {
+      return settings.filter.empty() ||
+             ((group + "/" + name).find(settings.filter) != std::string::npos);
+    }
+
+    options             settings;
+    std::vector<result> results;
+  };
+
+  //***************************************************************************
+  /// The benchmark groups.
+  //***************************************************************************
+  void run_container_benchmarks(harness& h);
+  void run_queue_benchmarks(harness& h);
+  void run_random_benchmarks(harness& h);
+  void run_hash_benchmarks(harness& h);
+  void run_string_benchmarks(harness& h);
+  void run_timer_benchmarks(harness& h);
+}
+
+#endif
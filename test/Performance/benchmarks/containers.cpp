@@ -0,0 +1,711 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "etl/vector.h"
+#include "etl/deque.h"
+#include "etl/list.h"
+#include "etl/map.h"
+#include "etl/flat_map.h"
+#include "etl/unordered_map.h"
+#include "etl/cstring.h"
+#include "etl/pool.h"
+#include "etl/slab_allocator.h"
+#include "etl/arena.h"
+#include "etl/soa_vector.h"
+
+#include "benchmark.h"
+
+namespace
+{
+  const char* const GROUP = "containers";
+
+  //***************************************************************************
+  /// The keys 0 to n - 1 in a fixed pseudo random order.
+  //***************************************************************************
+  std::vector<int> make_keys(size_t n)
+  {
+    std::vector<int> keys(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      keys[i] = int(i);
+    }
+
+    uint32_t state = 0x12345678U;
+
+    for (size_t i = n; i > 1U; --i)
+    {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      std::swap(keys[i - 1U], keys[state % i]);
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  /// push_back, find and erase from the front.
+  //***************************************************************************
+  template <typename TSequence>
+  void sequence_benchmarks(etl_benchmark::harness& h, const std::string& name, TSequence& c, const std::vector<int>& keys)
+  {
+    const size_t n = keys.size();
+
+    h.run(GROUP, name + "/push_back", n, n,
+          [&] { c.clear(); },
+          [&]
+          {
+            for (size_t i = 0U; i < n; ++i)
+            {
+              c.push_back(keys[i]);
+            }
+          });
+
+    h.run(GROUP, name + "/find", n, n,
+          [&] { c.assign(keys.begin(), keys.end()); },
+          [&]
+          {
+            for (size_t i = 0U; i < n; ++i)
+            {
+              etl_benchmark::do_not_optimise(*std::find(c.begin(), c.end(), keys[i]));
+            }
+          });
+
+    h.run(GROUP, name + "/erase_front", n, n,
+          [&] { c.assign(keys.begin(), keys.end()); },
+          [&]
+          {
+            while (!c.empty())
+            {
+              c.erase(c.begin());
+            }
+          });
+  }
+
+  //***************************************************************************
+  /// Adds the items of a contiguous block.
+  //***************************************************************************
+  struct block_sum
+  {
+    block_sum()
+      : total(0)
+    {
+    }
+
+    void operator ()(const int* p, size_t n)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        total += p[i];
+      }
+    }
+
+    int total;
+  };
+
+  //***************************************************************************
+  /// Element by element against segmented access to a wrapped deque.
+  //***************************************************************************
+  template <typename TDeque>
+  void deque_segment_benchmarks(etl_benchmark::harness& h, TDeque& c, const std::vector<int>& keys)
+  {
+    const size_t n = keys.size();
+
+    // Start half way through the buffer, so that the contents wrap.
+    const auto fill = [&]
+    {
+      c.assign(keys.begin(), keys.begin() + (n / 2U));
+      c.pop_front(n / 2U);
+      c.push_back(keys.begin(), keys.end());
+    };
+
+    h.run(GROUP, "deque/sum_iterator", n, n,
+          fill,
+          [&]
+          {
+            int total = 0;
+
+            for (typename TDeque::const_iterator itr = c.begin(); itr != c.end(); ++itr)
+            {
+              total += *itr;
+            }
+
+            etl_benchmark::do_not_optimise(total);
+          });
+
+    h.run(GROUP, "deque/sum_segments", n, n,
+          fill,
+          [&]
+          {
+            etl_benchmark::do_not_optimise(c.for_each_segment(block_sum()).total);
+          });
+
+    h.run(GROUP, "deque/push_back_pop_front", n, n,
+          fill,
+          [&]
+          {
+            for (size_t i = 0U; i < n; ++i)
+            {
+              c.pop_front();
+              c.push_back(keys[i]);
+            }
+          });
+
+    h.run(GROUP, "deque/push_back_pop_front_range", n, n,
+          fill,
+          [&]
+          {
+            const size_t half = n / 2U;
+
+            c.pop_front(half);
+            c.push_back(keys.begin(), keys.begin() + half);
+            c.pop_front(n - half);
+            c.push_back(keys.begin() + half, keys.end());
+          });
+  }
+
+  //***************************************************************************
+  /// Walking nodes that are scattered through the pool, against walking them
+  /// after compact().
+  //***************************************************************************
+  template <typename TContainer>
+  int sum_values(const TContainer& c)
+  {
+    int total = 0;
+
+    for (typename TContainer::const_iterator itr = c.begin(); itr != c.end(); ++itr)
+    {
+      total += *itr;
+    }
+
+    return total;
+  }
+
+  template <typename TList, typename TMap>
+  void locality_benchmarks(etl_benchmark::harness& h, TList& list, TMap& map, const std::vector<int>& keys)
+  {
+    const size_t n = keys.size();
+
+    // The nodes are allocated in key order, so sorting scatters them.
+    const auto fill_list = [&]
+    {
+      list.assign(keys.begin(), keys.end());
+      list.sort();
+    };
+
+    const auto fill_map = [&]
+    {
+      map.clear();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        map.insert(typename TMap::value_type(keys[i], keys[i]));
+      }
+    };
+
+    int total = 0;
+
+    h.run(GROUP, "list/sum_scattered", n, n,
+          fill_list,
+          [&] { etl_benchmark::do_not_optimise(sum_values(list)); });
+
+    h.run(GROUP, "list/sum_compacted", n, n,
+          [&] { fill_list(); list.compact(); },
+          [&] { etl_benchmark::do_not_optimise(sum_values(list)); });
+
+    h.run(GROUP, "list/compact", n, n,
+          fill_list,
+          [&] { list.compact(); });
+
+    h.run(GROUP, "map/sum_scattered", n, n,
+          fill_map,
+          [&]
+          {
+            total = 0;
+
+            for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+            {
+              total += itr->second;
+            }
+
+            etl_benchmark::do_not_optimise(total);
+          });
+
+    h.run(GROUP, "map/sum_compacted", n, n,
+          [&] { fill_map(); map.compact(); },
+          [&]
+          {
+            total = 0;
+
+            for (typename TMap::const_iterator itr = map.begin(); itr != map.end(); ++itr)
+            {
+              total += itr->second;
+            }
+
+            etl_benchmark::do_not_optimise(total);
+          });
+
+    h.run(GROUP, "map/compact", n, n,
+          fill_map,
+          [&] { map.compact(); });
+  }
+
+  //***************************************************************************
+  /// Allocating and releasing a batch of items one at a time, against doing
+  /// it in bulk.
+  //***************************************************************************
+  struct Event
+  {
+    uint32_t id;
+    uint32_t data[7];
+  };
+
+  template <const size_t SIZE>
+  void pool_benchmarks(etl_benchmark::harness& h)
+  {
+    static etl::pool<Event, SIZE>         pool;
+    static etl::ordered_pool<Event, SIZE> ordered;
+    static Event*                         events[SIZE];
+
+    const size_t n = SIZE / 2U;
+
+    // Leave the pools half full, with scattered free items.
+    const auto fill = [&](etl::ipool& p)
+    {
+      p.release_all();
+
+      for (size_t i = 0U; i < SIZE; ++i)
+      {
+        events[i] = p.allocate<Event>();
+      }
+
+      for (size_t i = 0U; i < SIZE; i += 2U)
+      {
+        p.release(events[i]);
+      }
+    };
+
+    h.run(GROUP, "pool/allocate_release", n, n,
+          [&] { fill(pool); },
+          [&]
+          {
+            for (size_t i = 0U; i < n; ++i)
+            {
+              events[i] = pool.template allocate<Event>();
+            }
+
+            for (size_t i = 0U; i < n; ++i)
+            {
+              pool.release(events[i]);
+            }
+          });
+
+    h.run(GROUP, "ordered_pool/allocate_release", n, n,
+          [&] { fill(ordered); },
+          [&]
+          {
+            for (size_t i = 0U; i < n; ++i)
+            {
+              events[i] = ordered.template allocate<Event>();
+            }
+
+            for (size_t i = 0U; i < n; ++i)
+            {
+              ordered.release(events[i]);
+            }
+          });
+
+    h.run(GROUP, "ordered_pool/allocate_n_release_n", n, n,
+          [&] { fill(ordered); },
+          [&]
+          {
+            ordered.allocate_n(events, n);
+            ordered.release_n(events, n);
+          });
+  }
+
+  //***************************************************************************
+  /// Allocating and releasing blocks of mixed sizes.
+  //***************************************************************************
+  template <const size_t SIZE>
+  void slab_benchmarks(etl_benchmark::harness& h)
+  {
+    static etl::slab_allocator<SIZE * 64U, 4> slab;
+    static void*                              blocks[SIZE];
+    static size_t                             sizes[SIZE];
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      sizes[i] = 8U + ((i * 37U) % 56U);
+    }
+
+    h.run(GROUP, "slab_allocator/allocate_deallocate", SIZE, SIZE,
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              blocks[i] = slab.allocate(sizes[i]);
+            }
+
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              slab.deallocate(blocks[i]);
+            }
+          });
+
+    h.run(GROUP, "malloc/allocate_deallocate", SIZE, SIZE,
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              blocks[i] = malloc(sizes[i]);
+            }
+
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              free(blocks[i]);
+            }
+          });
+  }
+
+  //***************************************************************************
+  /// Scratch allocations freed all at once.
+  //***************************************************************************
+  template <const size_t SIZE>
+  void arena_benchmarks(etl_benchmark::harness& h)
+  {
+    static typename etl::aligned_storage<SIZE * 64U, 8U>::type buffer;
+    static etl::arena                                          arena(&buffer, sizeof(buffer));
+
+    h.run(GROUP, "arena/allocate_reset", SIZE, SIZE,
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              etl_benchmark::do_not_optimise(arena.allocate(8U + (i % 56U)));
+            }
+
+            arena.reset();
+          });
+  }
+
+  //***************************************************************************
+  /// Summing two fields of every record, stored as an array of structures
+  /// and as a structure of arrays.
+  //***************************************************************************
+  struct Particle
+  {
+    float    x;
+    float    y;
+    float    z;
+    float    vx;
+    float    vy;
+    float    vz;
+    float    mass;
+    uint32_t id;
+    uint32_t flags;
+  };
+
+  template <const size_t SIZE>
+  void soa_benchmarks(etl_benchmark::harness& h)
+  {
+    static etl::vector<Particle, SIZE> aos;
+    static etl::soa_vector<SIZE, float, float, float, float, float, float, float, uint32_t, uint32_t> soa;
+
+    aos.clear();
+    soa.clear();
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      const float f = float(i);
+      Particle p = { f, f, f, f, f, f, 1.0f, uint32_t(i), 0U };
+
+      aos.push_back(p);
+      soa.push_back(f, f, f, f, f, f, 1.0f, uint32_t(i), 0U);
+    }
+
+    h.run(GROUP, "aos_vector/sum_two_fields", SIZE, SIZE,
+          [&]
+          {
+            float sum = 0.0f;
+
+            for (size_t i = 0U; i < aos.size(); ++i)
+            {
+              sum += aos[i].x * aos[i].mass;
+            }
+
+            etl_benchmark::do_not_optimise(sum);
+          });
+
+    h.run(GROUP, "soa_vector/sum_two_fields", SIZE, SIZE,
+          [&]
+          {
+            const float* x    = soa.template data<0>();
+            const float* mass = soa.template data<6>();
+            const size_t n    = soa.size();
+
+            float sum = 0.0f;
+
+            for (size_t i = 0U; i < n; ++i)
+            {
+              sum += x[i] * mass[i];
+            }
+
+            etl_benchmark::do_not_optimise(sum);
+          });
+  }
+
+  //***************************************************************************
+  /// insert, find and erase by key.
+  //***************************************************************************
+  template <typename TMap>
+  void map_benchmarks(etl_benchmark::harness& h, const std::string& name, TMap& c, const std::vector<int>& keys)
+  {
+    typedef typename TMap::value_type value_type;
+
+    const size_t n = keys.size();
+
+    const auto fill = [&]
+    {
+      c.clear();
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        c.insert(value_type(keys[i], keys[i]));
+      }
+    };
+
+    h.run(GROUP, name + "/insert", n, n,
+          [&] { c.clear(); },
+          [&]
+          {
+            for (size_t i = 0U; i < n; ++i)
+            {
+              c.insert(value_type(keys[i], keys[i]));
+            }
+          });
+
+    h.run(GROUP, name + "/find", n, n,
+          fill,
+          [&]
+          {
+            for (size_t i = n; i > 0U; --i)
+            {
+              etl_benchmark::do_not_optimise(c.find(keys[i - 1U])->second);
+            }
+          });
+
+    h.run(GROUP, name + "/erase", n, n,
+          fill,
+          [&]
+          {
+            for (size_t i = 0U; i < n; ++i)
+            {
+              c.erase(keys[i]);
+            }
+          });
+  }
+
+  //***************************************************************************
+  /// A 64 byte trivially copyable element.
+  //***************************************************************************
+  struct Large
+  {
+    Large()
+    {
+    }
+
+    explicit Large(int i)
+      : value(i)
+    {
+    }
+
+    int  value;
+    char padding[60];
+  };
+
+  //***************************************************************************
+  /// An element with user defined copy and destruction, like a handle to a
+  /// resource. Copies are counted so that they are not optimised away.
+  //***************************************************************************
+  int handle_table[16];
+  size_t handle_copies;
+
+  struct Handle
+  {
+    explicit Handle(int i)
+      : p(&handle_table[i % 16])
+    {
+    }
+
+    Handle(const Handle& other)
+      : p(other.p)
+    {
+      ++handle_copies;
+    }
+
+    Handle& operator =(const Handle& other)
+    {
+      p = other.p;
+      ++handle_copies;
+      return *this;
+    }
+
+    ~Handle()
+    {
+      p = nullptr;
+    }
+
+    int* p;
+  };
+
+  //***************************************************************************
+  /// The same handle, declared trivially relocatable.
+  //***************************************************************************
+  struct RelocatableHandle : public Handle
+  {
+    explicit RelocatableHandle(int i)
+      : Handle(i)
+    {
+    }
+  };
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<RelocatableHandle> : etl::true_type
+  {
+  };
+}
+
+namespace
+{
+  //***************************************************************************
+  template <typename T>
+  T make_value(int i)
+  {
+    return T(i);
+  }
+
+  template <>
+  etl::string<16> make_value<etl::string<16> >(int i)
+  {
+    return etl::string<16>(std::to_string(i).c_str());
+  }
+
+  //***************************************************************************
+  /// Insert into and erase from the middle of a vector.
+  //***************************************************************************
+  template <typename T, const size_t SIZE>
+  void middle_benchmarks(etl_benchmark::harness& h, const std::string& name)
+  {
+    static etl::vector<T, SIZE> c;
+
+    std::vector<T> values;
+
+    for (size_t i = 0U; i < SIZE; ++i)
+    {
+      values.push_back(make_value<T>(int(i)));
+    }
+
+    const size_t half = SIZE / 2U;
+
+    h.run(GROUP, "vector_middle/" + name + "/insert", SIZE, half,
+          [&] { c.assign(values.begin(), values.begin() + half); },
+          [&]
+          {
+            for (size_t i = 0U; i < half; ++i)
+            {
+              c.insert(c.begin() + (c.size() / 2U), values[i]);
+            }
+          });
+
+    h.run(GROUP, "vector_middle/" + name + "/erase", SIZE, half,
+          [&] { c.assign(values.begin(), values.end()); },
+          [&]
+          {
+            for (size_t i = 0U; i < half; ++i)
+            {
+              c.erase(c.begin() + (c.size() / 2U));
+            }
+          });
+
+    etl_benchmark::do_not_optimise(handle_copies);
+  }
+
+  //***************************************************************************
+  template <const size_t SIZE>
+  void run_size(etl_benchmark::harness& h)
+  {
+    const std::vector<int> keys = make_keys(SIZE);
+
+    static etl::vector<int, SIZE>                  vector;
+    static etl::deque<int, SIZE>                   deque;
+    static etl::list<int, SIZE>                    list;
+    static etl::map<int, int, SIZE>                map;
+    static etl::flat_map<int, int, SIZE>           flat_map;
+    static etl::unordered_map<int, int, SIZE>      unordered_map;
+
+    sequence_benchmarks(h, "vector",        vector,        keys);
+    sequence_benchmarks(h, "deque",         deque,         keys);
+    deque_segment_benchmarks(h,             deque,         keys);
+    sequence_benchmarks(h, "list",          list,          keys);
+    map_benchmarks(h,      "map",           map,           keys);
+    map_benchmarks(h,      "flat_map",      flat_map,      keys);
+    map_benchmarks(h,      "unordered_map", unordered_map, keys);
+    locality_benchmarks(h,                  list,   map,   keys);
+    pool_benchmarks<SIZE>(h);
+    slab_benchmarks<SIZE>(h);
+    arena_benchmarks<SIZE>(h);
+    soa_benchmarks<SIZE>(h);
+
+    middle_benchmarks<int,               SIZE>(h, "int");
+    middle_benchmarks<Large,             SIZE>(h, "large_pod");
+    middle_benchmarks<etl::string<16>,   SIZE>(h, "string16");
+    middle_benchmarks<Handle,            SIZE>(h, "handle");
+    middle_benchmarks<RelocatableHandle, SIZE>(h, "relocatable_handle");
+  }
+}
+
+namespace etl_benchmark
+{
+  void run_container_benchmarks(harness& h)
+  {
+    run_size<64>(h);
+    run_size<1024>(h);
+  }
+}
@@ -0,0 +1,120 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "etl/crc8_ccitt.h"
+#include "etl/crc16.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc16_kermit.h"
+#include "etl/crc16_modbus.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+#include "etl/checksum.h"
+#include "etl/fnv_1.h"
+#include "etl/jenkins.h"
+#include "etl/murmur3.h"
+#include "etl/pearson.h"
+#include "etl/hash.h"
+#include "etl/string_view.h"
+
+#include "benchmark.h"
+
+namespace
+{
+  const char* const GROUP = "hashes";
+
+  //***************************************************************************
+  /// Times one hash over 'size' bytes. The time is per byte.
+  //***************************************************************************
+  template <typename THash>
+  void hash_benchmark(etl_benchmark::harness& h, const std::string& name, const std::vector<uint8_t>& data, size_t size)
+  {
+    h.run(GROUP, name, size, size,
+          [&]
+          {
+            THash hash;
+            hash.add(data.begin(), data.begin() + size);
+            etl_benchmark::do_not_optimise(hash.value());
+          });
+  }
+
+  //***************************************************************************
+  void run_size(etl_benchmark::harness& h, const std::vector<uint8_t>& data, size_t size)
+  {
+    hash_benchmark<etl::crc8_ccitt>(h,                   "crc8_ccitt",          data, size);
+    hash_benchmark<etl::crc16>(h,                        "crc16",               data, size);
+    hash_benchmark<etl::crc16_ccitt>(h,                  "crc16_ccitt",         data, size);
+    hash_benchmark<etl::crc16_kermit>(h,                 "crc16_kermit",        data, size);
+    hash_benchmark<etl::crc16_modbus>(h,                 "crc16_modbus",        data, size);
+    hash_benchmark<etl::crc32>(h,                        "crc32",               data, size);
+    hash_benchmark<etl::crc32_c>(h,                      "crc32_c",             data, size);
+    hash_benchmark<etl::crc64_ecma>(h,                   "crc64_ecma",          data, size);
+    hash_benchmark<etl::checksum<uint32_t> >(h,          "checksum",            data, size);
+    hash_benchmark<etl::bsd_checksum<uint16_t> >(h,      "bsd_checksum",        data, size);
+    hash_benchmark<etl::xor_checksum<uint8_t> >(h,       "xor_checksum",        data, size);
+    hash_benchmark<etl::xor_rotate_checksum<uint8_t> >(h, "xor_rotate_checksum", data, size);
+    hash_benchmark<etl::fnv_1_32>(h,                     "fnv_1_32",            data, size);
+    hash_benchmark<etl::fnv_1a_32>(h,                    "fnv_1a_32",           data, size);
+    hash_benchmark<etl::fnv_1_64>(h,                     "fnv_1_64",            data, size);
+    hash_benchmark<etl::fnv_1a_64>(h,                    "fnv_1a_64",           data, size);
+    hash_benchmark<etl::jenkins>(h,                      "jenkins",             data, size);
+    hash_benchmark<etl::murmur3<uint32_t> >(h,           "murmur3_32",          data, size);
+    hash_benchmark<etl::pearson<4> >(h,                  "pearson_4",           data, size);
+
+    const etl::string_view text(reinterpret_cast<const char*>(data.data()), size);
+
+    h.run(GROUP, "hash<string_view>", size, size,
+          [&]
+          {
+            etl_benchmark::do_not_optimise(etl::hash<etl::string_view>()(text));
+          });
+  }
+}
+
+namespace etl_benchmark
+{
+  void run_hash_benchmarks(harness& h)
+  {
+    std::vector<uint8_t> data(4096U);
+
+    uint32_t state = 0x9E3779B9U;
+
+    for (size_t i = 0U; i < data.size(); ++i)
+    {
+      state = (state * 1664525U) + 1013904223U;
+      data[i] = uint8_t(state >> 24);
+    }
+
+    run_size(h, data, 16U);
+    run_size(h, data, 256U);
+    run_size(h, data, 4096U);
+  }
+}
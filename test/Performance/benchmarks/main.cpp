@@ -0,0 +1,127 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+//*****************************************************************************
+// etl_benchmarks
+//
+// Usage: etl_benchmarks [--filter <text>] [--repetitions <n>] [--warmup <n>] [--json <file>]
+//
+// Prints a table of results. With --json the results are also written as
+// JSON to <file>, or to stdout if <file> is '-', for comparison between
+// releases.
+//*****************************************************************************
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <fstream>
+#include <iostream>
+
+#include "etl/version.h"
+
+#include "benchmark.h"
+
+namespace
+{
+  void usage()
+  {
+    std::cerr << "Usage: etl_benchmarks [--filter <text>] [--repetitions <n>] [--warmup <n>] [--json <file>]\n";
+  }
+}
+
+int main(int argc, char* argv[])
+{
+  etl_benchmark::options options;
+  std::string json_file;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const bool has_value = (i + 1) < argc;
+
+    if ((strcmp(argv[i], "--filter") == 0) && has_value)
+    {
+      options.filter = argv[++i];
+    }
+    else if ((strcmp(argv[i], "--repetitions") == 0) && has_value)
+    {
+      options.repetitions = size_t(strtoul(argv[++i], nullptr, 10));
+    }
+    else if ((strcmp(argv[i], "--warmup") == 0) && has_value)
+    {
+      options.warmup = size_t(strtoul(argv[++i], nullptr, 10));
+    }
+    else if ((strcmp(argv[i], "--json") == 0) && has_value)
+    {
+      json_file = argv[++i];
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if (options.repetitions == 0U)
+  {
+    usage();
+    return 1;
+  }
+
+  etl_benchmark::harness harness(options);
+
+  etl_benchmark::run_container_benchmarks(harness);
+  etl_benchmark::run_queue_benchmarks(harness);
+  etl_benchmark::run_hash_benchmarks(harness);
+  etl_benchmark::run_string_benchmarks(harness);
+  etl_benchmark::run_timer_benchmarks(harness);
+  etl_benchmark::run_random_benchmarks(harness);
+
+  if (json_file == "-")
+  {
+    harness.write_json(std::cout, ETL_VERSION);
+  }
+  else
+  {
+    harness.write_table(std::cout);
+
+    if (!json_file.empty())
+    {
+      std::ofstream file(json_file.c_str());
+
+      if (!file)
+      {
+        std::cerr << "Cannot open " << json_file << "\n";
+        return 1;
+      }
+
+      harness.write_json(file, ETL_VERSION);
+    }
+  }
+
+  return 0;
+}
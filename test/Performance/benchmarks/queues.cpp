@@ -0,0 +1,364 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "etl/queue.h"
+#include "etl/priority_queue.h"
+#include "etl/dary_heap.h"
+#include "etl/indexed_priority_queue.h"
+#include "etl/intrusive_queue.h"
+#include "etl/queue_spsc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+#include "etl/queue_spsc_isr.h"
+#include "etl/queue_spsc_locked.h"
+#include "etl/function.h"
+
+#include "benchmark.h"
+
+namespace
+{
+  const char* const GROUP = "queues";
+
+  const size_t SIZE  = 256U;
+  const size_t ITEMS = 100000U;
+
+  //***************************************************************************
+  /// Lock and unlock that do nothing, for single threaded use.
+  //***************************************************************************
+  struct NoLock
+  {
+    static void lock()   {}
+    static void unlock() {}
+  };
+
+  //***************************************************************************
+  /// Lock and unlock with a mutex, standing in for interrupt control.
+  //***************************************************************************
+  struct MutexLock
+  {
+    static void lock()   { mutex.lock(); }
+    static void unlock() { mutex.unlock(); }
+
+    static std::mutex mutex;
+  };
+
+  std::mutex MutexLock::mutex;
+
+  etl::function_fv<&NoLock::lock>      no_lock;
+  etl::function_fv<&NoLock::unlock>    no_unlock;
+  etl::function_fv<&MutexLock::lock>   mutex_lock;
+  etl::function_fv<&MutexLock::unlock> mutex_unlock;
+
+  //***************************************************************************
+  /// An item for the intrusive queue.
+  //***************************************************************************
+  struct Item : public etl::forward_link<0>
+  {
+    int value;
+  };
+
+  //***************************************************************************
+  /// Adaptors giving every queue the same try_push/try_pop interface.
+  //***************************************************************************
+  template <typename TQueue>
+  bool try_push(TQueue& queue, int value)
+  {
+    return queue.push(value);
+  }
+
+  template <typename TQueue>
+  bool try_pop(TQueue& queue, int& value)
+  {
+    return queue.pop(value);
+  }
+
+  bool try_push(etl::iqueue<int>& queue, int value)
+  {
+    if (queue.full())
+    {
+      return false;
+    }
+
+    queue.push(value);
+    return true;
+  }
+
+  bool try_pop(etl::iqueue<int>& queue, int& value)
+  {
+    if (queue.empty())
+    {
+      return false;
+    }
+
+    value = queue.front();
+    queue.pop();
+    return true;
+  }
+
+  bool try_push(etl::ipriority_queue<int, etl::vector<int, SIZE> >& queue, int value)
+  {
+    if (queue.full())
+    {
+      return false;
+    }
+
+    queue.push(value);
+    return true;
+  }
+
+  bool try_pop(etl::ipriority_queue<int, etl::vector<int, SIZE> >& queue, int& value)
+  {
+    if (queue.empty())
+    {
+      return false;
+    }
+
+    value = queue.top();
+    queue.pop();
+    return true;
+  }
+
+  //***************************************************************************
+  /// Fills then empties the queue, in one thread.
+  //***************************************************************************
+  template <typename TQueue>
+  void single_thread(etl_benchmark::harness& h, const std::string& name, TQueue& queue)
+  {
+    h.run(GROUP, name + "/fill_drain", SIZE, 2U * SIZE,
+          [&]
+          {
+            int value = 0;
+
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              try_push(queue, int(i));
+            }
+
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              try_pop(queue, value);
+              etl_benchmark::do_not_optimise(value);
+            }
+          });
+  }
+
+  //***************************************************************************
+  /// One thread pushes ITEMS values while the other pops them.
+  //***************************************************************************
+  template <typename TQueue, typename TPush>
+  void cross_thread(etl_benchmark::harness& h, const std::string& name, TQueue& queue, TPush push)
+  {
+    h.run(GROUP, name + "/cross_thread", SIZE, ITEMS,
+          [&]
+          {
+            std::thread producer([&]
+            {
+              for (size_t i = 0U; i < ITEMS; ++i)
+              {
+                while (!push(queue, int(i)))
+                {
+                  std::this_thread::yield();
+                }
+              }
+            });
+
+            int value = 0;
+
+            for (size_t i = 0U; i < ITEMS; ++i)
+            {
+              while (!try_pop(queue, value))
+              {
+                std::this_thread::yield();
+              }
+            }
+
+            producer.join();
+            etl_benchmark::do_not_optimise(value);
+          });
+  }
+
+  //***************************************************************************
+  /// Pseudo random keys.
+  //***************************************************************************
+  std::vector<int> make_keys(size_t n, uint32_t state)
+  {
+    std::vector<int> keys(n);
+
+    for (size_t i = 0U; i < n; ++i)
+    {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      keys[i] = int(state % 100000U);
+    }
+
+    return keys;
+  }
+
+  //***************************************************************************
+  /// Pushes random keys then pops them, and replaces the top with a new key,
+  /// as a scheduler does when it reschedules the next event.
+  //***************************************************************************
+  template <typename THeap>
+  void heap_benchmarks(etl_benchmark::harness& h, const std::string& name, THeap& heap, const std::vector<int>& keys, const std::vector<int>& new_keys)
+  {
+    h.run(GROUP, name + "/random_fill_drain", SIZE, 2U * SIZE,
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              heap.push(keys[i]);
+            }
+
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              etl_benchmark::do_not_optimise(heap.top());
+              heap.pop();
+            }
+          });
+
+    h.run(GROUP, name + "/reschedule_top", SIZE, SIZE,
+          [&] { heap.assign(keys.begin(), keys.end()); },
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              heap.pop();
+              heap.push(new_keys[i]);
+            }
+
+            etl_benchmark::do_not_optimise(heap.top());
+          });
+  }
+
+  //***************************************************************************
+  /// The producer is the 'interrupt'.
+  //***************************************************************************
+  bool push_from_isr(etl::iqueue_spsc_isr<int, MutexLock>& queue, int value)
+  {
+    MutexLock::lock();
+    const bool pushed = queue.push_from_isr(value);
+    MutexLock::unlock();
+
+    return pushed;
+  }
+}
+
+namespace etl_benchmark
+{
+  void run_queue_benchmarks(harness& h)
+  {
+    // Single threaded.
+    static etl::queue<int, SIZE>                        queue;
+    static etl::priority_queue<int, SIZE>               priority_queue;
+    static etl::queue_spsc_atomic<int, SIZE>            spsc_atomic;
+    static etl::queue_mpmc_mutex<int, SIZE>             mpmc_mutex;
+    static etl::queue_spsc_isr<int, SIZE, NoLock>       spsc_isr;
+    static etl::queue_spsc_locked<int, SIZE>            spsc_locked(no_lock, no_unlock);
+
+    single_thread(h, "queue",             static_cast<etl::iqueue<int>&>(queue));
+    single_thread(h, "priority_queue",    static_cast<etl::ipriority_queue<int, etl::vector<int, SIZE> >&>(priority_queue));
+    single_thread(h, "queue_spsc_atomic", spsc_atomic);
+    single_thread(h, "queue_mpmc_mutex",  mpmc_mutex);
+    single_thread(h, "queue_spsc_isr",    spsc_isr);
+    single_thread(h, "queue_spsc_locked", spsc_locked);
+
+    // Heaps.
+    const std::vector<int> keys     = make_keys(SIZE, 0x12345678U);
+    const std::vector<int> new_keys = make_keys(SIZE, 0x87654321U);
+
+    static etl::priority_queue<int, SIZE>               binary_heap;
+    static etl::dary_heap<int, SIZE, 2>                 dary_heap_2;
+    static etl::dary_heap<int, SIZE, 4>                 dary_heap_4;
+    static etl::indexed_priority_queue<int, SIZE>       indexed_queue;
+
+    heap_benchmarks(h, "priority_queue",         binary_heap,   keys, new_keys);
+    heap_benchmarks(h, "dary_heap_2",            dary_heap_2,   keys, new_keys);
+    heap_benchmarks(h, "dary_heap_4",            dary_heap_4,   keys, new_keys);
+    heap_benchmarks(h, "indexed_priority_queue", indexed_queue, keys, new_keys);
+
+    h.run(GROUP, "indexed_priority_queue/update_top", SIZE, SIZE,
+          [&] { indexed_queue.assign(keys.begin(), keys.end()); },
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              indexed_queue.update_priority(indexed_queue.top_handle(), new_keys[i]);
+            }
+
+            etl_benchmark::do_not_optimise(indexed_queue.top());
+          });
+
+    h.run(GROUP, "indexed_priority_queue/update_any", SIZE, SIZE,
+          [&] { indexed_queue.assign(keys.begin(), keys.end()); },
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              indexed_queue.update_priority((i * 7U) % SIZE, new_keys[i]);
+            }
+
+            etl_benchmark::do_not_optimise(indexed_queue.top());
+          });
+
+    static Item items[SIZE];
+    static etl::intrusive_queue<Item, etl::forward_link<0> > intrusive_queue;
+
+    h.run(GROUP, "intrusive_queue/fill_drain", SIZE, 2U * SIZE,
+          [&]
+          {
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              items[i].value = int(i);
+              intrusive_queue.push(items[i]);
+            }
+
+            for (size_t i = 0U; i < SIZE; ++i)
+            {
+              etl_benchmark::do_not_optimise(intrusive_queue.front().value);
+              intrusive_queue.pop();
+            }
+          });
+
+    // Cross thread, for the queues that may be shared between threads or contexts.
+    static etl::queue_spsc_atomic<int, SIZE>            spsc_atomic_shared;
+    static etl::queue_mpmc_mutex<int, SIZE>             mpmc_mutex_shared;
+    static etl::queue_spsc_isr<int, SIZE, MutexLock>    spsc_isr_shared;
+    static etl::queue_spsc_locked<int, SIZE>            spsc_locked_shared(mutex_lock, mutex_unlock);
+
+    cross_thread(h, "queue_spsc_atomic", spsc_atomic_shared, try_push<etl::queue_spsc_atomic<int, SIZE> >);
+    cross_thread(h, "queue_mpmc_mutex",  mpmc_mutex_shared,  try_push<etl::queue_mpmc_mutex<int, SIZE> >);
+    cross_thread(h, "queue_spsc_isr",    static_cast<etl::iqueue_spsc_isr<int, MutexLock>&>(spsc_isr_shared), push_from_isr);
+    cross_thread(h, "queue_spsc_locked", spsc_locked_shared, try_push<etl::queue_spsc_locked<int, SIZE> >);
+  }
+}
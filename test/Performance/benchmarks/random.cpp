@@ -0,0 +1,119 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <vector>
+
+#include "etl/random.h"
+
+#include "benchmark.h"
+
+namespace
+{
+  const char* const GROUP = "random";
+
+  const size_t COUNT = 4096U;
+
+  //***************************************************************************
+  /// Calls operator() for each number.
+  //***************************************************************************
+  template <typename TGenerator, typename T>
+  void call_benchmark(etl_benchmark::harness& h, const char* name)
+  {
+    static TGenerator generator(1234U);
+    std::vector<T> out(COUNT);
+
+    h.run(GROUP, name, COUNT, COUNT,
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              out[i] = generator();
+            }
+
+            etl_benchmark::do_not_optimise(out[COUNT - 1U]);
+          });
+  }
+
+  //***************************************************************************
+  /// Writes the numbers with fill().
+  //***************************************************************************
+  template <typename TGenerator, typename T>
+  void fill_benchmark(etl_benchmark::harness& h, const char* name)
+  {
+    static TGenerator generator(1234U);
+    std::vector<T> out(COUNT);
+
+    h.run(GROUP, name, COUNT, COUNT,
+          [&]
+          {
+            generator.fill(out.data(), COUNT);
+            etl_benchmark::do_not_optimise(out[COUNT - 1U]);
+          });
+  }
+
+  //***************************************************************************
+  /// Numbers in a range that is not a power of two.
+  //***************************************************************************
+  template <typename TGenerator>
+  void range_benchmark(etl_benchmark::harness& h, const char* name)
+  {
+    static TGenerator generator(1234U);
+    std::vector<uint32_t> out(COUNT);
+
+    h.run(GROUP, name, COUNT, COUNT,
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              out[i] = generator.range(1U, 1000U);
+            }
+
+            etl_benchmark::do_not_optimise(out[COUNT - 1U]);
+          });
+  }
+}
+
+namespace etl_benchmark
+{
+  void run_random_benchmarks(harness& h)
+  {
+    call_benchmark<etl::random_xorshift, uint32_t>(h, "xorshift/call");
+    fill_benchmark<etl::random_xorshift, uint32_t>(h, "xorshift/fill");
+    call_benchmark<etl::random_xorshift_lanes<8>, uint32_t>(h, "xorshift_lanes<8>/call");
+    fill_benchmark<etl::random_xorshift_lanes<8>, uint32_t>(h, "xorshift_lanes<8>/fill");
+    fill_benchmark<etl::random_xorshift_lanes<16>, uint32_t>(h, "xorshift_lanes<16>/fill");
+    call_benchmark<etl::random_pcg, uint32_t>(h, "pcg/call");
+    fill_benchmark<etl::random_pcg, uint32_t>(h, "pcg/fill");
+    fill_benchmark<etl::random_xoshiro256ss, uint64_t>(h, "xoshiro256ss/fill");
+    fill_benchmark<etl::random_pcg64, uint64_t>(h, "pcg64/fill");
+
+    range_benchmark<etl::random_xorshift>(h, "xorshift/range");
+    range_benchmark<etl::random_lcg>(h, "lcg/range");
+    range_benchmark<etl::random_pcg>(h, "pcg/range");
+  }
+}
@@ -0,0 +1,173 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <string>
+#include <vector>
+
+#include "etl/cstring.h"
+#include "etl/string_view.h"
+#include "etl/to_string.h"
+#include "etl/format_spec.h"
+#include "etl/format.h"
+#include "etl/from_chars.h"
+
+#include "benchmark.h"
+
+namespace
+{
+  const char* const GROUP = "strings";
+
+  const size_t COUNT = 1000U;
+
+  //***************************************************************************
+  /// Values with a spread of magnitudes.
+  //***************************************************************************
+  struct Values
+  {
+    Values()
+      : integers(COUNT),
+        doubles(COUNT)
+    {
+      uint64_t state = 0x0123456789ABCDEFULL;
+
+      for (size_t i = 0U; i < COUNT; ++i)
+      {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        integers[i] = int32_t(state) >> (state % 31U);
+        doubles[i]  = double(int32_t(state >> 32)) / double(1U + (state % 100000U));
+      }
+    }
+
+    std::vector<int32_t> integers;
+    std::vector<double>  doubles;
+  };
+}
+
+namespace etl_benchmark
+{
+  void run_string_benchmarks(harness& h)
+  {
+    static const Values values;
+
+    static etl::string<64>   text;
+    static etl::string<4096> long_text;
+
+    h.run(GROUP, "to_string/int32", COUNT, COUNT,
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              etl::to_string(values.integers[i], text);
+              etl_benchmark::do_not_optimise(text[0]);
+            }
+          });
+
+    h.run(GROUP, "to_string/int32_hex", COUNT, COUNT,
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              etl::to_string(values.integers[i], text, etl::format_spec().hex().width(8).fill('0'));
+              etl_benchmark::do_not_optimise(text[0]);
+            }
+          });
+
+    h.run(GROUP, "to_string/double", COUNT, COUNT,
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              etl::to_string(values.doubles[i], text);
+              etl_benchmark::do_not_optimise(text[0]);
+            }
+          });
+
+    h.run(GROUP, "format_to/int_hex_text", COUNT, COUNT,
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              text.clear();
+              etl::format_to(text, "id={} value={:x} {}", i, values.integers[i], "text");
+              etl_benchmark::do_not_optimise(text[0]);
+            }
+          });
+
+    static std::vector<etl::string<16> > numbers(COUNT);
+
+    for (size_t i = 0U; i < COUNT; ++i)
+    {
+      etl::to_string(values.integers[i], numbers[i]);
+    }
+
+    h.run(GROUP, "from_chars/int32", COUNT, COUNT,
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              int32_t value = 0;
+              etl::from_chars(numbers[i].data(), numbers[i].data() + numbers[i].size(), value);
+              etl_benchmark::do_not_optimise(value);
+            }
+          });
+
+    h.run(GROUP, "append/short", COUNT, COUNT,
+          [&] { long_text.clear(); },
+          [&]
+          {
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              long_text.append("abcd");
+            }
+          });
+
+    long_text.assign(4095U, 'a');
+    long_text.push_back('b');
+
+    h.run(GROUP, "find/char", long_text.size(), long_text.size(),
+          [&]
+          {
+            etl_benchmark::do_not_optimise(long_text.find('b'));
+          });
+
+    h.run(GROUP, "find/substring", long_text.size(), long_text.size(),
+          [&]
+          {
+            etl_benchmark::do_not_optimise(long_text.find("aab"));
+          });
+
+    h.run(GROUP, "strlen", long_text.size(), long_text.size(),
+          [&]
+          {
+            etl_benchmark::do_not_optimise(etl::strlen(long_text.c_str()));
+          });
+  }
+}
@@ -0,0 +1,153 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include <string>
+
+#define ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK
+#define ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK
+
+#include "etl/callback_timer.h"
+#include "etl/message_timer.h"
+#include "etl/message_router.h"
+#include "etl/message.h"
+
+#include "benchmark.h"
+
+namespace
+{
+  const char* const GROUP = "timers";
+
+  const size_t TICKS = 1000U;
+
+  uint32_t callbacks = 0U;
+
+  void callback()
+  {
+    ++callbacks;
+  }
+
+  struct Tick : public etl::message<1>
+  {
+  };
+
+  Tick tick_message;
+
+  //***************************************************************************
+  /// Counts the messages sent by the timer.
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Tick>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Tick&)
+    {
+      ++received;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    uint32_t received = 0U;
+  };
+
+  Router router;
+
+  //***************************************************************************
+  /// Ticks the timer with MAX_TIMERS repeating timers of different periods.
+  //***************************************************************************
+  template <uint_least8_t MAX_TIMERS>
+  void callback_timer_benchmark(etl_benchmark::harness& h)
+  {
+    static etl::callback_timer<MAX_TIMERS> timers;
+
+    for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+    {
+      timers.start(timers.register_timer(callback, uint32_t(i) + 1U, etl::timer::mode::REPEATING));
+    }
+
+    timers.enable(true);
+
+    h.run(GROUP, "callback_timer/tick", MAX_TIMERS, TICKS,
+          [&]
+          {
+            for (size_t i = 0U; i < TICKS; ++i)
+            {
+              timers.tick(1U);
+            }
+          });
+
+    timers.clear();
+    etl_benchmark::do_not_optimise(callbacks);
+  }
+
+  //***************************************************************************
+  template <uint_least8_t MAX_TIMERS>
+  void message_timer_benchmark(etl_benchmark::harness& h)
+  {
+    static etl::message_timer<MAX_TIMERS> timers;
+
+    for (uint_least8_t i = 0U; i < MAX_TIMERS; ++i)
+    {
+      timers.start(timers.register_timer(tick_message, router, uint32_t(i) + 1U, etl::timer::mode::REPEATING));
+    }
+
+    timers.enable(true);
+
+    h.run(GROUP, "message_timer/tick", MAX_TIMERS, TICKS,
+          [&]
+          {
+            for (size_t i = 0U; i < TICKS; ++i)
+            {
+              timers.tick(1U);
+            }
+          });
+
+    timers.clear();
+    etl_benchmark::do_not_optimise(router.received);
+  }
+}
+
+namespace etl_benchmark
+{
+  void run_timer_benchmarks(harness& h)
+  {
+    callback_timer_benchmark<8>(h);
+    callback_timer_benchmark<64>(h);
+    callback_timer_benchmark<250>(h);
+
+    message_timer_benchmark<8>(h);
+    message_timer_benchmark<64>(h);
+    message_timer_benchmark<250>(h);
+  }
+}
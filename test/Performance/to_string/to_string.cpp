@@ -0,0 +1,198 @@
+// to_string.cpp : Throughput and correctness of floating point etl::to_string.
+//
+// Build with the ETL include directory and a profile, for example:
+//   g++ -O2 -std=c++11 -I../../../include -I../.. to_string.cpp -o to_string
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "etl/to_string.h"
+#include "etl/cstring.h"
+#include "etl/format_spec.h"
+
+const size_t TESTSIZE        = 1000000;
+const size_t TESTINTERATIONS = 4;
+
+std::chrono::steady_clock::time_point begin;
+
+void StartTimer()
+{
+  begin = std::chrono::steady_clock::now();
+}
+
+uint64_t StopTimer()
+{
+  return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count();
+}
+
+//*****************************************************************************
+// Random finite doubles, spread over the whole exponent range.
+//*****************************************************************************
+std::vector<double> MakeValues()
+{
+  std::vector<double> values;
+  values.reserve(TESTSIZE);
+
+  uint64_t bits = 0x0123456789ABCDEFULL;
+
+  while (values.size() < TESTSIZE)
+  {
+    bits ^= bits << 13;
+    bits ^= bits >> 7;
+    bits ^= bits << 17;
+
+    double value;
+    memcpy(&value, &bits, sizeof(value));
+
+    if (std::isfinite(value))
+    {
+      values.push_back(value);
+    }
+  }
+
+  return values;
+}
+
+//*****************************************************************************
+// The fewest significant digits that round trip, found with printf.
+//*****************************************************************************
+int ShortestDigits(double value)
+{
+  char buffer[32];
+
+  for (int precision = 1; precision < 17; ++precision)
+  {
+    snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+
+    if (strtod(buffer, nullptr) == value)
+    {
+      return precision;
+    }
+  }
+
+  return 17;
+}
+
+//*****************************************************************************
+// The significant digits in formatted text.
+//*****************************************************************************
+int CountDigits(const char* text)
+{
+  // Skip the sign and leading zeros.
+  while ((*text == '-') || (*text == '0') || (*text == '.'))
+  {
+    ++text;
+  }
+
+  int digits = 0;
+  int zeros  = 0;
+
+  for (; (*text != '\0') && (*text != 'e'); ++text)
+  {
+    if (*text == '0')
+    {
+      ++zeros;
+    }
+    else if (*text != '.')
+    {
+      digits += zeros + 1;
+      zeros   = 0;
+    }
+  }
+
+  return (digits == 0) ? 1 : digits;
+}
+
+int main()
+{
+  std::vector<double> values = MakeValues();
+
+  etl::string<32>  str;
+  etl::format_spec shortest = etl::format_spec().shortest(true);
+  etl::format_spec precise  = etl::format_spec().precision(15);
+
+  // Correctness.
+  size_t not_round_trip = 0;
+  size_t not_shortest   = 0;
+
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    etl::to_string(values[i], str, shortest);
+
+    char text[32];
+    memcpy(text, str.data(), str.size());
+    text[str.size()] = '\0';
+
+    const double result = strtod(text, nullptr);
+
+    if (memcmp(&result, &values[i], sizeof(result)) != 0)
+    {
+      ++not_round_trip;
+    }
+
+    if ((i % 10) == 0)
+    {
+      if (CountDigits(text) > ShortestDigits(values[i]))
+      {
+        ++not_shortest;
+      }
+    }
+  }
+
+  std::cout << "Not round trip = " << not_round_trip << " of " << values.size() << "\n";
+  std::cout << "Not shortest   = " << not_shortest << " of " << (values.size() / 10) << "\n";
+
+  // Throughput.
+  uint64_t time;
+  size_t   total = 0;
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    for (size_t j = 0; j < values.size(); ++j)
+    {
+      etl::to_string(values[j], str, shortest);
+      total += str.size();
+    }
+  }
+
+  time = StopTimer();
+  std::cout << "ETL shortest Time  = " << time << "ms\n";
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    for (size_t j = 0; j < values.size(); ++j)
+    {
+      // The fixed format can only represent values that fit in an int64_t.
+      etl::to_string(std::fmod(values[j], 1e15), str, precise);
+      total += str.size();
+    }
+  }
+
+  time = StopTimer();
+  std::cout << "ETL precision Time = " << time << "ms\n";
+
+  StartTimer();
+
+  for (size_t i = 0; i < TESTINTERATIONS; ++i)
+  {
+    for (size_t j = 0; j < values.size(); ++j)
+    {
+      char text[32];
+      total += size_t(snprintf(text, sizeof(text), "%.17g", values[j]));
+    }
+  }
+
+  time = StopTimer();
+  std::cout << "printf %.17g Time  = " << time << "ms\n";
+
+  return (total == 0) || (not_round_trip != 0);
+}
@@ -0,0 +1,317 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <string>
+#include <vector>
+
+#include "etl/arena.h"
+#include "etl/vector.h"
+#include "etl/indirect_vector.h"
+#include "etl/pool.h"
+#include "etl/cstring.h"
+
+namespace
+{
+  std::vector<int> destroyed;
+
+  struct Tracked
+  {
+    Tracked(int id_, const std::string& text_)
+      : id(id_),
+        text(text_)
+    {
+    }
+
+    ~Tracked()
+    {
+      destroyed.push_back(id);
+    }
+
+    int         id;
+    std::string text;
+  };
+
+  struct Pod
+  {
+    int a;
+    int b;
+  };
+
+  SUITE(test_arena)
+  {
+    //*************************************************************************
+    TEST(test_allocate_aligned)
+    {
+      etl::aligned_storage<256, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      CHECK_EQUAL(256U, arena.capacity());
+      CHECK_EQUAL(0U, arena.size());
+
+      void* p1 = arena.allocate(1U, 1U);
+      void* p2 = arena.allocate(4U, 4U);
+      void* p3 = arena.allocate(8U);
+
+      CHECK((reinterpret_cast<uintptr_t>(p2) % 4U) == 0U);
+      CHECK((reinterpret_cast<uintptr_t>(p3) % etl::alignment_of<double>::value) == 0U);
+      CHECK(static_cast<char*>(p2) > static_cast<char*>(p1));
+      CHECK(static_cast<char*>(p3) > static_cast<char*>(p2));
+
+      CHECK_EQUAL(size_t((static_cast<char*>(p3) + 8) - reinterpret_cast<char*>(&buffer)), arena.size());
+      CHECK_EQUAL(arena.capacity() - arena.size(), arena.available());
+      CHECK_EQUAL(arena.size(), arena.peak());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_no_space)
+    {
+      etl::aligned_storage<64, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      arena.allocate(60U, 1U);
+
+      CHECK_THROW(arena.allocate(8U), etl::arena_no_allocation);
+      CHECK_EQUAL(60U, arena.size());
+
+      // Still room for a small unaligned allocation.
+      CHECK(arena.allocate(4U, 1U) != nullptr);
+      CHECK_EQUAL(0U, arena.available());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_array_for_external_vector)
+    {
+      etl::aligned_storage<256, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      etl::vector<int, 0> data(arena.allocate_array<int>(16U), 16U);
+
+      for (int i = 0; i < 16; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(data.full());
+      CHECK_EQUAL(15, data.back());
+      CHECK_EQUAL(16U * sizeof(int), arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_create_trivial)
+    {
+      etl::aligned_storage<256, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      Pod* p = arena.create<Pod>();
+      p->a = 1;
+      p->b = 2;
+
+      // No destructor is registered for trivial types.
+      CHECK_EQUAL(sizeof(Pod), arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_create_and_reset_destroys_in_reverse_order)
+    {
+      destroyed.clear();
+
+      etl::aligned_storage<1024, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      Tracked* p1 = arena.create<Tracked>(1, std::string("one"));
+      Tracked* p2 = arena.create<Tracked>(2, std::string("two"));
+      Tracked* p3 = arena.create<Tracked>(3, std::string("three"));
+
+      CHECK_EQUAL(1, p1->id);
+      CHECK_EQUAL(std::string("two"), p2->text);
+      CHECK_EQUAL(std::string("three"), p3->text);
+
+      arena.reset();
+
+      CHECK_EQUAL(3U, destroyed.size());
+      CHECK_EQUAL(3, destroyed[0]);
+      CHECK_EQUAL(2, destroyed[1]);
+      CHECK_EQUAL(1, destroyed[2]);
+      CHECK_EQUAL(0U, arena.size());
+      CHECK(arena.peak() > 0U);
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_destroys_objects)
+    {
+      destroyed.clear();
+
+      {
+        etl::aligned_storage<1024, 8>::type buffer;
+        etl::arena arena(&buffer, sizeof(buffer));
+
+        arena.create<Tracked>(1, std::string("one"));
+      }
+
+      CHECK_EQUAL(1U, destroyed.size());
+    }
+
+    //*************************************************************************
+    TEST(test_checkpoint_rollback)
+    {
+      destroyed.clear();
+
+      etl::aligned_storage<1024, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      arena.create<Tracked>(1, std::string("one"));
+
+      etl::arena::checkpoint cp = arena.get_checkpoint();
+      size_t size = arena.size();
+
+      arena.create<Tracked>(2, std::string("two"));
+      arena.allocate(100U);
+      arena.create<Tracked>(3, std::string("three"));
+
+      arena.rollback(cp);
+
+      CHECK_EQUAL(size, arena.size());
+      CHECK_EQUAL(2U, destroyed.size());
+      CHECK_EQUAL(3, destroyed[0]);
+      CHECK_EQUAL(2, destroyed[1]);
+
+      // Space is reused.
+      Tracked* p = arena.create<Tracked>(4, std::string("four"));
+      CHECK_EQUAL(4, p->id);
+
+      arena.reset();
+      CHECK_EQUAL(4U, destroyed.size());
+      CHECK_EQUAL(1, destroyed[3]);
+    }
+
+    //*************************************************************************
+    TEST(test_rollback_invalid_checkpoint)
+    {
+      etl::aligned_storage<256, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      arena.allocate(16U);
+      etl::arena::checkpoint cp = arena.get_checkpoint();
+      arena.reset();
+
+      CHECK_THROW(arena.rollback(cp), etl::arena_invalid_checkpoint);
+    }
+
+    //*************************************************************************
+    TEST(test_scope)
+    {
+      destroyed.clear();
+
+      etl::aligned_storage<1024, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      arena.allocate(8U);
+
+      {
+        etl::arena_scope scope(arena);
+
+        arena.create<Tracked>(1, std::string("one"));
+
+        {
+          etl::arena_scope inner(arena);
+
+          arena.create<Tracked>(2, std::string("two"));
+        }
+
+        CHECK_EQUAL(1U, destroyed.size());
+        CHECK_EQUAL(2, destroyed[0]);
+      }
+
+      CHECK_EQUAL(2U, destroyed.size());
+      CHECK_EQUAL(1, destroyed[1]);
+      CHECK_EQUAL(8U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_overflow_buffer)
+    {
+      etl::aligned_storage<64, 8>::type buffer;
+      etl::aligned_storage<128, 8>::type overflow;
+      etl::arena arena(&buffer, sizeof(buffer), &overflow, sizeof(overflow));
+
+      CHECK_EQUAL(192U, arena.capacity());
+
+      char* p1 = static_cast<char*>(arena.allocate(48U));
+      CHECK(!arena.is_overflowing());
+
+      etl::arena::checkpoint cp = arena.get_checkpoint();
+
+      // Does not fit in the remaining 16 bytes.
+      char* p2 = static_cast<char*>(arena.allocate(32U));
+      CHECK(arena.is_overflowing());
+      CHECK(p2 == reinterpret_cast<char*>(&overflow));
+      CHECK_EQUAL(64U + 32U, arena.size());
+
+      // Allocations stay in the overflow buffer.
+      char* p3 = static_cast<char*>(arena.allocate(8U));
+      CHECK(p3 == p2 + 32);
+
+      CHECK_THROW(arena.allocate(128U), etl::arena_no_allocation);
+
+      arena.rollback(cp);
+      CHECK(!arena.is_overflowing());
+      CHECK_EQUAL(48U, arena.size());
+      CHECK(static_cast<char*>(arena.allocate(16U)) == p1 + 48);
+    }
+
+    //*************************************************************************
+    TEST(test_containers_in_arena)
+    {
+      etl::aligned_storage<2048, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      typedef etl::vector<int*, 8> Lookup;
+      typedef etl::pool<int, 8>    Pool;
+
+      Lookup* p_lookup = arena.create<Lookup>();
+      Pool*   p_pool   = arena.create<Pool>();
+
+      etl::indirect_vector<int, 0> data(*p_lookup, *p_pool);
+
+      data.push_back(1);
+      data.push_back(2);
+
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(2U, p_pool->size());
+
+      etl::string<16>* p_text = arena.create<etl::string<16> >("hello");
+      CHECK(*p_text == "hello");
+      CHECK(arena.allocate(1U) > static_cast<void*>(p_text));
+
+      data.clear();
+    }
+  };
+}
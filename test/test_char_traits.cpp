@@ -0,0 +1,370 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <string>
+#include <vector>
+
+#include "etl/char_traits.h"
+
+namespace
+{
+  //***************************************************************************
+  // Fills the buffer with non-zero characters, using values above 0x7F in each byte.
+  //***************************************************************************
+  template <typename T>
+  void fill(std::vector<T>& buffer)
+  {
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+      const unsigned long value = (i % 3 == 0) ? 0x80UL + (i % 0x7F) : 'a' + (i % 26);
+      buffer[i] = T(value | (sizeof(T) > 1 ? (value << 8) : 0));
+    }
+  }
+
+  //***************************************************************************
+  // The searches used by char_traits.
+  //***************************************************************************
+  template <typename T>
+  struct traits_search
+  {
+    static size_t length(const T* str)
+    {
+      return etl::char_traits<T>::length(str);
+    }
+
+    static int compare(const T* s1, const T* s2, size_t count)
+    {
+      return etl::char_traits<T>::compare(s1, s2, count);
+    }
+
+    static const T* find(const T* p, size_t count, const T c)
+    {
+      return etl::char_traits<T>::find(p, count, c);
+    }
+  };
+
+  //***************************************************************************
+  // The searches with the SIMD and word at a time versions chosen by the tags,
+  // whatever the profile selects.
+  //***************************************************************************
+  template <typename T, typename TBlocks, typename TWords>
+  struct forced_search
+  {
+    static size_t length(const T* str)
+    {
+      return etl::private_string_search::length(str, TBlocks(), TWords());
+    }
+
+    static int compare(const T* s1, const T* s2, size_t count)
+    {
+      return etl::private_string_search::compare(s1, s2, count, TBlocks(), TWords());
+    }
+
+    static const T* find(const T* p, size_t count, const T c)
+    {
+      const T* last   = p + count;
+      const T* result = etl::private_string_search::find_char(p, last, c, TBlocks(), TWords());
+
+      return (result == last) ? nullptr : result;
+    }
+  };
+
+  //***************************************************************************
+  // The SIMD, word at a time and scalar searches.
+  //***************************************************************************
+  template <typename T>
+  struct search_kernels
+  {
+    typedef typename etl::private_string_search::has_simd<T>::type                                  simd_t;
+    typedef etl::integral_constant<bool, (sizeof(T) < sizeof(etl::private_string_search::word_t))> swar_t;
+
+    typedef forced_search<T, simd_t, swar_t>                   simd;
+    typedef forced_search<T, etl::false_type, swar_t>          swar;
+    typedef forced_search<T, etl::false_type, etl::false_type> scalar;
+  };
+
+  //***************************************************************************
+  template <typename T, typename TSearch>
+  bool check_length()
+  {
+    std::vector<T> buffer(200);
+    fill(buffer);
+
+    // The SIMD and word at a time searches read to the end of the aligned
+    // block that holds the terminator, so leave room for a block after it.
+    const size_t PADDING = 64U / sizeof(T);
+
+    // Every offset and length, so that the terminator is found at all alignments.
+    for (size_t offset = 0; offset < 20; ++offset)
+    {
+      for (size_t length = 0; (offset + length + PADDING) < buffer.size(); ++length)
+      {
+        std::vector<T> text(buffer);
+        text[offset + length] = 0;
+
+        if (TSearch::length(&text[offset]) != length)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <typename T, typename TSearch>
+  bool check_compare()
+  {
+    std::vector<T> buffer1(100);
+    fill(buffer1);
+
+    for (size_t count = 0; count < 80; ++count)
+    {
+      for (size_t position = 0; position < count; ++position)
+      {
+        std::vector<T> buffer2(buffer1);
+
+        if (TSearch::compare(&buffer1[1], &buffer2[1], count) != 0)
+        {
+          return false;
+        }
+
+        buffer2[1 + position] = T(buffer2[1 + position] + 1);
+
+        if ((TSearch::compare(&buffer1[1], &buffer2[1], count) != -1) ||
+            (TSearch::compare(&buffer2[1], &buffer1[1], count) != 1))
+        {
+          return false;
+        }
+
+        // Only characters before count are compared.
+        if (TSearch::compare(&buffer1[1], &buffer2[1], position) != 0)
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <typename T, typename TSearch>
+  bool check_find()
+  {
+    std::vector<T> buffer(100);
+    fill(buffer);
+
+    const T c = T('!');
+
+    for (size_t count = 0; count < 80; ++count)
+    {
+      if (TSearch::find(&buffer[1], count, c) != nullptr)
+      {
+        return false;
+      }
+
+      for (size_t position = 0; position < count; ++position)
+      {
+        std::vector<T> text(buffer);
+        text[1 + position] = c;
+        text[1 + count]    = c;
+
+        if (TSearch::find(&text[1], count, c) != &text[1 + position])
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool check_length()
+  {
+    std::vector<T> buffer(200);
+    fill(buffer);
+    buffer.back() = 0;
+
+    return check_length<T, traits_search<T> >() &&
+           (etl::char_traits<T>::length(nullptr) == 0) &&
+           (etl::strlen(&buffer[0]) == (buffer.size() - 1));
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool check_length_kernels()
+  {
+    return check_length<T, typename search_kernels<T>::simd>() &&
+           check_length<T, typename search_kernels<T>::swar>() &&
+           check_length<T, typename search_kernels<T>::scalar>();
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool check_compare_kernels()
+  {
+    return check_compare<T, typename search_kernels<T>::simd>() &&
+           check_compare<T, typename search_kernels<T>::swar>() &&
+           check_compare<T, typename search_kernels<T>::scalar>();
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool check_find_kernels()
+  {
+    return check_find<T, typename search_kernels<T>::simd>() &&
+           check_find<T, typename search_kernels<T>::swar>() &&
+           check_find<T, typename search_kernels<T>::scalar>();
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool check_copy_move()
+  {
+    std::vector<T> source(40);
+    fill(source);
+
+    std::vector<T> destination(40, T(0));
+
+    etl::char_traits<T>::copy(&destination[0], &source[0], 40);
+
+    if (destination != source)
+    {
+      return false;
+    }
+
+    // Overlapping, forward and back.
+    std::vector<T> compare(source);
+    std::copy_backward(compare.begin(), compare.begin() + 30, compare.begin() + 35);
+    etl::char_traits<T>::move(&source[5], &source[0], 30);
+
+    if (source != compare)
+    {
+      return false;
+    }
+
+    std::copy(compare.begin() + 5, compare.begin() + 35, compare.begin());
+    etl::char_traits<T>::move(&source[0], &source[5], 30);
+
+    return (source == compare);
+  }
+
+  SUITE(test_char_traits)
+  {
+    //*************************************************************************
+    TEST(test_length)
+    {
+      CHECK(check_length<char>());
+      CHECK(check_length<wchar_t>());
+      CHECK(check_length<char16_t>());
+      CHECK(check_length<char32_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_length_kernels)
+    {
+      CHECK(check_length_kernels<char>());
+      CHECK(check_length_kernels<wchar_t>());
+      CHECK(check_length_kernels<char16_t>());
+      CHECK(check_length_kernels<char32_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_compare)
+    {
+      CHECK((check_compare<char, traits_search<char> >()));
+      CHECK((check_compare<wchar_t, traits_search<wchar_t> >()));
+      CHECK((check_compare<char16_t, traits_search<char16_t> >()));
+      CHECK((check_compare<char32_t, traits_search<char32_t> >()));
+    }
+
+    //*************************************************************************
+    TEST(test_compare_kernels)
+    {
+      CHECK(check_compare_kernels<char>());
+      CHECK(check_compare_kernels<wchar_t>());
+      CHECK(check_compare_kernels<char16_t>());
+      CHECK(check_compare_kernels<char32_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_compare_signedness)
+    {
+      // The ordering is that of the character type.
+      const char lower[] = { 'a', char(0x7F) };
+      const char upper[] = { 'a', char(0x80) };
+
+      const int expected = (char(0x80) < char(0x7F)) ? -1 : 1;
+
+      CHECK_EQUAL(expected, etl::char_traits<char>::compare(upper, lower, 2));
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      CHECK((check_find<char, traits_search<char> >()));
+      CHECK((check_find<wchar_t, traits_search<wchar_t> >()));
+      CHECK((check_find<char16_t, traits_search<char16_t> >()));
+      CHECK((check_find<char32_t, traits_search<char32_t> >()));
+    }
+
+    //*************************************************************************
+    TEST(test_find_kernels)
+    {
+      CHECK(check_find_kernels<char>());
+      CHECK(check_find_kernels<wchar_t>());
+      CHECK(check_find_kernels<char16_t>());
+      CHECK(check_find_kernels<char32_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_copy_move)
+    {
+      CHECK(check_copy_move<char>());
+      CHECK(check_copy_move<wchar_t>());
+      CHECK(check_copy_move<char16_t>());
+      CHECK(check_copy_move<char32_t>());
+    }
+
+    //*************************************************************************
+    TEST(test_assign)
+    {
+      char16_t text[5] = { 0 };
+
+      etl::char_traits<char16_t>::assign(text, 4, u'x');
+
+      CHECK(std::u16string(u"xxxx") == text);
+    }
+  };
+}
@@ -0,0 +1,186 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <vector>
+
+#include "etl/dary_heap.h"
+
+namespace
+{
+  //***************************************************************************
+  std::vector<int> make_data(size_t n)
+  {
+    std::vector<int> data;
+    uint32_t state = 0x2545F491U;
+
+    for (size_t i = 0; i < n; ++i)
+    {
+      state ^= state << 13;
+      state ^= state >> 17;
+      state ^= state << 5;
+
+      data.push_back(int(state % 1000U));
+    }
+
+    return data;
+  }
+
+  SUITE(test_dary_heap)
+  {
+    //*************************************************************************
+    TEST(test_algorithms)
+    {
+      std::vector<int> data = make_data(100);
+
+      etl::make_dary_heap<4>(data.begin(), data.end());
+      CHECK(etl::is_dary_heap<4>(data.begin(), data.end()));
+
+      std::vector<int> sorted;
+
+      for (std::vector<int>::iterator last = data.end(); last != data.begin(); --last)
+      {
+        etl::pop_dary_heap<4>(data.begin(), last);
+        CHECK(etl::is_dary_heap<4>(data.begin(), last - 1));
+        sorted.push_back(*(last - 1));
+      }
+
+      CHECK(std::is_sorted(sorted.rbegin(), sorted.rend()));
+
+      std::vector<int> heap;
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        heap.push_back(data[i]);
+        etl::push_dary_heap<3>(heap.begin(), heap.end(), std::greater<int>());
+        CHECK(etl::is_dary_heap<3>(heap.begin(), heap.end(), std::greater<int>()));
+      }
+
+      CHECK_EQUAL(*std::min_element(data.begin(), data.end()), heap.front());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      etl::dary_heap<int, 100> heap;
+      std::priority_queue<int> compare;
+
+      std::vector<int> data = make_data(100);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        heap.push(data[i]);
+        compare.push(data[i]);
+
+        CHECK_EQUAL(compare.top(), heap.top());
+      }
+
+      CHECK(heap.full());
+      CHECK_EQUAL(0U, heap.available());
+      CHECK_THROW(heap.push(1), etl::dary_heap_full);
+
+      while (!compare.empty())
+      {
+        CHECK_EQUAL(compare.top(), heap.top());
+        heap.pop();
+        compare.pop();
+      }
+
+      CHECK(heap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_assign_and_copy)
+    {
+      std::vector<int> data = make_data(50);
+
+      etl::dary_heap<int, 50, 8, std::greater<int> > heap(data.begin(), data.end());
+      etl::dary_heap<int, 50, 8, std::greater<int> > copy(heap);
+
+      CHECK_EQUAL(data.size(), copy.size());
+
+      std::sort(data.begin(), data.end());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        int value;
+        copy.pop_into(value);
+        CHECK_EQUAL(data[i], value);
+      }
+
+      CHECK(copy.empty());
+      CHECK_EQUAL(data.size(), heap.size());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_and_interface)
+    {
+      typedef etl::dary_heap<std::pair<int, int>, 4> Heap;
+
+      Heap heap;
+      etl::idary_heap<std::pair<int, int> >& iheap = heap;
+
+      iheap.emplace(1, 2);
+      iheap.emplace(3, 1);
+      iheap.emplace(2, 5);
+
+      CHECK_EQUAL(3, heap.top().first);
+      iheap.pop();
+      CHECK_EQUAL(2, heap.top().first);
+
+      iheap.clear();
+      CHECK(iheap.empty());
+
+      iheap.pop();
+      CHECK(iheap.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_external_buffer)
+    {
+      int buffer[20];
+
+      etl::dary_heap<int, 0> heap(buffer, 20);
+
+      std::vector<int> data = make_data(20);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        heap.push(data[i]);
+      }
+
+      CHECK(heap.full());
+      CHECK_EQUAL(20U, heap.max_size());
+      CHECK_EQUAL(*std::max_element(data.begin(), data.end()), heap.top());
+    }
+  };
+}
@@ -1840,5 +1840,81 @@ namespace
       CHECK(data2.empty());
       CHECK_EQUAL(ACTUAL_SIZE, data3.size());
     }
+
+    //*************************************************************************
+    struct SegmentRecorder
+    {
+      void operator ()(const int* p, size_t n)
+      {
+        segments.push_back(std::vector<int>(p, p + n));
+      }
+
+      std::vector<std::vector<int> > segments;
+    };
+
+    //*************************************************************************
+    TEST(test_for_each_segment)
+    {
+      DataInt data;
+
+      SegmentRecorder empty = data.for_each_segment(SegmentRecorder());
+      CHECK(empty.segments.empty());
+
+      data.assign(int_data1.begin(), int_data1.begin() + 10);
+
+      // Contiguous.
+      SegmentRecorder one = data.for_each_segment(SegmentRecorder());
+      CHECK_EQUAL(1U, one.segments.size());
+      CHECK(one.segments[0] == std::vector<int>(int_data1.begin(), int_data1.begin() + 10));
+
+      // Wrapped around the end of the buffer.
+      data.pop_front(8);
+      data.push_back(int_data1.begin() + 10, int_data1.end());
+      data.push_back(int_data2.begin(), int_data2.end());
+
+      std::vector<int> expected = { 8, 9, 10, 11, 12, 13, 15, 16, 17, 18 };
+
+      const IDataInt& cdata = data;
+      SegmentRecorder two = cdata.for_each_segment(SegmentRecorder());
+      CHECK_EQUAL(2U, two.segments.size());
+
+      std::vector<int> joined(two.segments[0]);
+      joined.insert(joined.end(), two.segments[1].begin(), two.segments[1].end());
+      CHECK(joined == expected);
+
+      CHECK(std::equal(data.begin(), data.end(), expected.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_range_pop_front_n)
+    {
+      DataNDC data;
+      Compare_Data compare_data;
+
+      for (size_t i = 0; i < 3; ++i)
+      {
+        data.push_back(initial_data_small.begin(), initial_data_small.end());
+        compare_data.insert(compare_data.end(), initial_data_small.begin(), initial_data_small.end());
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+
+        data.pop_front(8);
+        compare_data.erase(compare_data.begin(), compare_data.begin() + 8);
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+
+      data.pop_front(data.size());
+      CHECK(data.empty());
+
+      CHECK_THROW(data.pop_front(1), etl::deque_empty);
+
+      data.push_back(initial_data.begin(), initial_data.end());
+      CHECK(data.full());
+
+      CHECK_THROW(data.push_back(insert_data.begin(), insert_data.begin() + 1), etl::deque_full);
+    }
   };
 }
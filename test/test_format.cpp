@@ -0,0 +1,234 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <ostream>
+#include <sstream>
+#include <iomanip>
+
+#include "etl/format.h"
+#include "etl/to_string.h"
+#include "etl/format_spec.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  std::ostream& operator << (std::ostream& os, const etl::istring& str)
+  {
+    for (auto c : str)
+    {
+      os << c;
+    }
+
+    return os;
+  }
+
+  SUITE(test_format)
+  {
+    //*************************************************************************
+    TEST(test_compile_time_parse)
+    {
+      static constexpr etl::format_string fmt("id={} value={:x} {{ok}}");
+
+      static_assert(fmt.number_of_fields() == 2, "Wrong number of fields");
+      static_assert(fmt.size() == 6, "Wrong number of segments");
+      static_assert(fmt[0].length == 3, "Wrong literal length");
+      static_assert(fmt[1].text == nullptr, "Not a field");
+      static_assert(fmt[3].spec.type == 'x', "Wrong type");
+
+      etl::string<40> str;
+      etl::format_to(str, fmt, 42, 255U);
+
+      CHECK_EQUAL(etl::string<40>("id=42 value=ff {ok}"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_format_string_macro)
+    {
+      etl::string<40> str;
+      etl::format_to(str, ETL_FORMAT_STRING("id={} value={:x}"), 42, 255U);
+      CHECK_EQUAL(etl::string<40>("id=42 value=ff"), str);
+
+      etl::wstring<40> wstr;
+      etl::format_to(wstr, ETL_FORMAT_STRING(L"{:>4}"), 7);
+      CHECK(etl::wstring<40>(L"   7") == wstr);
+    }
+
+    //*************************************************************************
+    TEST(test_literal)
+    {
+      etl::string<40> str;
+
+      etl::format_to(str, "No fields");
+      CHECK_EQUAL(etl::string<40>("No fields"), str);
+
+      str.clear();
+      etl::format_to(str, "{}", -123);
+      CHECK_EQUAL(etl::string<40>("-123"), str);
+
+      str.clear();
+      etl::format_to(str, "{}{}{}", 1, 2, 3);
+      CHECK_EQUAL(etl::string<40>("123"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_appends)
+    {
+      etl::string<40> str("Start:");
+
+      etl::format_to(str, " {}", 1);
+      etl::format_to(str, " {}", 2);
+
+      CHECK_EQUAL(etl::string<40>("Start: 1 2"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_specs)
+    {
+      etl::string<60> str;
+
+      etl::format_to(str, "{:d} {:x} {:X} {:o} {:b} {:B}", 100, 0xABCDU, 0xABCDU, 8, 5, 6);
+      CHECK_EQUAL(etl::string<60>("100 abcd ABCD 10 101 110"), str);
+
+      str.clear();
+      etl::format_to(str, "[{:5}] [{:<5}] [{:>5}] [{:05}] [{:*<6}] [{:#>6x}]", 12, 12, 12, 12, 12, 255);
+      CHECK_EQUAL(etl::string<60>("[   12] [12   ] [   12] [00012] [12****] [####ff]"), str);
+
+      str.clear();
+      etl::format_to(str, "{} {} {} {}", int8_t(-8), uint16_t(65535), int64_t(-9223372036854775807LL - 1), uint64_t(18446744073709551615ULL));
+      CHECK_EQUAL(etl::string<60>("-8 65535 -9223372036854775808 18446744073709551615"), str);
+
+      str.clear();
+      etl::format_to(str, "{:c}", 65);
+      CHECK_EQUAL(etl::string<60>("A"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_zero_pad_negative)
+    {
+      etl::string<60> str;
+
+      etl::format_to(str, "[{:05}] [{:05}] [{:03}] [{:02}] [{:0>5}]", -42, 42, -42, -42, -42);
+      CHECK_EQUAL(etl::string<60>("[-0042] [00042] [-42] [-42] [00-42]"), str);
+
+      str.clear();
+      etl::format_to(str, "[{:08.2f}] [{:06}]", -3.14159, -0.5);
+      CHECK_EQUAL(etl::string<60>("[-0003.14] [-000.5]"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_text)
+    {
+      etl::string<60> str;
+      etl::string<10> text("text");
+      etl::string_view view("view");
+      char buffer[] = "buffer";
+
+      etl::format_to(str, "{} {} {} {} {}", 'c', "literal", text, view, buffer);
+      CHECK_EQUAL(etl::string<60>("c literal text view buffer"), str);
+
+      str.clear();
+      etl::format_to(str, "[{:6}] [{:>6}] [{:.<4}]", text, view, "x");
+      CHECK_EQUAL(etl::string<60>("[text  ] [  view] [x...]"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_bool)
+    {
+      etl::string<40> str;
+
+      etl::format_to(str, "{} {} {:d} {:>6}", true, false, true, true);
+      CHECK_EQUAL(etl::string<40>("true false 1   true"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      etl::string<60> str;
+
+      etl::format_to(str, "{} {} {:.3} {:.2f} {:8.1f} {:g}", 0.1, 1.5f, 3.14159, -2.5, 1.25, 1e21);
+      CHECK_EQUAL(etl::string<60>("0.1 1.5 3.142 -2.50      1.3 1e+21"), str);
+    }
+
+    //*************************************************************************
+    TEST(test_pointer)
+    {
+      static const int value = 0;
+
+      etl::string<40> str;
+      etl::string<40> compare;
+
+      etl::format_to(str, "{}", &value);
+      etl::to_string(&value, compare, etl::format_spec().hex());
+
+      CHECK_EQUAL(compare, str);
+    }
+
+    //*************************************************************************
+    TEST(test_truncation)
+    {
+      etl::string<10> str;
+
+      etl::format_to(str, "{} and {}", 123456, 789);
+
+      CHECK_EQUAL(etl::string<10>("123456 and"), str);
+      CHECK(str.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_wide)
+    {
+      etl::wstring<40> str;
+
+      etl::format_to(str, L"{} {:x} {}", 42, 255, L"wide");
+
+      CHECK(etl::wstring<40>(L"42 ff wide") == str);
+    }
+
+    //*************************************************************************
+    TEST(test_errors)
+    {
+      etl::string<40> str;
+
+      CHECK_THROW(etl::format_string("{"),     etl::format_syntax_exception);
+      CHECK_THROW(etl::format_string("}"),     etl::format_syntax_exception);
+      CHECK_THROW(etl::format_string("{:?}"),  etl::format_syntax_exception);
+      CHECK_THROW(etl::format_string("{:.}"),  etl::format_syntax_exception);
+      CHECK_THROW(etl::format_string("{0}"),   etl::format_syntax_exception);
+      CHECK_THROW(etl::format_string("{:^6}"), etl::format_syntax_exception);
+
+      CHECK_THROW((etl::basic_format_string<char, 2>("a{}b")), etl::format_full_exception);
+
+      CHECK_THROW(etl::format_to(str, "{} {}", 1),    etl::format_argument_exception);
+      CHECK_THROW(etl::format_to(str, "{}", 1, 2),    etl::format_argument_exception);
+    }
+  };
+}
@@ -1329,5 +1329,59 @@ namespace
       CHECK(data1 < data3);
       CHECK(data3 > data1);
     }
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      typedef etl::forward_list<std::string, 16> Data;
+
+      Data data;
+      std::forward_list<std::string> compare;
+
+      // Churn the pool so that the nodes are out of address order.
+      for (int i = 0; i < 16; ++i)
+      {
+        data.push_front(std::to_string(i));
+        compare.push_front(std::to_string(i));
+      }
+
+      for (int i = 0; i < 6; ++i)
+      {
+        Data::iterator itr = data.begin();
+        std::forward_list<std::string>::iterator citr = compare.begin();
+        std::advance(itr, i);
+        std::advance(citr, i);
+        data.erase_after(itr);
+        compare.erase_after(citr);
+      }
+
+      for (int i = 16; i < 20; ++i)
+      {
+        data.push_front(std::to_string(i));
+        compare.push_front(std::to_string(i));
+      }
+
+      CHECK(data.compact());
+
+      CHECK_EQUAL(size_t(std::distance(compare.begin(), compare.end())), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      // The nodes are now in ascending address order.
+      const std::string* p_previous = nullptr;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK(p_previous < &*itr);
+        p_previous = &*itr;
+      }
+
+      // Still usable.
+      data.push_front("A");
+      compare.push_front("A");
+      data.erase_after(data.begin());
+      compare.erase_after(compare.begin());
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
   };
 }
@@ -0,0 +1,349 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <string>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "etl/from_chars.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+#include "etl/u16string.h"
+#include "etl/u32string.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  typedef etl::from_chars_status Status;
+
+  //***************************************************************************
+  template <typename T>
+  etl::from_chars_result<char> parse(const char* text, T& value)
+  {
+    return etl::from_chars(text, text + strlen(text), value);
+  }
+
+  //***************************************************************************
+  template <typename T>
+  etl::from_chars_result<char> parse(const char* text, T& value, int base)
+  {
+    return etl::from_chars(text, text + strlen(text), value, base);
+  }
+
+  //***************************************************************************
+  bool same_bits(double a, double b)
+  {
+    return memcmp(&a, &b, sizeof(a)) == 0;
+  }
+
+  SUITE(test_from_chars)
+  {
+    //*************************************************************************
+    TEST(test_integral)
+    {
+      int32_t  i32 = 0;
+      uint32_t u32 = 0;
+      int64_t  i64 = 0;
+      uint64_t u64 = 0;
+      int8_t   i8  = 0;
+
+      CHECK(parse("0", i32).ec == Status::success);
+      CHECK_EQUAL(0, i32);
+
+      CHECK(parse("-2147483648", i32).ec == Status::success);
+      CHECK_EQUAL(-2147483647 - 1, i32);
+
+      CHECK(parse("4294967295", u32).ec == Status::success);
+      CHECK_EQUAL(4294967295U, u32);
+
+      CHECK(parse("-9223372036854775808", i64).ec == Status::success);
+      CHECK(i64 == (-9223372036854775807LL - 1));
+
+      CHECK(parse("18446744073709551615", u64).ec == Status::success);
+      CHECK(u64 == 18446744073709551615ULL);
+
+      CHECK(parse("00000000000000000000000000000000123", u64).ec == Status::success);
+      CHECK(u64 == 123U);
+
+      CHECK(parse("-128", i8).ec == Status::success);
+      CHECK_EQUAL(-128, i8);
+
+      const char* text = "12345678901234x";
+      etl::from_chars_result<char> result = parse(text, i64);
+      CHECK(result.ec == Status::success);
+      CHECK(result.ptr == text + 14);
+      CHECK(i64 == 12345678901234LL);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_bases)
+    {
+      uint32_t u32 = 0;
+      int32_t  i32 = 0;
+
+      CHECK(parse("ffffFFFF", u32, 16).ec == Status::success);
+      CHECK_EQUAL(0xFFFFFFFFU, u32);
+
+      CHECK(parse("-101", i32, 2).ec == Status::success);
+      CHECK_EQUAL(-5, i32);
+
+      CHECK(parse("777", i32, 8).ec == Status::success);
+      CHECK_EQUAL(511, i32);
+
+      CHECK(parse("zz", i32, 36).ec == Status::success);
+      CHECK_EQUAL(1295, i32);
+
+      CHECK(parse("12", i32, 1).ec == Status::invalid_argument);
+      CHECK(parse("12", i32, 37).ec == Status::invalid_argument);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_errors)
+    {
+      int32_t  i32 = 42;
+      uint32_t u32 = 42;
+      int8_t   i8  = 42;
+
+      const char* text = "";
+      etl::from_chars_result<char> result = parse(text, i32);
+      CHECK(result.ec == Status::invalid_argument);
+      CHECK(result.ptr == text);
+
+      CHECK(parse("-", i32).ec == Status::invalid_argument);
+      CHECK(parse("+1", i32).ec == Status::invalid_argument);
+      CHECK(parse(" 1", i32).ec == Status::invalid_argument);
+      CHECK(parse("-1", u32).ec == Status::invalid_argument);
+      CHECK_EQUAL(42, i32);
+      CHECK_EQUAL(42U, u32);
+
+      // The digits are consumed even when out of range.
+      text = "2147483648 ";
+      result = parse(text, i32);
+      CHECK(result.ec == Status::result_out_of_range);
+      CHECK(result.ptr == text + 10);
+      CHECK_EQUAL(42, i32);
+
+      CHECK(parse("128", i8).ec == Status::result_out_of_range);
+      CHECK(parse("-129", i8).ec == Status::result_out_of_range);
+      CHECK(parse("123456789012345678901234567890", u32).ec == Status::result_out_of_range);
+      CHECK_EQUAL(42, i8);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_round_trip)
+    {
+      uint64_t x = 0x9E3779B97F4A7C15ULL;
+      char text[32];
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+
+        snprintf(text, sizeof(text), "%lld", (long long)x);
+
+        int64_t value = 0;
+        CHECK(parse(text, value).ec == Status::success);
+        CHECK(value == int64_t(x));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      double d = 0.0;
+      float  f = 0.0f;
+
+      CHECK(parse("1.5", d).ec == Status::success);
+      CHECK_EQUAL(1.5, d);
+
+      CHECK(parse("-0.1", d).ec == Status::success);
+      CHECK_EQUAL(-0.1, d);
+
+      CHECK(parse(".5", d).ec == Status::success);
+      CHECK_EQUAL(0.5, d);
+
+      CHECK(parse("5.", d).ec == Status::success);
+      CHECK_EQUAL(5.0, d);
+
+      CHECK(parse("1e23", d).ec == Status::success);
+      CHECK_EQUAL(1e23, d);
+
+      CHECK(parse("1.7976931348623157e308", d).ec == Status::success);
+      CHECK_EQUAL(1.7976931348623157e308, d);
+
+      CHECK(parse("4.9e-324", d).ec == Status::success);
+      CHECK_EQUAL(4.9e-324, d);
+
+      CHECK(parse("-0", d).ec == Status::success);
+      CHECK(std::signbit(d));
+
+      CHECK(parse("3.4028235e38", f).ec == Status::success);
+      CHECK_EQUAL(3.4028235e38f, f);
+
+      CHECK(parse("0.1", f).ec == Status::success);
+      CHECK_EQUAL(0.1f, f);
+
+      // 2^53 + 1 is halfway between two doubles, so rounds to even.
+      CHECK(parse("9007199254740993", d).ec == Status::success);
+      CHECK_EQUAL(9007199254740992.0, d);
+
+      // But not if the following digits are above halfway.
+      CHECK(parse("9007199254740993.0000000000000000000000000001", d).ec == Status::success);
+      CHECK_EQUAL(9007199254740994.0, d);
+
+      // The 'e' is not part of the number if there is no exponent.
+      const char* text = "1.25e";
+      etl::from_chars_result<char> result = parse(text, d);
+      CHECK(result.ec == Status::success);
+      CHECK(result.ptr == text + 4);
+      CHECK_EQUAL(1.25, d);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_special)
+    {
+      double d = 0.0;
+
+      CHECK(parse("inf", d).ec == Status::success);
+      CHECK(std::isinf(d) && (d > 0));
+
+      CHECK(parse("-Infinity", d).ec == Status::success);
+      CHECK(std::isinf(d) && (d < 0));
+
+      const char* text = "nan(123)x";
+      etl::from_chars_result<char> result = parse(text, d);
+      CHECK(result.ec == Status::success);
+      CHECK(result.ptr == text + 8);
+      CHECK(std::isnan(d));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_errors)
+    {
+      double d = 42.0;
+
+      CHECK(parse("", d).ec == Status::invalid_argument);
+      CHECK(parse(".", d).ec == Status::invalid_argument);
+      CHECK(parse("-", d).ec == Status::invalid_argument);
+      CHECK(parse("e5", d).ec == Status::invalid_argument);
+      CHECK(parse("+1", d).ec == Status::invalid_argument);
+      CHECK(parse("1e309", d).ec == Status::result_out_of_range);
+      CHECK(parse("1e-400", d).ec == Status::result_out_of_range);
+      CHECK_EQUAL(42.0, d);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_round_trip)
+    {
+      uint64_t x = 0x0123456789ABCDEFULL;
+      char text[64];
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+
+        double expected;
+        memcpy(&expected, &x, sizeof(expected));
+
+        if (!std::isfinite(expected) || (expected == 0.0))
+        {
+          continue;
+        }
+
+        // Shortest, and more digits than needed.
+        snprintf(text, sizeof(text), "%.17g", expected);
+        double value = 0.0;
+        CHECK(parse(text, value).ec == Status::success);
+        CHECK(same_bits(expected, value));
+
+        snprintf(text, sizeof(text), "%.40g", expected);
+        value = 0.0;
+        CHECK(parse(text, value).ec == Status::success);
+        CHECK(same_bits(expected, value));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_strings_and_views)
+    {
+      int32_t i32 = 0;
+      double  d   = 0.0;
+
+      etl::string<20> str("-1234");
+      CHECK(etl::from_chars(str, i32).ec == Status::success);
+      CHECK_EQUAL(-1234, i32);
+
+      etl::string_view view("2.5e3");
+      CHECK(etl::from_chars(view, d).ec == Status::success);
+      CHECK_EQUAL(2500.0, d);
+
+      etl::wstring<20> wstr(L"7fffffff");
+      CHECK(etl::from_chars(wstr, i32, 16).ec == Status::success);
+      CHECK_EQUAL(0x7FFFFFFF, i32);
+
+      etl::u16string<20> u16str(u"0.125");
+      CHECK(etl::from_chars(u16str, d).ec == Status::success);
+      CHECK_EQUAL(0.125, d);
+
+      etl::u32string<20> u32str(U"-98765432109");
+      int64_t i64 = 0;
+      CHECK(etl::from_chars(u32str, i64).ec == Status::success);
+      CHECK(i64 == -98765432109LL);
+    }
+
+    //*************************************************************************
+    TEST(test_to_arithmetic)
+    {
+      etl::optional<int32_t> i32 = etl::to_arithmetic<int32_t>(etl::string_view("-42"));
+      CHECK(bool(i32));
+      CHECK_EQUAL(-42, i32.value());
+
+      CHECK(!etl::to_arithmetic<int32_t>(etl::string_view("-42x")));
+      CHECK(!etl::to_arithmetic<int32_t>(etl::string_view("")));
+      CHECK(!etl::to_arithmetic<uint8_t>(etl::string_view("256")));
+
+      etl::optional<uint32_t> hex = etl::to_arithmetic<uint32_t>(etl::string<8>("BEEF"), 16);
+      CHECK(bool(hex));
+      CHECK_EQUAL(0xBEEFU, hex.value());
+
+      etl::optional<double> d = etl::to_arithmetic<double>(etl::string_view("6.02214076e23"));
+      CHECK(bool(d));
+      CHECK_EQUAL(6.02214076e23, d.value());
+
+      CHECK(!etl::to_arithmetic<double>(etl::string_view("1.0.0")));
+    }
+  };
+}
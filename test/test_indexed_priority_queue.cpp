@@ -0,0 +1,259 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "etl/indexed_priority_queue.h"
+
+namespace
+{
+  typedef etl::indexed_priority_queue<int, 32> Queue;
+
+  //***************************************************************************
+  uint32_t next_random(uint32_t& state)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+
+    return state;
+  }
+
+  //***************************************************************************
+  int max_value(const std::map<size_t, int>& model)
+  {
+    int result = model.begin()->second;
+
+    for (std::map<size_t, int>::const_iterator itr = model.begin(); itr != model.end(); ++itr)
+    {
+      result = std::max(result, itr->second);
+    }
+
+    return result;
+  }
+
+  SUITE(test_indexed_priority_queue)
+  {
+    //*************************************************************************
+    TEST(test_push_pop)
+    {
+      Queue queue;
+
+      CHECK(queue.empty());
+      CHECK_EQUAL(32U, queue.max_size());
+
+      const int data[] = { 5, 1, 9, 3, 7 };
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        Queue::handle_type handle = queue.push(data[i]);
+        CHECK(queue.contains(handle));
+        CHECK_EQUAL(data[i], queue[handle]);
+      }
+
+      CHECK_EQUAL(5U, queue.size());
+      CHECK_EQUAL(9, queue.top());
+      CHECK_EQUAL(9, queue[queue.top_handle()]);
+
+      const int expected[] = { 9, 7, 5, 3, 1 };
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        int value;
+        queue.pop_into(value);
+        CHECK_EQUAL(expected[i], value);
+      }
+
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_update_priority_and_erase)
+    {
+      Queue queue;
+
+      Queue::handle_type a = queue.push(10);
+      Queue::handle_type b = queue.push(20);
+      Queue::handle_type c = queue.push(30);
+
+      CHECK_EQUAL(c, queue.top_handle());
+
+      // Increase.
+      queue.update_priority(a, 40);
+      CHECK_EQUAL(a, queue.top_handle());
+
+      // Decrease.
+      queue.update_priority(a, 5);
+      CHECK_EQUAL(c, queue.top_handle());
+
+      // In place.
+      queue[b] = 50;
+      queue.update_priority(b);
+      CHECK_EQUAL(b, queue.top_handle());
+
+      queue.erase(b);
+      CHECK(!queue.contains(b));
+      CHECK_EQUAL(c, queue.top_handle());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK_THROW(queue.erase(b), etl::indexed_priority_queue_handle);
+      CHECK_THROW(queue.update_priority(b, 1), etl::indexed_priority_queue_handle);
+      CHECK_THROW(queue[Queue::MAX_SIZE], etl::indexed_priority_queue_handle);
+    }
+
+    //*************************************************************************
+    TEST(test_random_operations)
+    {
+      etl::indexed_priority_queue<int, 64, 4> queue;
+      std::map<size_t, int> model;
+
+      uint32_t state = 0x9E3779B9U;
+
+      for (int i = 0; i < 5000; ++i)
+      {
+        const uint32_t operation = next_random(state) % 4U;
+        const int value = int(next_random(state) % 1000U);
+
+        if ((operation == 0U) && !queue.full())
+        {
+          size_t handle = queue.push(value);
+          CHECK(model.find(handle) == model.end());
+          model[handle] = value;
+        }
+        else if (!model.empty())
+        {
+          std::map<size_t, int>::iterator itr = model.begin();
+          std::advance(itr, next_random(state) % model.size());
+
+          if (operation == 1U)
+          {
+            queue.update_priority(itr->first, value);
+            itr->second = value;
+          }
+          else if (operation == 2U)
+          {
+            queue.erase(itr->first);
+            model.erase(itr);
+          }
+          else
+          {
+            CHECK_EQUAL(max_value(model), queue.top());
+            model.erase(queue.top_handle());
+            queue.pop();
+          }
+        }
+        else
+        {
+          size_t handle = queue.push(value);
+          model[handle] = value;
+        }
+
+        CHECK_EQUAL(model.size(), queue.size());
+
+        if (!model.empty())
+        {
+          CHECK_EQUAL(max_value(model), queue.top());
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_assign_and_copy)
+    {
+      const int data[] = { 4, 8, 1, 6, 3 };
+
+      etl::indexed_priority_queue<int, 8, 2, std::greater<int> > queue(std::begin(data), std::end(data));
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(data[i], queue[i]);
+      }
+
+      CHECK_EQUAL(1, queue.top());
+      CHECK_EQUAL(2U, queue.top_handle());
+
+      queue.erase(0);
+
+      etl::indexed_priority_queue<int, 8, 2, std::greater<int> > copy(queue);
+
+      CHECK_EQUAL(4U, copy.size());
+      CHECK(!copy.contains(0));
+      CHECK_EQUAL(6, copy[3]);
+
+      // The free slot is reused.
+      CHECK_EQUAL(0U, copy.push(7));
+
+      const int expected[] = { 1, 3, 6, 7, 8 };
+
+      for (size_t i = 0; i < 5; ++i)
+      {
+        CHECK_EQUAL(expected[i], copy.top());
+        copy.pop();
+      }
+
+      CHECK_EQUAL(4U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_and_external_buffer)
+    {
+      typedef etl::indexed_priority_queue<std::string, 0> StringQueue;
+
+      StringQueue::slot_type   slots[4];
+      StringQueue::handle_type heap[4];
+
+      {
+        StringQueue queue(slots, heap, 4);
+        etl::iindexed_priority_queue<std::string>& iqueue = queue;
+
+        size_t b = iqueue.emplace(3U, 'b');
+        iqueue.push(std::string("a long string that does not fit inline"));
+        iqueue.push("c");
+
+        CHECK_EQUAL(std::string("c"), iqueue.top());
+
+        iqueue.update_priority(b, "d");
+        CHECK_EQUAL(std::string("d"), iqueue.top());
+
+        iqueue.push("e");
+        CHECK(iqueue.full());
+        CHECK_THROW(iqueue.push("f"), etl::indexed_priority_queue_full);
+
+        iqueue.pop();
+        iqueue.erase(b);
+        CHECK_EQUAL(std::string("c"), iqueue.top());
+      }
+    }
+  };
+}
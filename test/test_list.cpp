@@ -2006,5 +2006,86 @@ namespace
       CHECK_EQUAL(3U, (*itr++).value); // 3
       CHECK_EQUAL(4U, (*itr++).value); // 4
     }
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      typedef etl::list<std::string, 16> Data;
+
+      Data data;
+      std::list<std::string> compare;
+
+      // Churn the pool so that the nodes are out of address order.
+      for (int i = 0; i < 16; ++i)
+      {
+        data.push_front(std::to_string(i));
+        compare.push_front(std::to_string(i));
+      }
+
+      for (int i = 0; i < 6; ++i)
+      {
+        Data::iterator itr = data.begin();
+        std::list<std::string>::iterator citr = compare.begin();
+        std::advance(itr, 2 * i);
+        std::advance(citr, 2 * i);
+        data.erase(itr);
+        compare.erase(citr);
+      }
+
+      for (int i = 16; i < 20; ++i)
+      {
+        data.push_back(std::to_string(i));
+        compare.push_back(std::to_string(i));
+      }
+
+      CHECK(data.compact());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+      CHECK(std::equal(data.rbegin(), data.rend(), compare.rbegin()));
+
+      // The nodes are now in ascending address order.
+      const std::string* p_previous = nullptr;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK(p_previous < &*itr);
+        p_previous = &*itr;
+      }
+
+      // Still usable.
+      data.push_back("A");
+      compare.push_back("A");
+      data.pop_front();
+      compare.pop_front();
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_compact_shared_pool)
+    {
+      typedef etl::list<int, 0> Data;
+
+      etl::ordered_pool<Data::pool_type, 8> pool;
+
+      Data data1(pool);
+      data1.push_back(1);
+      data1.push_back(2);
+      data1.push_back(3);
+
+      // The only user of the pool.
+      CHECK(data1.compact());
+
+      Data data2(pool);
+      data2.push_back(4);
+
+      CHECK(!data1.compact());
+      CHECK(!data2.compact());
+
+      CHECK_EQUAL(3U, data1.size());
+      CHECK_EQUAL(1, data1.front());
+      CHECK_EQUAL(3, data1.back());
+    }
   };
 }
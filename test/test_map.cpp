@@ -1187,5 +1187,66 @@ namespace
             }
         }
     }
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      typedef etl::map<int, std::string, 64> Data;
+
+      Data data;
+      std::map<int, std::string> compare;
+
+      // Churn the pool so that the nodes are out of address order.
+      for (int i = 0; i < 64; ++i)
+      {
+        int key = (i * 37) % 64;
+        data.insert(std::make_pair(key, std::to_string(key)));
+        compare.insert(std::make_pair(key, std::to_string(key)));
+      }
+
+      for (int i = 0; i < 64; i += 3)
+      {
+        data.erase(i);
+        compare.erase(i);
+      }
+
+      for (int i = 100; i < 110; ++i)
+      {
+        data.insert(std::make_pair(i, std::to_string(i)));
+        compare.insert(std::make_pair(i, std::to_string(i)));
+      }
+
+      CHECK(data.compact());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      // The nodes are now in ascending address order.
+      const Data::value_type* p_previous = nullptr;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK(p_previous < &*itr);
+        p_previous = &*itr;
+      }
+
+      // Still a valid tree.
+      for (std::map<int, std::string>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK(data.find(itr->first) != data.end());
+        CHECK_EQUAL(itr->second, data.at(itr->first));
+      }
+
+      for (int i = 200; i < 210; ++i)
+      {
+        data.insert(std::make_pair(i, std::to_string(i)));
+        compare.insert(std::make_pair(i, std::to_string(i)));
+      }
+
+      data.erase(100);
+      compare.erase(100);
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
   };
 }
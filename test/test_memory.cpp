@@ -654,5 +654,34 @@ namespace
       CHECK_EQUAL(0x5A5A5A5A, data[2].d1);
       CHECK_EQUAL(0x5A, data[2].d2);
     }
+
+    //*************************************************************************
+    TEST(test_relocate)
+    {
+      int data[8] = { 0, 1, 2, 3, 4, 5, 6, 7 };
+
+      // Overlapping, upwards.
+      int* p_end = etl::relocate(data + 1, data + 5, data + 3);
+
+      CHECK(p_end == data + 7);
+      CHECK_EQUAL(1, data[3]);
+      CHECK_EQUAL(2, data[4]);
+      CHECK_EQUAL(3, data[5]);
+      CHECK_EQUAL(4, data[6]);
+
+      // Overlapping, downwards.
+      p_end = etl::relocate(data + 3, data + 7, data);
+
+      CHECK(p_end == data + 4);
+      CHECK_EQUAL(1, data[0]);
+      CHECK_EQUAL(2, data[1]);
+      CHECK_EQUAL(3, data[2]);
+      CHECK_EQUAL(4, data[3]);
+
+      // Empty.
+      p_end = etl::relocate(data, data, data + 2);
+
+      CHECK(p_end == data + 2);
+    }
   };
 }
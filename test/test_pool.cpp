@@ -413,6 +413,283 @@ namespace
       CHECK_NO_THROW(p3 = pool.allocate<double>());
       CHECK_NO_THROW(p4 = pool.allocate<Test_Data>());
     }
+
+    //*************************************************************************
+    TEST(test_ordered_pool_allocates_lowest_address)
+    {
+      etl::ordered_pool<uint32_t, 40> pool;
+
+      CHECK(pool.is_lowest_address_first());
+
+      uint32_t* p[40];
+
+      for (size_t i = 0; i < 40; ++i)
+      {
+        p[i] = pool.allocate<uint32_t>();
+        CHECK(p[i] == pool.item_address(i));
+      }
+
+      CHECK(pool.full());
+
+      // Release out of order.
+      pool.release(p[35]);
+      pool.release(p[3]);
+      pool.release(p[17]);
+
+      CHECK_EQUAL(37U, pool.size());
+      CHECK(pool.allocate<uint32_t>() == p[3]);
+      CHECK(pool.allocate<uint32_t>() == p[17]);
+      CHECK(pool.allocate<uint32_t>() == p[35]);
+      CHECK(pool.full());
+
+      pool.release_all();
+      CHECK(pool.empty());
+      CHECK(pool.allocate<uint32_t>() == p[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_ordered_pool_full)
+    {
+      etl::ordered_pool<uint32_t, 4> pool;
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        pool.allocate<uint32_t>();
+      }
+
+      CHECK_THROW(pool.allocate<uint32_t>(), etl::pool_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_ordered_pool_allocate_n_release_n)
+    {
+      etl::ordered_pool<uint32_t, 70> pool;
+
+      uint32_t* p[70];
+
+      CHECK(pool.allocate_n(p, 40));
+      CHECK_EQUAL(40U, pool.size());
+
+      for (size_t i = 0; i < 40; ++i)
+      {
+        CHECK(p[i] == pool.item_address(i));
+        CHECK(pool.is_allocated(p[i]));
+      }
+
+      // Release a run across a word boundary, and a couple of others.
+      pool.release_n(&p[28], 8);
+      pool.release(p[2]);
+      pool.release(p[39]);
+      CHECK_EQUAL(30U, pool.size());
+
+      CHECK(!pool.is_allocated(p[2]));
+      CHECK(!pool.is_allocated(p[30]));
+      CHECK(pool.is_allocated(p[27]));
+
+      // Refill the gaps lowest first, then carry on.
+      uint32_t* q[12];
+      CHECK(pool.allocate_n(q, 12));
+
+      CHECK(q[0]  == p[2]);
+      for (size_t i = 0; i < 8; ++i)
+      {
+        CHECK(q[i + 1] == p[28 + i]);
+      }
+      CHECK(q[9]  == p[39]);
+      CHECK(q[10] == pool.item_address(40));
+      CHECK(q[11] == pool.item_address(41));
+
+      CHECK_EQUAL(42U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_ordered_pool_allocate_n_too_many)
+    {
+      etl::ordered_pool<uint32_t, 10> pool;
+
+      uint32_t* p[11];
+
+      CHECK(pool.allocate_n(p, 4));
+      CHECK_THROW(pool.allocate_n(p, 7), etl::pool_no_allocation);
+
+      // Nothing was allocated.
+      CHECK_EQUAL(4U, pool.size());
+
+      CHECK(pool.allocate_n(p, 6));
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_ordered_pool_is_allocated)
+    {
+      etl::ordered_pool<uint32_t, 10> pool;
+      uint32_t  not_in_pool;
+
+      uint32_t* p = pool.allocate<uint32_t>();
+
+      CHECK(pool.is_allocated(p));
+      CHECK(!pool.is_allocated(&not_in_pool));
+      CHECK(!pool.is_allocated(reinterpret_cast<char*>(p) + 1));
+      CHECK(!pool.is_allocated(pool.item_address(1)));
+
+      pool.release(p);
+      CHECK(!pool.is_allocated(p));
+
+      // Released twice.
+      CHECK_THROW(pool.release(p), etl::pool_object_not_in_pool);
+      CHECK(pool.empty());
+    }
+
+    //*************************************************************************
+    struct collect_values
+    {
+      void operator()(uint32_t* p)
+      {
+        values.push_back(*p);
+      }
+
+      std::vector<uint32_t> values;
+    };
+
+    //*************************************************************************
+    TEST(test_ordered_pool_for_each_allocated)
+    {
+      etl::ordered_pool<uint32_t, 35> pool;
+
+      uint32_t* p[35];
+      pool.allocate_n(p, 35);
+
+      for (uint32_t i = 0; i < 35; ++i)
+      {
+        *p[i] = i;
+      }
+
+      pool.release(p[0]);
+      pool.release(p[5]);
+      pool.release(p[31]);
+      pool.release(p[33]);
+
+      std::vector<uint32_t> expected;
+
+      for (uint32_t i = 0; i < 35; ++i)
+      {
+        if ((i != 0) && (i != 5) && (i != 31) && (i != 33))
+        {
+          expected.push_back(i);
+        }
+      }
+
+      collect_values collected = pool.for_each_allocated(collect_values());
+
+      CHECK(expected == collected.values);
+
+      // Empty.
+      pool.release_all();
+      collected = pool.for_each_allocated(collect_values());
+      CHECK(collected.values.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_generic_ordered_pool_bulk)
+    {
+      typedef etl::largest<uint8_t, uint32_t, double> largest;
+
+      etl::generic_ordered_pool<largest::size, largest::alignment, 8> pool;
+
+      double* p[8];
+
+      CHECK(pool.allocate_n<double>(p, 8));
+      CHECK(pool.full());
+      CHECK(pool.is_allocated(p[7]));
+
+      pool.release_n(p, 4);
+      CHECK_EQUAL(4U, pool.size());
+
+      size_t count = 0;
+      pool.for_each_allocated<double>([&count](double*) { ++count; });
+      CHECK_EQUAL(4U, count);
+    }
+
+    //*************************************************************************
+    // The first field is overwritten by the relayout position.
+    struct Item
+    {
+      void*    link;
+      uint32_t value;
+    };
+
+    struct item_mover
+    {
+      void move(void* p_from, void* p_to)
+      {
+        static_cast<Item*>(p_to)->value = static_cast<Item*>(p_from)->value;
+      }
+
+      void swap(void* p_item1, void* p_item2)
+      {
+        std::swap(static_cast<Item*>(p_item1)->value, static_cast<Item*>(p_item2)->value);
+      }
+    };
+
+    //*************************************************************************
+    template <typename TPool>
+    void check_relayout(TPool& pool)
+    {
+      // Allocate 10, release 4 of them, then allocate 2.
+      Item* p[12];
+
+      for (size_t i = 0; i < 10; ++i)
+      {
+        p[i] = pool.template allocate<Item>();
+      }
+
+      pool.release(p[1]);
+      pool.release(p[4]);
+      pool.release(p[6]);
+      pool.release(p[8]);
+
+      p[10] = pool.template allocate<Item>();
+      p[11] = pool.template allocate<Item>();
+
+      // The items in the order they should be laid out.
+      Item* order[8] = { p[11], p[9], p[0], p[10], p[7], p[2], p[5], p[3] };
+
+      pool.begin_relayout();
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        order[i]->value = uint32_t(100 + i);
+        pool.set_relayout_position(order[i], i);
+      }
+
+      item_mover mover;
+      pool.end_relayout(mover);
+
+      CHECK_EQUAL(8U, pool.size());
+
+      for (size_t i = 0; i < 8; ++i)
+      {
+        CHECK_EQUAL(100 + i, static_cast<Item*>(pool.item_address(i))->value);
+      }
+
+      // The next allocations follow the relaid items.
+      for (size_t i = 8; i < 12; ++i)
+      {
+        CHECK(pool.template allocate<Item>() == pool.item_address(i));
+      }
+
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_relayout)
+    {
+      etl::pool<Item, 12> pool;
+      check_relayout(pool);
+
+      etl::ordered_pool<Item, 12> ordered;
+      check_relayout(ordered);
+    }
   };
 
   //*************************************************************************
@@ -412,5 +412,235 @@ namespace
       }
     }
 
+    //=========================================================================
+    TEST(test_range_rejects_biased_values)
+    {
+      // A generator that returns a fixed sequence.
+      struct sequence
+      {
+        sequence(const uint32_t* p_values_)
+          : p_values(p_values_)
+        {
+        }
+
+        uint32_t operator()()
+        {
+          return *p_values++;
+        }
+
+        const uint32_t* p_values;
+      };
+
+      // For a range of 3, 2^32 % 3 == 1 value must be rejected, which is 0.
+      // A modulo reduction would have returned 0 for it.
+      const uint32_t values[] = { 0x00000000U, 0x80000000U };
+      sequence s(values);
+
+      CHECK_EQUAL(11U, etl::private_random::range32(s, 10U, 12U));
+      CHECK(s.p_values == (values + 2));
+
+      // Values that are not rejected only use one number from the generator.
+      const uint32_t values2[] = { 0xFFFFFFFFU, 0x55555555U };
+      sequence s2(values2);
+
+      CHECK_EQUAL(12U, etl::private_random::range32(s2, 10U, 12U));
+      CHECK_EQUAL(10U, etl::private_random::range32(s2, 10U, 12U));
+      CHECK(s2.p_values == (values2 + 2));
+    }
+
+    //=========================================================================
+    TEST(test_range_full)
+    {
+      etl::random_xorshift r1(1234);
+      etl::random_xorshift r2(1234);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(r1(), r2.range(0U, UINT32_MAX));
+      }
+
+      etl::random_lcg lcg1(1234);
+      etl::random_lcg lcg2(1234);
+      etl::random_clcg clcg1(1234);
+      etl::random_clcg clcg2(1234);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(lcg1(), lcg2.range(0U, UINT32_MAX));
+        CHECK_EQUAL(clcg1(), clcg2.range(0U, UINT32_MAX));
+      }
+
+      etl::random_xoshiro256ss r3(1234);
+      etl::random_xoshiro256ss r4(1234);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        CHECK_EQUAL(r3(), r4.range(0U, UINT64_MAX));
+      }
+    }
+
+    //=========================================================================
+    TEST(test_fill)
+    {
+      uint32_t buffer[100];
+
+      etl::random_xorshift r1(1234);
+      etl::random_xorshift r2(1234);
+      r1.fill(buffer, 100U);
+
+      for (size_t i = 0U; i < 100U; ++i)
+      {
+        CHECK_EQUAL(r2(), buffer[i]);
+      }
+
+      etl::random_pcg r3(1234);
+      etl::random_pcg r4(1234);
+      etl::random& base = r3;
+      base.fill(buffer, 100U);
+
+      for (size_t i = 0U; i < 100U; ++i)
+      {
+        CHECK_EQUAL(r4(), buffer[i]);
+      }
+    }
+
+    //=========================================================================
+    TEST(test_random_pcg_advance)
+    {
+      etl::random_pcg r1(1234);
+      etl::random_pcg r2(1234);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        r1();
+      }
+
+      r2.advance(1000U);
+
+      CHECK_EQUAL(r1(), r2());
+    }
+
+    //=========================================================================
+    TEST(test_random_xorshift_lanes)
+    {
+      uint32_t buffer1[103];
+      uint32_t buffer2[103];
+
+      etl::random_xorshift_lanes<8> r1(1234);
+      etl::random_xorshift_lanes<8> r2(1234);
+
+      // Start part way through a block.
+      for (size_t i = 0U; i < 3U; ++i)
+      {
+        buffer1[i] = r1();
+      }
+
+      r1.fill(buffer1 + 3U, 100U);
+      r2.fill(buffer2, 103U);
+
+      CHECK_ARRAY_EQUAL(buffer2, buffer1, 103U);
+
+      // Each lane is independent of the number of lanes.
+      uint32_t lane0[12];
+      etl::random_xorshift_lanes<1> r4(1234);
+      r4.fill(lane0, 12U);
+
+      for (size_t i = 0U; i < 12U; ++i)
+      {
+        CHECK_EQUAL(lane0[i], buffer2[i * 8U]);
+      }
+
+      etl::random_xorshift_lanes<4> r3(1234);
+      uint32_t low  = 1234;
+      uint32_t high = 9876;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        uint32_t n = r3.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+    }
+
+    //=========================================================================
+    TEST(test_random_xoshiro256ss_sequence)
+    {
+      // The reference implementation, seeded with { 1, 2, 3, 4 }.
+      etl::random_xoshiro256ss r;
+      r.initialise(1U, 2U, 3U, 4U);
+
+      CHECK_EQUAL(11520ULL, r());
+      CHECK_EQUAL(0ULL, r());
+      CHECK_EQUAL(1509978240ULL, r());
+      CHECK_EQUAL(1215971899390074240ULL, r());
+    }
+
+    //=========================================================================
+    TEST(test_random_xoshiro256ss_jump)
+    {
+      etl::random_xoshiro256ss r1(1234);
+      etl::random_xoshiro256ss r2(1234);
+      etl::random_xoshiro256ss r3(1234);
+
+      r2.jump();
+      r3.long_jump();
+
+      uint64_t n1 = r1();
+      uint64_t n2 = r2();
+      uint64_t n3 = r3();
+
+      CHECK(n1 != n2);
+      CHECK(n1 != n3);
+      CHECK(n2 != n3);
+
+      // Jumping is deterministic.
+      etl::random_xoshiro256ss r4(1234);
+      r4.jump();
+      CHECK_EQUAL(n2, r4());
+    }
+
+    //=========================================================================
+    TEST(test_random_pcg64_sequence)
+    {
+      // The reference implementation, seeded with 42 on stream 54.
+      etl::random_pcg64 r(42U, 54U);
+
+      CHECK_EQUAL(0x86B1DA1D72062B68ULL, r());
+      CHECK_EQUAL(0x1304AA46C9853D39ULL, r());
+      CHECK_EQUAL(0xA3670E9E0DD50358ULL, r());
+    }
+
+    //=========================================================================
+    TEST(test_random_pcg64_streams_and_advance)
+    {
+      etl::random_pcg64 r1(42U, 1U);
+      etl::random_pcg64 r2(42U, 2U);
+
+      CHECK(r1() != r2());
+
+      etl::random_pcg64 r3(42U, 54U);
+      etl::random_pcg64 r4(42U, 54U);
+
+      for (int i = 0; i < 1000; ++i)
+      {
+        r3();
+      }
+
+      r4.advance(1000U);
+
+      CHECK_EQUAL(r3(), r4());
+
+      uint64_t low  = 1234;
+      uint64_t high = 0x123456789ULL;
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        uint64_t n = r3.range(low, high);
+
+        CHECK(n >= low);
+        CHECK(n <= high);
+      }
+    }
   };
 }
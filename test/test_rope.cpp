@@ -0,0 +1,256 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <string.h>
+
+#include "etl/rope.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  // An iovec look alike.
+  struct io_vector
+  {
+    void*  iov_base;
+    size_t iov_len;
+  };
+
+  SUITE(test_rope)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      etl::rope<4, 8> rope;
+
+      CHECK(rope.empty());
+      CHECK(!rope.full());
+      CHECK_EQUAL(0U, rope.size());
+      CHECK_EQUAL(0U, rope.number_of_segments());
+      CHECK_EQUAL(4U, rope.max_segments());
+      CHECK_EQUAL(8U, rope.buffer_available());
+      CHECK(rope.begin() == rope.end());
+    }
+
+    //*************************************************************************
+    TEST(test_append_references)
+    {
+      static const char hello[] = "Hello";
+      etl::string<10> world("World");
+      etl::string_view space(" ");
+
+      etl::rope<4> rope;
+
+      CHECK(rope.append(hello));
+      CHECK(rope.append(space));
+      CHECK(rope.append(world));
+
+      CHECK_EQUAL(11U, rope.size());
+      CHECK_EQUAL(3U, rope.number_of_segments());
+
+      // No copies are made.
+      CHECK(rope[0].data() == hello);
+      CHECK(rope[1].data() == space.data());
+      CHECK(rope[2].data() == world.data());
+
+      etl::string<20> str;
+      rope.flatten_into(str);
+      CHECK(str == "Hello World");
+    }
+
+    //*************************************************************************
+    TEST(test_append_empty)
+    {
+      etl::rope<1> rope;
+
+      CHECK(rope.append("", 0));
+      CHECK(rope.empty());
+      CHECK_EQUAL(0U, rope.number_of_segments());
+    }
+
+    //*************************************************************************
+    TEST(test_append_adjacent_extends_segment)
+    {
+      static const char text[] = "ABCDEF";
+
+      etl::rope<1> rope;
+
+      CHECK(rope.append(text, 2));
+      CHECK(rope.append(text + 2, 3));
+      CHECK(rope.append(text + 5, 1));
+
+      CHECK_EQUAL(1U, rope.number_of_segments());
+      CHECK_EQUAL(6U, rope.size());
+      CHECK(rope[0] == etl::string_view(text));
+    }
+
+    //*************************************************************************
+    TEST(test_append_copy)
+    {
+      etl::rope<4, 8> rope;
+
+      {
+        etl::string<4> temporary("1234");
+        CHECK(rope.append_copy(etl::string_view(temporary)));
+        temporary.assign("XXXX");
+      }
+
+      CHECK(rope.append(" and "));
+      CHECK(rope.append_copy('5'));
+      CHECK(rope.append_copy("67", 2));
+
+      // The copies are in separate segments as " and " is between them.
+      CHECK_EQUAL(3U, rope.number_of_segments());
+      CHECK_EQUAL(1U, rope.buffer_available());
+
+      etl::string<20> str;
+      CHECK(rope.flatten_into(str) == "1234 and 567");
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::rope<2, 2> rope;
+
+      CHECK(rope.append("A"));
+      CHECK(rope.append("B"));
+      CHECK(rope.full());
+
+      CHECK_THROW(rope.append("C"), etl::rope_full);
+      CHECK_THROW(rope.append_copy("CDE", 3), etl::rope_buffer_full);
+
+      CHECK_EQUAL(2U, rope.size());
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::rope<2, 4> rope;
+
+      rope.append_copy("AB", 2);
+      rope.append("C");
+      rope.clear();
+
+      CHECK(rope.empty());
+      CHECK_EQUAL(0U, rope.number_of_segments());
+      CHECK_EQUAL(4U, rope.buffer_available());
+    }
+
+    //*************************************************************************
+    TEST(test_iterate_segments)
+    {
+      etl::rope<3> rope;
+      rope.append("One");
+      rope.append("Two");
+      rope.append("Three");
+
+      std::string result;
+
+      for (etl::irope::const_iterator itr = rope.begin(); itr != rope.end(); ++itr)
+      {
+        result.append(itr->data(), itr->size());
+        result.append("|");
+      }
+
+      CHECK_EQUAL(std::string("One|Two|Three|"), result);
+    }
+
+    //*************************************************************************
+    TEST(test_to_iovec)
+    {
+      etl::rope<3> rope;
+      rope.append("One");
+      rope.append("Two");
+      rope.append("Three");
+
+      io_vector iov[3];
+
+      CHECK_EQUAL(3U, rope.to_iovec(iov, 3));
+      CHECK(iov[0].iov_base == rope[0].data());
+      CHECK_EQUAL(3U, iov[0].iov_len);
+      CHECK(iov[2].iov_base == rope[2].data());
+      CHECK_EQUAL(5U, iov[2].iov_len);
+
+      // Partial export.
+      CHECK_EQUAL(2U, rope.to_iovec(iov, 2));
+      CHECK_EQUAL(1U, rope.to_iovec(iov, 3, 2));
+      CHECK(iov[0].iov_base == rope[2].data());
+
+      // Lengths are in bytes.
+      etl::wrope<1> wrope;
+      wrope.append(L"Wide");
+      CHECK_EQUAL(1U, wrope.to_iovec(iov, 3));
+      CHECK_EQUAL(4U * sizeof(wchar_t), iov[0].iov_len);
+    }
+
+    //*************************************************************************
+    TEST(test_flatten_into_truncates_and_appends)
+    {
+      etl::rope<2> rope;
+      rope.append("Hello");
+      rope.append("World");
+
+      etl::string<8> str("=");
+
+      rope.flatten_into(str, true);
+      CHECK(str == "=HelloWo");
+      CHECK(str.truncated());
+
+      etl::string<20> str2("Old");
+      rope.flatten_into(str2);
+      CHECK(str2 == "HelloWorld");
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      etl::rope<3> rope;
+      rope.append("One");
+      rope.append("Two");
+      rope.append("Three");
+
+      char buffer[12] = { 0 };
+
+      CHECK_EQUAL(11U, rope.copy(buffer, 11));
+      CHECK_EQUAL(0, strcmp(buffer, "OneTwoThree"));
+
+      memset(buffer, 0, sizeof(buffer));
+      CHECK_EQUAL(4U, rope.copy(buffer, 4, 2));
+      CHECK_EQUAL(0, strcmp(buffer, "eTwo"));
+
+      memset(buffer, 0, sizeof(buffer));
+      CHECK_EQUAL(3U, rope.copy(buffer, 10, 8));
+      CHECK_EQUAL(0, strcmp(buffer, "ree"));
+
+      CHECK_EQUAL(0U, rope.copy(buffer, 10, 11));
+    }
+  };
+}
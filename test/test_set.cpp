@@ -1083,5 +1083,65 @@ namespace
             }
         }
     }
+
+    //*************************************************************************
+    TEST(test_compact)
+    {
+      typedef etl::set<std::string, 64> Data;
+
+      Data data;
+      std::set<std::string> compare;
+
+      // Churn the pool so that the nodes are out of address order.
+      for (int i = 0; i < 64; ++i)
+      {
+        std::string key = std::to_string((i * 37) % 64);
+        data.insert(key);
+        compare.insert(key);
+      }
+
+      for (int i = 0; i < 64; i += 3)
+      {
+        data.erase(std::to_string(i));
+        compare.erase(std::to_string(i));
+      }
+
+      for (int i = 100; i < 110; ++i)
+      {
+        data.insert(std::to_string(i));
+        compare.insert(std::to_string(i));
+      }
+
+      CHECK(data.compact());
+
+      CHECK_EQUAL(compare.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+
+      // The nodes are now in ascending address order.
+      const std::string* p_previous = nullptr;
+
+      for (Data::const_iterator itr = data.begin(); itr != data.end(); ++itr)
+      {
+        CHECK(p_previous < &*itr);
+        p_previous = &*itr;
+      }
+
+      // Still a valid tree.
+      for (std::set<std::string>::const_iterator itr = compare.begin(); itr != compare.end(); ++itr)
+      {
+        CHECK(data.find(*itr) != data.end());
+      }
+
+      for (int i = 200; i < 210; ++i)
+      {
+        data.insert(std::to_string(i));
+        compare.insert(std::to_string(i));
+      }
+
+      data.erase("100");
+      compare.erase("100");
+
+      CHECK(std::equal(data.begin(), data.end(), compare.begin()));
+    }
   };
 }
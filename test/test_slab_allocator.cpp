@@ -0,0 +1,284 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <vector>
+
+#include "etl/slab_allocator.h"
+
+namespace
+{
+  typedef etl::slab_allocator<256, 4> Slab;
+
+  SUITE(test_slab_allocator)
+  {
+    //*************************************************************************
+    TEST(test_default_classes)
+    {
+      Slab slab;
+
+      CHECK_EQUAL(4U, slab.class_count());
+      CHECK_EQUAL(sizeof(void*) * 8U, slab.max_block_size());
+
+      for (size_t i = 0U; i < slab.class_count(); ++i)
+      {
+        etl::slab_class_statistics stats = slab.statistics(i);
+
+        CHECK_EQUAL(sizeof(void*) << i, stats.block_size);
+        CHECK_EQUAL(256U / stats.block_size, stats.capacity);
+        CHECK_EQUAL(0U, stats.in_use);
+        CHECK_EQUAL(0U, stats.peak);
+        CHECK_EQUAL(0U, stats.allocations);
+        CHECK_EQUAL(0U, stats.overflows);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_smallest_class)
+    {
+      Slab slab;
+
+      void* p1 = slab.allocate(1U);
+      void* p2 = slab.allocate(sizeof(void*) + 1U);
+      void* p3 = slab.allocate(sizeof(void*) * 3U);
+      void* p4 = slab.allocate(sizeof(void*) * 8U);
+
+      CHECK_EQUAL(0U, slab.class_index(p1));
+      CHECK_EQUAL(1U, slab.class_index(p2));
+      CHECK_EQUAL(2U, slab.class_index(p3));
+      CHECK_EQUAL(3U, slab.class_index(p4));
+
+      CHECK_EQUAL(1U, slab.statistics(0U).in_use);
+      CHECK_EQUAL(1U, slab.statistics(1U).in_use);
+      CHECK_EQUAL(1U, slab.statistics(2U).in_use);
+      CHECK_EQUAL(1U, slab.statistics(3U).in_use);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_alignment)
+    {
+      Slab slab;
+
+      // The block must come from a class whose blocks are a multiple of the alignment.
+      void* p = slab.allocate(4U, Slab::ALIGNMENT);
+
+      CHECK((reinterpret_cast<uintptr_t>(p) % Slab::ALIGNMENT) == 0U);
+      CHECK((slab.statistics(slab.class_index(p)).block_size % Slab::ALIGNMENT) == 0U);
+
+      // Alignment larger than the slab alignment.
+      CHECK_THROW(slab.allocate(4U, Slab::ALIGNMENT * 2U), etl::slab_allocator_no_allocation);
+
+      // Zero alignment is treated as one.
+      void* p0 = slab.allocate(4U, 0U);
+      CHECK(p0 != nullptr);
+      CHECK_EQUAL(0U, slab.class_index(p0));
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_overflow_to_larger_class)
+    {
+      Slab slab;
+
+      const size_t capacity = slab.statistics(0U).capacity;
+
+      for (size_t i = 0U; i < capacity; ++i)
+      {
+        CHECK_EQUAL(0U, slab.class_index(slab.allocate(1U)));
+      }
+
+      void* p = slab.allocate(1U);
+
+      CHECK_EQUAL(1U, slab.class_index(p));
+      CHECK_EQUAL(1U, slab.statistics(0U).overflows);
+      CHECK_EQUAL(capacity, slab.statistics(0U).allocations);
+      CHECK_EQUAL(1U, slab.statistics(1U).allocations);
+      CHECK_EQUAL(0U, slab.statistics(1U).overflows);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_too_large)
+    {
+      Slab slab;
+
+      CHECK_THROW(slab.allocate(slab.max_block_size() + 1U), etl::slab_allocator_no_allocation);
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_exhausted)
+    {
+      Slab slab;
+
+      const size_t capacity = slab.statistics(3U).capacity;
+
+      for (size_t i = 0U; i < capacity; ++i)
+      {
+        slab.allocate(slab.max_block_size());
+      }
+
+      CHECK_THROW(slab.allocate(slab.max_block_size()), etl::slab_allocator_no_allocation);
+      CHECK_EQUAL(1U, slab.statistics(3U).overflows);
+    }
+
+    //*************************************************************************
+    TEST(test_deallocate)
+    {
+      etl::slab_allocator<2048, 4> slab;
+
+      std::vector<void*> blocks;
+
+      for (size_t size = 1U; size <= slab.max_block_size(); ++size)
+      {
+        blocks.push_back(slab.allocate(size));
+      }
+
+      for (size_t i = 0U; i < slab.class_count(); ++i)
+      {
+        CHECK(slab.statistics(i).in_use > 0U);
+      }
+
+      for (size_t i = 0U; i < blocks.size(); ++i)
+      {
+        slab.deallocate(blocks[i]);
+      }
+
+      for (size_t i = 0U; i < slab.class_count(); ++i)
+      {
+        etl::slab_class_statistics stats = slab.statistics(i);
+
+        CHECK_EQUAL(0U, stats.in_use);
+        CHECK(stats.peak > 0U);
+        CHECK_EQUAL(stats.peak, stats.allocations);
+      }
+
+      // Freed blocks are reused.
+      void* p = slab.allocate(1U);
+      CHECK_EQUAL(1U, slab.statistics(0U).in_use);
+      slab.deallocate(p);
+
+      // Null is ignored.
+      slab.deallocate(nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_deallocate_not_in_slab)
+    {
+      Slab slab;
+
+      int i;
+
+      CHECK(!slab.is_in_slab(&i));
+      CHECK_THROW(slab.deallocate(&i), etl::slab_allocator_not_in_slab);
+    }
+
+    //*************************************************************************
+    TEST(test_reset_statistics_and_release_all)
+    {
+      Slab slab;
+
+      void* p1 = slab.allocate(1U);
+      slab.allocate(1U);
+      slab.deallocate(p1);
+
+      slab.reset_statistics();
+
+      etl::slab_class_statistics stats = slab.statistics(0U);
+      CHECK_EQUAL(1U, stats.in_use);
+      CHECK_EQUAL(1U, stats.peak);
+      CHECK_EQUAL(0U, stats.allocations);
+
+      slab.release_all();
+      CHECK_EQUAL(0U, slab.statistics(0U).in_use);
+    }
+
+    //*************************************************************************
+    TEST(test_user_classes)
+    {
+      const size_t sizes[3] = { 16U, 48U, 96U };
+
+      etl::slab_allocator<512, 3> slab(sizes);
+
+      CHECK_EQUAL(16U, slab.statistics(0U).block_size);
+      CHECK_EQUAL(48U, slab.statistics(1U).block_size);
+      CHECK_EQUAL(96U, slab.statistics(2U).block_size);
+      CHECK_EQUAL(512U / 48U, slab.statistics(1U).capacity);
+
+      void* p = slab.allocate(40U);
+      CHECK_EQUAL(1U, slab.class_index(p));
+      slab.deallocate(p);
+    }
+
+    //*************************************************************************
+    TEST(test_user_classes_invalid)
+    {
+      const size_t unordered[2] = { 32U, 16U };
+      const size_t too_small[2] = { 1U, 16U };
+      const size_t too_large[2] = { 16U, 1024U };
+
+      typedef etl::slab_allocator<512, 2> Slab2;
+
+      CHECK_THROW(Slab2 slab(unordered), etl::slab_allocator_class_size);
+      CHECK_THROW(Slab2 slab(too_small), etl::slab_allocator_class_size);
+      CHECK_THROW(Slab2 slab(too_large), etl::slab_allocator_class_size);
+    }
+
+#if defined(ETL_SLAB_MEMORY_RESOURCE_SUPPORTED)
+    //*************************************************************************
+    TEST(test_memory_resource)
+    {
+      etl::slab_allocator<4096, 6> slab;
+      etl::slab_memory_resource resource(slab);
+
+      CHECK(&resource.get_slab_allocator() == &slab);
+      CHECK(resource.is_equal(resource));
+
+      {
+        std::pmr::vector<int> data(&resource);
+
+        for (int i = 0; i < 32; ++i)
+        {
+          data.push_back(i);
+        }
+
+        for (int i = 0; i < 32; ++i)
+        {
+          CHECK_EQUAL(i, data[i]);
+        }
+
+        CHECK(slab.is_in_slab(data.data()));
+      }
+
+      for (size_t i = 0U; i < slab.class_count(); ++i)
+      {
+        CHECK_EQUAL(0U, slab.statistics(i).in_use);
+      }
+    }
+#endif
+  };
+}
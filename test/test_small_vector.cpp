@@ -0,0 +1,347 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "etl/small_vector.h"
+
+namespace
+{
+  typedef etl::small_vector<int, 4, 32>         IntVector;
+  typedef etl::small_vector<std::string, 2, 16> StringVector;
+
+  typedef etl::pool<IntVector::block_type, 2>    IntPool;
+  typedef etl::pool<StringVector::block_type, 2> StringPool;
+
+  SUITE(test_small_vector)
+  {
+    //*************************************************************************
+    TEST(test_inline)
+    {
+      IntPool pool;
+      IntVector data(pool);
+
+      CHECK(data.empty());
+      CHECK(data.is_inline());
+      CHECK_EQUAL(4U, data.capacity());
+
+      for (int i = 0; i < 4; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(data.is_inline());
+      CHECK(data.full());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_to_pool)
+    {
+      IntPool pool;
+      IntVector data(pool);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        data.push_back(i);
+      }
+
+      CHECK(!data.is_inline());
+      CHECK_EQUAL(32U, data.capacity());
+      CHECK_EQUAL(20U, data.size());
+      CHECK_EQUAL(1U, pool.size());
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(i, data[i]);
+      }
+
+      data.resize(32);
+      CHECK_THROW(data.push_back(99), etl::vector_full);
+    }
+
+    //*************************************************************************
+    TEST(test_spill_pool_exhausted)
+    {
+      IntPool pool;
+      IntVector data1(pool);
+      IntVector data2(pool);
+      IntVector data3(pool);
+
+      data1.resize(10);
+      data2.resize(10);
+
+      data3.assign(4U, 1);
+      CHECK_THROW(data3.push_back(2), etl::vector_full);
+      CHECK(data3.is_inline());
+      CHECK_EQUAL(4U, data3.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_releases_block)
+    {
+      IntPool pool;
+
+      {
+        IntVector data(pool);
+        data.resize(8);
+        CHECK_EQUAL(1U, pool.size());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_shrink_to_fit)
+    {
+      StringPool pool;
+      StringVector data(pool);
+
+      data.push_back("one");
+      data.push_back("two");
+      data.push_back("three");
+
+      CHECK(!data.is_inline());
+
+      data.shrink_to_fit();
+      CHECK(!data.is_inline());
+
+      data.pop_back();
+      data.shrink_to_fit();
+
+      CHECK(data.is_inline());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK_EQUAL(2U, data.size());
+      CHECK_EQUAL(std::string("one"), data[0]);
+      CHECK_EQUAL(std::string("two"), data[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_non_trivial_spill)
+    {
+      StringPool pool;
+      StringVector data(pool);
+
+      data.push_back(std::string(40, 'a'));
+      data.push_back(std::string(40, 'b'));
+      data.emplace_back(40, 'c');
+
+      CHECK(!data.is_inline());
+      CHECK_EQUAL(std::string(40, 'a'), data[0]);
+      CHECK_EQUAL(std::string(40, 'b'), data[1]);
+      CHECK_EQUAL(std::string(40, 'c'), data[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_spill_with_own_element)
+    {
+      StringPool pool;
+
+      StringVector data1(pool);
+      data1.push_back(std::string(40, 'a'));
+      data1.push_back(std::string(40, 'b'));
+      data1.push_back(data1[0]);
+      CHECK(!data1.is_inline());
+      CHECK_EQUAL(std::string(40, 'a'), data1[2]);
+
+      StringVector data2(pool);
+      data2.push_back(std::string(40, 'a'));
+      data2.push_back(std::string(40, 'b'));
+      data2.insert(data2.begin(), data2[1]);
+      CHECK(!data2.is_inline());
+      CHECK_EQUAL(std::string(40, 'b'), data2[0]);
+      CHECK_EQUAL(std::string(40, 'a'), data2[1]);
+      CHECK_EQUAL(std::string(40, 'b'), data2[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_spill_with_own_element)
+    {
+      StringPool pool;
+
+      StringVector data1(pool);
+      data1.push_back(std::string(40, 'a'));
+      data1.push_back(std::string(40, 'b'));
+      data1.emplace_back(data1[1]);
+      CHECK(!data1.is_inline());
+      CHECK_EQUAL(std::string(40, 'b'), data1[2]);
+
+      StringVector data2(pool);
+      data2.push_back(std::string(40, 'a'));
+      data2.push_back(std::string(40, 'b'));
+      data2.emplace(data2.begin() + 1, data2[0]);
+      CHECK(!data2.is_inline());
+      CHECK_EQUAL(std::string(40, 'a'), data2[0]);
+      CHECK_EQUAL(std::string(40, 'a'), data2[1]);
+      CHECK_EQUAL(std::string(40, 'b'), data2[2]);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_spill)
+    {
+      IntPool pool;
+      IntVector data(pool);
+
+      int initial[] = { 0, 1, 2, 3 };
+      data.assign(initial, initial + 4);
+
+      IntVector::iterator itr = data.insert(data.begin() + 2, 10);
+      CHECK(!data.is_inline());
+      CHECK_EQUAL(10, *itr);
+
+      const int more[] = { 20, 21, 22 };
+      data.insert(data.begin() + 1, more, more + 3);
+
+      const int expected[] = { 0, 20, 21, 22, 1, 10, 2, 3 };
+      CHECK_EQUAL(8U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), expected));
+
+      data.insert(data.end(), 3U, 7);
+      CHECK_EQUAL(11U, data.size());
+      CHECK_EQUAL(7, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_assign_spill)
+    {
+      IntPool pool;
+      IntVector data(pool);
+
+      std::vector<int> source(12);
+
+      for (size_t i = 0U; i < source.size(); ++i)
+      {
+        source[i] = int(i);
+      }
+
+      data.assign(source.begin(), source.end());
+
+      CHECK_EQUAL(12U, data.size());
+      CHECK(std::equal(data.begin(), data.end(), source.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      etl::pool<IntVector::block_type, 3> pool;
+      IntVector data(pool);
+      data.resize(10, 5);
+
+      IntVector copy(data);
+      CHECK_EQUAL(2U, pool.size());
+      CHECK(copy == data);
+
+      IntVector other(pool);
+      other.push_back(1);
+      other = data;
+      CHECK(other == data);
+    }
+
+    //*************************************************************************
+    TEST(test_ivector_interface)
+    {
+      IntPool pool;
+      IntVector data(pool);
+
+      etl::ivector<int>& ref = data;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        ref.push_back(i);
+      }
+
+      CHECK_EQUAL(10U, data.size());
+      CHECK_EQUAL(9, ref.back());
+    }
+
+    //*************************************************************************
+    TEST(test_ivector_resize_and_insert)
+    {
+      IntPool pool;
+      IntVector data(pool);
+
+      etl::ivector<int>& ref = data;
+
+      ref.resize(6, 1);
+      CHECK(!data.is_inline());
+      CHECK_EQUAL(6U, data.size());
+
+      ref.insert(ref.begin(), 5U, 2);
+      CHECK_EQUAL(11U, data.size());
+      CHECK_EQUAL(2, data.front());
+      CHECK_EQUAL(1, data.back());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_to_arena)
+    {
+      etl::aligned_storage<1024, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      {
+        IntVector data(arena);
+
+        for (int i = 0; i < 10; ++i)
+        {
+          data.push_back(i);
+        }
+
+        CHECK(!data.is_inline());
+        CHECK_EQUAL(32U, data.capacity());
+        CHECK(arena.size() >= sizeof(IntVector::block_type));
+
+        for (int i = 0; i < 10; ++i)
+        {
+          CHECK_EQUAL(i, data[i]);
+        }
+      }
+
+      arena.reset();
+      CHECK_EQUAL(0U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_arena_exhausted)
+    {
+      etl::aligned_storage<64, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      IntVector data(arena);
+      data.resize(4);
+
+      CHECK_THROW(data.push_back(1), etl::vector_full);
+      CHECK(data.is_inline());
+      CHECK_EQUAL(0U, arena.size());
+    }
+  };
+}
@@ -0,0 +1,301 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <string>
+#include <algorithm>
+
+#include "etl/soa_vector.h"
+
+namespace
+{
+  // id, x, y, name
+  typedef etl::soa_vector<8, int, float, double, std::string> Data;
+
+  enum
+  {
+    ID,
+    X,
+    Y,
+    NAME
+  };
+
+  //***************************************************************************
+  void fill(Data& data)
+  {
+    data.push_back(3, 3.0f, 30.0, std::string("three"));
+    data.push_back(1, 1.0f, 10.0, std::string("one"));
+    data.push_back(4, 4.0f, 40.0, std::string("four"));
+    data.push_back(2, 2.0f, 20.0, std::string("two"));
+  }
+
+  //***************************************************************************
+  bool rows_in_sync(const Data& data)
+  {
+    for (size_t i = 0U; i < data.size(); ++i)
+    {
+      const int id = data.get<ID>(i);
+
+      if ((data.get<X>(i) != float(id)) || (data.get<Y>(i) != (id * 10.0)))
+      {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+  SUITE(test_soa_vector)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Data data;
+
+      CHECK(data.empty());
+      CHECK(!data.full());
+      CHECK_EQUAL(0U, data.size());
+      CHECK_EQUAL(8U, data.max_size());
+      CHECK_EQUAL(8U, data.available());
+      CHECK_EQUAL(4U, Data::COLUMN_COUNT);
+    }
+
+    //*************************************************************************
+    TEST(test_columns_are_contiguous_and_aligned)
+    {
+      Data data;
+      fill(data);
+
+      CHECK((reinterpret_cast<uintptr_t>(data.data<Y>()) % etl::alignment_of<double>::value) == 0U);
+      CHECK(&data.get<X>(1) == &data.get<X>(0) + 1);
+      CHECK(&data.get<Y>(3) == &data.get<Y>(0) + 3);
+
+      etl::array_view<float> x = data.column<X>();
+
+      CHECK_EQUAL(4U, x.size());
+      CHECK(x.data() == data.data<X>());
+
+      float sum = 0.0f;
+
+      for (size_t i = 0U; i < x.size(); ++i)
+      {
+        sum += x[i];
+      }
+
+      CHECK_CLOSE(10.0f, sum, 0.0001f);
+    }
+
+    //*************************************************************************
+    TEST(test_push_back_full)
+    {
+      Data data;
+
+      for (int i = 0; i < 8; ++i)
+      {
+        data.push_back(i, float(i), i * 10.0, std::string("x"));
+      }
+
+      CHECK(data.full());
+      CHECK_THROW(data.push_back(9, 9.0f, 90.0, std::string("y")), etl::soa_vector_full);
+      CHECK(rows_in_sync(data));
+    }
+
+    //*************************************************************************
+    TEST(test_row_reference)
+    {
+      Data data;
+      fill(data);
+
+      Data::row_reference row = data[2];
+
+      CHECK_EQUAL(2U, row.index());
+      CHECK_EQUAL(4, row.get<ID>());
+      CHECK_EQUAL(std::string("four"), row.get<NAME>());
+
+      row.get<NAME>() = "FOUR";
+      CHECK_EQUAL(std::string("FOUR"), data.get<NAME>(2));
+
+      const Data& cdata = data;
+      Data::const_row_reference crow = cdata[1];
+      CHECK_EQUAL(1, crow.get<ID>());
+
+      CHECK_EQUAL(3, data.front().get<ID>());
+      CHECK_EQUAL(2, data.back().get<ID>());
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_back)
+    {
+      Data data;
+
+      Data::row_reference row = data.emplace_back();
+
+      CHECK_EQUAL(1U, data.size());
+      CHECK_EQUAL(0, row.get<ID>());
+      CHECK(row.get<NAME>().empty());
+
+      row.get<ID>() = 5;
+      CHECK_EQUAL(5, data.get<ID>(0));
+    }
+
+    //*************************************************************************
+    TEST(test_at)
+    {
+      Data data;
+      fill(data);
+
+      CHECK_EQUAL(4, data.at<ID>(2));
+      CHECK_THROW(data.at<ID>(4), etl::soa_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_back)
+    {
+      Data data;
+      fill(data);
+
+      data.pop_back();
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(4, data.back().get<ID>());
+
+      data.clear();
+      CHECK_THROW(data.pop_back(), etl::soa_vector_empty);
+    }
+
+    //*************************************************************************
+    TEST(test_erase)
+    {
+      Data data;
+      fill(data);
+
+      data.erase(1);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(3, data.get<ID>(0));
+      CHECK_EQUAL(4, data.get<ID>(1));
+      CHECK_EQUAL(2, data.get<ID>(2));
+      CHECK_EQUAL(std::string("four"), data.get<NAME>(1));
+      CHECK(rows_in_sync(data));
+
+      CHECK_THROW(data.erase(3), etl::soa_vector_out_of_bounds);
+    }
+
+    //*************************************************************************
+    TEST(test_erase_unordered)
+    {
+      Data data;
+      fill(data);
+
+      data.erase_unordered(0);
+
+      CHECK_EQUAL(3U, data.size());
+      CHECK_EQUAL(2, data.get<ID>(0));
+      CHECK_EQUAL(std::string("two"), data.get<NAME>(0));
+      CHECK(rows_in_sync(data));
+
+      data.erase_unordered(2);
+      CHECK_EQUAL(2U, data.size());
+      CHECK(rows_in_sync(data));
+    }
+
+    //*************************************************************************
+    TEST(test_sort_by)
+    {
+      Data data;
+      fill(data);
+
+      data.sort_by<ID>();
+
+      for (int i = 0; i < 4; ++i)
+      {
+        CHECK_EQUAL(i + 1, data.get<ID>(i));
+      }
+
+      CHECK(rows_in_sync(data));
+      CHECK_EQUAL(std::string("one"),   data.get<NAME>(0));
+      CHECK_EQUAL(std::string("four"),  data.get<NAME>(3));
+
+      data.sort_by<NAME>();
+
+      CHECK_EQUAL(std::string("four"),  data.get<NAME>(0));
+      CHECK_EQUAL(std::string("one"),   data.get<NAME>(1));
+      CHECK_EQUAL(std::string("three"), data.get<NAME>(2));
+      CHECK_EQUAL(std::string("two"),   data.get<NAME>(3));
+      CHECK(rows_in_sync(data));
+
+      data.sort_by<Y>(std::greater<double>());
+
+      CHECK_EQUAL(4, data.get<ID>(0));
+      CHECK_EQUAL(1, data.get<ID>(3));
+      CHECK(rows_in_sync(data));
+    }
+
+    //*************************************************************************
+    TEST(test_sort_by_full)
+    {
+      etl::soa_vector<64, int, int> data;
+
+      for (int i = 0; i < 64; ++i)
+      {
+        const int key = (i * 37) % 64;
+        data.push_back(key, -key);
+      }
+
+      data.sort_by<0>();
+
+      CHECK(std::is_sorted(data.data<0>(), data.data<0>() + data.size()));
+
+      for (size_t i = 0U; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(-data.get<0>(i), data.get<1>(i));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Data data;
+      fill(data);
+
+      Data copy(data);
+
+      CHECK_EQUAL(data.size(), copy.size());
+      CHECK(rows_in_sync(copy));
+      CHECK_EQUAL(std::string("three"), copy.get<NAME>(0));
+
+      Data other;
+      other.push_back(9, 9.0f, 90.0, std::string("nine"));
+      other = data;
+
+      CHECK_EQUAL(4U, other.size());
+      CHECK_EQUAL(std::string("two"), other.get<NAME>(3));
+    }
+  };
+}
@@ -0,0 +1,324 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <string>
+
+#include "etl/sso_string.h"
+#include "etl/cstring.h"
+#include "etl/pool.h"
+#include "etl/arena.h"
+#include "etl/to_string.h"
+#include "etl/format.h"
+
+namespace
+{
+  SUITE(test_sso_string)
+  {
+    static const size_t INLINE_SIZE = 7;
+    static const size_t MAX_SIZE    = 40;
+
+    typedef etl::sso_string<INLINE_SIZE, MAX_SIZE> Text;
+    typedef etl::pool<Text::block_type, 2>         Pool;
+
+    //*************************************************************************
+    bool Equal(const std::string& compare, const etl::istring& text)
+    {
+      return (compare.size() == text.size()) &&
+             (compare == text.c_str());
+    }
+
+    //*************************************************************************
+    TEST(test_inline)
+    {
+      Pool pool;
+      Text text(pool, "short");
+
+      CHECK(Equal("short", text));
+      CHECK(text.is_inline());
+      CHECK_EQUAL(INLINE_SIZE, text.capacity());
+      CHECK_EQUAL(0U, pool.size());
+      CHECK(!text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_construct_long)
+    {
+      Pool pool;
+      Text text(pool, "longer than inline");
+
+      CHECK(Equal("longer than inline", text));
+      CHECK(!text.is_inline());
+      CHECK_EQUAL(MAX_SIZE, text.capacity());
+      CHECK_EQUAL(1U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_on_append)
+    {
+      Pool pool;
+      Text text(pool, "abcdef");
+
+      text.append("ghijkl");
+
+      CHECK(Equal("abcdefghijkl", text));
+      CHECK(!text.is_inline());
+      CHECK(!text.truncated());
+
+      text += text;
+
+      CHECK(Equal("abcdefghijklabcdefghijkl", text));
+    }
+
+    //*************************************************************************
+    TEST(test_spill_on_self_append)
+    {
+      Pool pool;
+      Text text(pool, "abcdef");
+
+      text.append(text.begin(), text.end());
+
+      CHECK(Equal("abcdefabcdef", text));
+      CHECK(!text.is_inline());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_on_push_back)
+    {
+      Pool pool;
+      Text text(pool);
+      std::string compare;
+
+      for (size_t i = 0; i < MAX_SIZE; ++i)
+      {
+        text.push_back(char('a' + (i % 26)));
+        compare.push_back(char('a' + (i % 26)));
+
+        CHECK_EQUAL(i >= INLINE_SIZE, !text.is_inline());
+      }
+
+      CHECK(Equal(compare, text));
+      CHECK(!text.truncated());
+
+      text.push_back('!');
+      CHECK(Equal(compare, text));
+      CHECK(text.truncated());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_on_insert_and_assign)
+    {
+      Pool pool;
+      Text text1(pool, "world");
+      Text text2(pool);
+
+      text1.insert(0, "hello ");
+      CHECK(Equal("hello world", text1));
+
+      text2.assign(20, 'x');
+      CHECK(Equal(std::string(20, 'x'), text2));
+
+      text2.resize(30, 'y');
+      CHECK(Equal(std::string(20, 'x') + std::string(10, 'y'), text2));
+
+      CHECK_EQUAL(2U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_on_insert_at_end)
+    {
+      Pool pool;
+      Text text(pool, "abcdefg");
+
+      CHECK(text.is_inline());
+      CHECK(text.full());
+
+      Text::iterator itr = text.insert(text.cend(), 'h');
+
+      CHECK(Equal("abcdefgh", text));
+      CHECK(!text.is_inline());
+      CHECK(itr == (text.end() - 1));
+
+      itr = text.insert(text.cend(), 'i');
+
+      CHECK(Equal("abcdefghi", text));
+      CHECK(itr == (text.end() - 1));
+    }
+
+    //*************************************************************************
+    TEST(test_pool_full_truncates)
+    {
+      Pool pool;
+      Text text1(pool, "first long string");
+      Text text2(pool, "second long string");
+      Text text3(pool, "third long string");
+
+      CHECK(!text1.truncated());
+      CHECK(!text2.truncated());
+      CHECK(text3.is_inline());
+      CHECK(text3.truncated());
+      CHECK(Equal("third l", text3));
+    }
+
+    //*************************************************************************
+    TEST(test_shrink_to_fit)
+    {
+      Pool pool;
+      Text text(pool, "longer than inline");
+
+      text.shrink_to_fit();
+      CHECK(!text.is_inline());
+
+      text.assign("tiny");
+      text.shrink_to_fit();
+
+      CHECK(Equal("tiny", text));
+      CHECK(text.is_inline());
+      CHECK_EQUAL(INLINE_SIZE, text.capacity());
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_destructor_releases)
+    {
+      Pool pool;
+
+      {
+        Text text(pool, "longer than inline");
+        CHECK_EQUAL(1U, pool.size());
+      }
+
+      CHECK_EQUAL(0U, pool.size());
+    }
+
+    //*************************************************************************
+    TEST(test_copy)
+    {
+      Pool pool;
+      Text text1(pool, "longer than inline");
+      Text text2(text1);
+      Text text3(pool);
+
+      CHECK(Equal("longer than inline", text2));
+      CHECK_EQUAL(2U, pool.size());
+
+      text3 = "ok";
+      text3 = text3;
+      CHECK(Equal("ok", text3));
+
+      etl::string<20> text4("etl");
+      text3 = text4;
+      CHECK(text3 == text4);
+    }
+
+    //*************************************************************************
+    TEST(test_to_string)
+    {
+      Pool pool;
+      Text text(pool);
+
+      etl::to_string(123456789, text);
+      CHECK(Equal("123456789", text));
+
+      etl::to_string(-42, text, true);
+      CHECK(Equal("123456789-42", text));
+    }
+
+    //*************************************************************************
+    TEST(test_to_string_width_spills)
+    {
+      Pool pool;
+
+      Text right(pool, "abc");
+      etl::to_string(int64_t(1234567890123), right, etl::format_spec().width(20).right(), true);
+      CHECK(!right.is_inline());
+      CHECK(Equal("abc       1234567890123", right));
+
+      Text left(pool, "abc");
+      etl::to_string(int64_t(1234567890123), left, etl::format_spec().width(20).left(), true);
+      CHECK(!left.is_inline());
+      CHECK(Equal("abc1234567890123       ", left));
+    }
+
+    //*************************************************************************
+    TEST(test_format_width_spills)
+    {
+      Pool pool;
+
+      Text text(pool, "abc");
+      etl::format_to(text, "{:>10}|{:<6}|{:8}", "abcdefgh", 42, true);
+      CHECK(!text.is_inline());
+      CHECK(Equal("abc  abcdefgh|42    |true    ", text));
+    }
+
+    //*************************************************************************
+    TEST(test_spill_to_arena)
+    {
+      etl::aligned_storage<256, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      {
+        Text text(arena, "short");
+
+        CHECK(text.is_inline());
+        CHECK_EQUAL(0U, arena.size());
+
+        text.append(" and longer");
+
+        CHECK(Equal("short and longer", text));
+        CHECK(!text.is_inline());
+        CHECK_EQUAL(MAX_SIZE, text.capacity());
+        CHECK(arena.size() >= sizeof(Text::block_type));
+
+        Text copy(text);
+
+        CHECK(Equal("short and longer", copy));
+        CHECK(!copy.is_inline());
+        CHECK(arena.size() >= (2U * sizeof(Text::block_type)));
+      }
+
+      arena.reset();
+      CHECK_EQUAL(0U, arena.size());
+    }
+
+    //*************************************************************************
+    TEST(test_spill_arena_exhausted)
+    {
+      etl::aligned_storage<16, 8>::type buffer;
+      etl::arena arena(&buffer, sizeof(buffer));
+
+      Text text(arena, "longer than inline");
+
+      CHECK(text.is_inline());
+      CHECK(text.truncated());
+      CHECK(Equal("longer ", text));
+      CHECK_EQUAL(0U, arena.size());
+    }
+  };
+}
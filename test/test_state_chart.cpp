@@ -34,6 +34,8 @@ SOFTWARE.
 #include "etl/array.h"
 
 #include <iostream>
+#include <vector>
+#include <algorithm>
 
 namespace
 {
@@ -232,6 +234,61 @@ namespace
 
   MotorControl motorControl;
 
+  //***********************************
+  // A state chart using the transition index.
+  // The last state and event ids are outside of the index.
+  //***********************************
+  class IndexedChart : public etl::indexed_state_chart<IndexedChart, 2, 2>
+  {
+  public:
+
+    IndexedChart()
+      : indexed_state_chart<IndexedChart, 2, 2>(*this, transitionTable.begin(), transitionTable.end(), 0)
+      , guard(false)
+      , first(0)
+      , second(0)
+      , any(0)
+    {
+    }
+
+    bool Guard()  { return guard; }
+    void First()  { ++first; }
+    void Second() { ++second; }
+    void Any()    { ++any; }
+
+    bool guard;
+    int  first;
+    int  second;
+    int  any;
+
+    static const etl::array<IndexedChart::transition, 5> transitionTable;
+  };
+
+  const etl::array<IndexedChart::transition, 5> IndexedChart::transitionTable =
+  {
+    IndexedChart::transition(0, 0, 1, &IndexedChart::First, &IndexedChart::Guard),
+    IndexedChart::transition(0, 0, 0, &IndexedChart::Second),
+    IndexedChart::transition(1, 1, 2),
+    IndexedChart::transition(2, 5, 0),
+    IndexedChart::transition(   0, 0, &IndexedChart::Any)
+  };
+
+  //***************************************************************************
+  /// Supplies its own transition index storage, so that it can be inspected.
+  //***************************************************************************
+  class ReindexedChart : public etl::state_chart<ReindexedChart>
+  {
+  public:
+
+    ReindexedChart(const transition* transition_table_begin_, const transition* transition_table_end_)
+      : etl::state_chart<ReindexedChart>(*this, transition_table_begin_, transition_table_end_, 0)
+    {
+      set_transition_index(index, 2, 2);
+    }
+
+    uint16_t index[4];
+  };
+
   SUITE(test_state_chart_class)
   {
     //*************************************************************************
@@ -462,5 +519,73 @@ namespace
       motorControl.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControl.get_state_id()));
     }
+
+    //*************************************************************************
+    TEST(test_indexed_state_chart)
+    {
+      IndexedChart chart;
+      chart.start();
+
+      // Guard fails, so the second matching transition is taken.
+      chart.process_event(0);
+      CHECK_EQUAL(0, chart.get_state_id());
+      CHECK_EQUAL(0, chart.first);
+      CHECK_EQUAL(1, chart.second);
+
+      chart.guard = true;
+      chart.process_event(0);
+      CHECK_EQUAL(1, chart.get_state_id());
+      CHECK_EQUAL(1, chart.first);
+      CHECK_EQUAL(1, chart.second);
+
+      // 'From any state' transition.
+      chart.process_event(0);
+      CHECK_EQUAL(0, chart.get_state_id());
+      CHECK_EQUAL(1, chart.any);
+
+      chart.process_event(0);
+      chart.process_event(1);
+      CHECK_EQUAL(2, chart.get_state_id());
+
+      // State and event outside of the index.
+      chart.process_event(1);
+      CHECK_EQUAL(2, chart.get_state_id());
+      chart.process_event(5);
+      CHECK_EQUAL(0, chart.get_state_id());
+    }
+
+    //*************************************************************************
+    TEST(test_index_rebuilt_after_oversized_table)
+    {
+      const ReindexedChart::transition small_table[] =
+      {
+        ReindexedChart::transition(0, 0, 1),
+        ReindexedChart::transition(1, 1, 0)
+      };
+
+      // Too many transitions for the index.
+      std::vector<ReindexedChart::transition> large_table(0xFFFFU, ReindexedChart::transition(1, 1, 0));
+
+      ReindexedChart chart(small_table, small_table + 2);
+      CHECK_EQUAL(0U, chart.index[0]);
+
+      chart.set_transition_table(large_table.data(), large_table.data() + large_table.size());
+      chart.start();
+      chart.process_event(1);
+      CHECK_EQUAL(0, chart.get_state_id());
+
+      // The index is rebuilt for a table that fits.
+      std::fill_n(chart.index, 4, uint16_t(0x1234U));
+      chart.set_transition_table(small_table, small_table + 2);
+      CHECK_EQUAL(0U,      chart.index[0]);
+      CHECK_EQUAL(0xFFFFU, chart.index[1]);
+      CHECK_EQUAL(0xFFFFU, chart.index[2]);
+      CHECK_EQUAL(1U,      chart.index[3]);
+
+      chart.process_event(0);
+      CHECK_EQUAL(1, chart.get_state_id());
+      chart.process_event(1);
+      CHECK_EQUAL(0, chart.get_state_id());
+    }
   };
 }
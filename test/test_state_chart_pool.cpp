@@ -0,0 +1,227 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "etl/state_chart_pool.h"
+#include "etl/array.h"
+
+namespace
+{
+  //***************************************************************************
+  // Events
+  struct EventId
+  {
+    enum
+    {
+      CONNECT,
+      CONNECTED,
+      DISCONNECT,
+      RESET,
+      NUMBER_OF_EVENTS
+    };
+  };
+
+  //***************************************************************************
+  // States
+  struct StateId
+  {
+    enum
+    {
+      IDLE,
+      CONNECTING,
+      ONLINE,
+      NUMBER_OF_STATES
+    };
+  };
+
+  const size_t SIZE = 8;
+
+  //***********************************
+  // A pool of connection state charts.
+  //***********************************
+  class Connections : public etl::state_chart_pool<Connections, SIZE, StateId::NUMBER_OF_STATES, EventId::NUMBER_OF_EVENTS>
+  {
+  public:
+
+    typedef etl::state_chart_pool<Connections, SIZE, StateId::NUMBER_OF_STATES, EventId::NUMBER_OF_EVENTS> base_t;
+
+    Connections()
+      : base_t(*this, transitionTable.begin(), transitionTable.end(), stateTable.begin(), stateTable.end(), StateId::IDLE)
+    {
+      Clear();
+    }
+
+    void Clear()
+    {
+      allowed.fill(true);
+      connects.fill(0);
+      entered_idle.fill(0);
+      exited_online.fill(0);
+      refused.fill(0);
+    }
+
+    bool Allowed(size_t id)      { return allowed[id]; }
+    void OnConnect(size_t id)    { ++connects[id]; }
+    void OnRefused(size_t id)    { ++refused[id]; }
+    void OnEnterIdle(size_t id)  { ++entered_idle[id]; }
+    void OnExitOnline(size_t id) { ++exited_online[id]; }
+
+    etl::array<bool, SIZE> allowed;
+    etl::array<int, SIZE>  connects;
+    etl::array<int, SIZE>  refused;
+    etl::array<int, SIZE>  entered_idle;
+    etl::array<int, SIZE>  exited_online;
+
+    static const etl::array<Connections::transition, 5> transitionTable;
+    static const etl::array<Connections::state, 2>      stateTable;
+  };
+
+  //***************************************************************************
+  const etl::array<Connections::transition, 5> Connections::transitionTable =
+  {
+    Connections::transition(StateId::IDLE,       EventId::CONNECT,    StateId::CONNECTING, &Connections::OnConnect, &Connections::Allowed),
+    Connections::transition(StateId::IDLE,       EventId::CONNECT,    StateId::IDLE,       &Connections::OnRefused),
+    Connections::transition(StateId::CONNECTING, EventId::CONNECTED,  StateId::ONLINE),
+    Connections::transition(StateId::ONLINE,     EventId::DISCONNECT, StateId::IDLE),
+    Connections::transition(                     EventId::RESET,      StateId::IDLE)
+  };
+
+  //***************************************************************************
+  const etl::array<Connections::state, 2> Connections::stateTable =
+  {
+    Connections::state(StateId::IDLE,   &Connections::OnEnterIdle),
+    Connections::state(StateId::ONLINE, nullptr, &Connections::OnExitOnline)
+  };
+
+  SUITE(test_state_chart_pool)
+  {
+    //*************************************************************************
+    TEST(test_start)
+    {
+      Connections connections;
+
+      CHECK_EQUAL(SIZE, connections.size());
+      CHECK_EQUAL(SIZE, connections.count(StateId::IDLE));
+
+      // Not started.
+      connections.process_event(0, EventId::CONNECT);
+      CHECK_EQUAL(StateId::IDLE, connections.get_state_id(0));
+
+      connections.start();
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        CHECK_EQUAL(1, connections.entered_idle[i]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_process_event)
+    {
+      Connections connections;
+      connections.start();
+
+      connections.allowed[1] = false;
+
+      connections.process_event(0, EventId::CONNECT);
+      connections.process_event(1, EventId::CONNECT);
+
+      CHECK_EQUAL(StateId::CONNECTING, connections.get_state_id(0));
+      CHECK_EQUAL(StateId::IDLE,       connections.get_state_id(1));
+      CHECK_EQUAL(1, connections.connects[0]);
+      CHECK_EQUAL(0, connections.connects[1]);
+      CHECK_EQUAL(0, connections.refused[0]);
+      CHECK_EQUAL(1, connections.refused[1]);
+
+      // Unhandled event.
+      connections.process_event(0, EventId::DISCONNECT);
+      CHECK_EQUAL(StateId::CONNECTING, connections.get_state_id(0));
+
+      connections.process_event(0, EventId::CONNECTED);
+      CHECK_EQUAL(StateId::ONLINE, connections.get_state_id(0));
+
+      connections.process_event(0, EventId::DISCONNECT);
+      CHECK_EQUAL(StateId::IDLE, connections.get_state_id(0));
+      CHECK_EQUAL(1, connections.exited_online[0]);
+      CHECK_EQUAL(2, connections.entered_idle[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_process_event_batch)
+    {
+      Connections connections;
+      connections.start();
+
+      const size_t ids[] = { 2, 3, 2, 5 };
+      const Connections::event_id_t events[] = { EventId::CONNECT, EventId::CONNECT, EventId::CONNECTED, EventId::CONNECTED };
+
+      connections.process_event_batch(ids, events, 4);
+
+      CHECK_EQUAL(StateId::ONLINE,     connections.get_state_id(2));
+      CHECK_EQUAL(StateId::CONNECTING, connections.get_state_id(3));
+      CHECK_EQUAL(StateId::IDLE,       connections.get_state_id(5));
+      CHECK_EQUAL(1U, connections.count(StateId::ONLINE));
+      CHECK_EQUAL(1U, connections.count(StateId::CONNECTING));
+    }
+
+    //*************************************************************************
+    TEST(test_process_event_all)
+    {
+      Connections connections;
+      connections.start();
+
+      connections.allowed[4] = false;
+
+      connections.process_event_all(EventId::CONNECT);
+      CHECK_EQUAL(SIZE - 1, connections.count(StateId::CONNECTING));
+      CHECK_EQUAL(1, connections.refused[4]);
+
+      connections.process_event_all(EventId::CONNECTED);
+      CHECK_EQUAL(SIZE - 1, connections.count(StateId::ONLINE));
+      CHECK_EQUAL(StateId::IDLE, connections.get_state_id(4));
+
+      // 'From any state' transition.
+      connections.process_event_all(EventId::RESET);
+      CHECK_EQUAL(SIZE, connections.count(StateId::IDLE));
+      CHECK_EQUAL(1, connections.exited_online[0]);
+      CHECK_EQUAL(0, connections.exited_online[4]);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_ids)
+    {
+      Connections connections;
+      connections.start();
+
+      CHECK_THROW(connections.process_event(SIZE, EventId::CONNECT), etl::state_chart_pool_instance_exception);
+      CHECK_THROW(connections.process_event(0, EventId::NUMBER_OF_EVENTS), etl::state_chart_pool_id_exception);
+      CHECK_THROW(connections.reset(StateId::NUMBER_OF_STATES), etl::state_chart_pool_id_exception);
+    }
+  };
+}
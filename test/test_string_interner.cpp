@@ -0,0 +1,197 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "etl/string_interner.h"
+#include "etl/cstring.h"
+#include "etl/unordered_map.h"
+
+namespace
+{
+  typedef etl::string_interner<8, 64> Interner;
+
+  SUITE(test_string_interner)
+  {
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Interner interner;
+
+      CHECK(interner.empty());
+      CHECK(!interner.full());
+      CHECK_EQUAL(0U, interner.size());
+      CHECK_EQUAL(8U, interner.max_size());
+      CHECK_EQUAL(64U, interner.arena_available());
+    }
+
+    //*************************************************************************
+    TEST(test_intern_returns_same_handle_for_equal_strings)
+    {
+      Interner interner;
+
+      etl::string<20> text1("sensor/temperature");
+      etl::string<20> text2("sensor/temperature");
+
+      etl::intern_handle h1 = interner.intern(etl::string_view(text1));
+      etl::intern_handle h2 = interner.intern(etl::string_view(text2));
+      etl::intern_handle h3 = interner.intern("sensor/humidity");
+
+      CHECK(h1.is_valid());
+      CHECK(h3.is_valid());
+      CHECK(h1 == h2);
+      CHECK(h1 != h3);
+      CHECK(h1 < h3);
+      CHECK_EQUAL(2U, interner.size());
+    }
+
+    //*************************************************************************
+    TEST(test_view_and_c_str)
+    {
+      Interner interner;
+
+      etl::intern_handle h1 = interner.intern("alpha");
+      etl::intern_handle h2 = interner.intern("beta");
+      etl::intern_handle h3 = interner.intern("");
+
+      CHECK(interner.view(h1) == etl::string_view("alpha"));
+      CHECK(interner.view(h2) == etl::string_view("beta"));
+      CHECK_EQUAL(0U, interner.view(h3).size());
+
+      CHECK_EQUAL(0, strcmp("alpha", interner.c_str(h1)));
+      CHECK_EQUAL(0, strcmp("beta",  interner.c_str(h2)));
+      CHECK_EQUAL(0, strcmp("",      interner.c_str(h3)));
+
+      // Each string uses its length plus a terminator.
+      CHECK_EQUAL(64U - 6U - 5U - 1U, interner.arena_available());
+    }
+
+    //*************************************************************************
+    TEST(test_find)
+    {
+      Interner interner;
+
+      etl::intern_handle h1 = interner.intern("alpha");
+
+      CHECK(interner.find("alpha") == h1);
+      CHECK(!interner.find("alph").is_valid());
+      CHECK(!interner.find("alphabet").is_valid());
+      CHECK_EQUAL(1U, interner.size());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::string_interner<2, 64> interner;
+
+      interner.intern("one");
+      interner.intern("two");
+
+      CHECK(interner.full());
+      CHECK(interner.intern("one").is_valid());
+      CHECK_THROW(interner.intern("three"), etl::string_interner_full);
+    }
+
+    //*************************************************************************
+    TEST(test_arena_full)
+    {
+      etl::string_interner<4, 8> interner;
+
+      CHECK(interner.intern("1234567").is_valid());
+      CHECK_EQUAL(0U, interner.arena_available());
+      CHECK_THROW(interner.intern("x"), etl::string_interner_full);
+    }
+
+    //*************************************************************************
+    TEST(test_invalid_handle)
+    {
+      Interner interner;
+
+      CHECK_THROW(interner.view(etl::intern_handle()), etl::string_interner_invalid_handle);
+      CHECK_THROW(interner.c_str(etl::intern_handle(0)), etl::string_interner_invalid_handle);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Interner interner;
+
+      interner.intern("alpha");
+      interner.intern("beta");
+      interner.clear();
+
+      CHECK(interner.empty());
+      CHECK_EQUAL(64U, interner.arena_available());
+      CHECK(!interner.find("alpha").is_valid());
+
+      CHECK_EQUAL(0U, interner.intern("beta").get());
+    }
+
+    //*************************************************************************
+    TEST(test_many_strings)
+    {
+      etl::string_interner<100, 1000> interner;
+      etl::intern_handle handles[100];
+      char text[8];
+
+      for (int i = 0; i < 100; ++i)
+      {
+        sprintf(text, "key%d", i);
+        handles[i] = interner.intern(text);
+      }
+
+      for (int i = 0; i < 100; ++i)
+      {
+        sprintf(text, "key%d", i);
+        CHECK(interner.find(text) == handles[i]);
+        CHECK(interner.intern(text) == handles[i]);
+        CHECK_EQUAL(0, strcmp(text, interner.c_str(handles[i])));
+      }
+
+      CHECK_EQUAL(100U, interner.size());
+    }
+
+    //*************************************************************************
+    TEST(test_handle_as_key)
+    {
+      Interner interner;
+      etl::unordered_map<etl::intern_handle, int, 8, 8> map;
+
+      map[interner.intern("alpha")] = 1;
+      map[interner.intern("beta")]  = 2;
+
+      etl::string<10> key("alpha");
+
+      CHECK_EQUAL(1, map[interner.find(etl::string_view(key))]);
+      CHECK_EQUAL(2, map[interner.find("beta")]);
+    }
+  };
+}
@@ -3546,6 +3546,40 @@ namespace
       CHECK_EQUAL(position1, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_long_text)
+    {
+      // Long enough to exercise the vectorised search blocks and tails.
+      etl::u32string<200> text;
+      Compare_Text     compare_text;
+
+      for (size_t i = 0; i < 199; ++i)
+      {
+        const value_t c = value_t(STR('a') + (i % 7));
+        text.push_back(c);
+        compare_text.push_back(c);
+      }
+
+      text.push_back(STR('Z'));
+      compare_text.push_back(STR('Z'));
+
+      CHECK_EQUAL(compare_text.rfind(STR('c')), text.rfind(STR('c')));
+      CHECK_EQUAL(compare_text.rfind(STR('Z')), text.rfind(STR('Z')));
+
+      for (size_t position = 0; position <= text.size(); ++position)
+      {
+        CHECK_EQUAL(compare_text.find(STR('Z'), position),              text.find(STR('Z'), position));
+        CHECK_EQUAL(compare_text.find(STR('c'), position),              text.find(STR('c'), position));
+        CHECK_EQUAL(compare_text.find(STR("gaZ"), position),            text.find(STR("gaZ"), position));
+        CHECK_EQUAL(compare_text.find(STR("cdefgab"), position),        text.find(STR("cdefgab"), position));
+        CHECK_EQUAL(compare_text.find(STR("cdefga!"), position),        text.find(STR("cdefga!"), position));
+        CHECK_EQUAL(compare_text.find_first_of(STR("Zf"), position),    text.find_first_of(STR("Zf"), position));
+        CHECK_EQUAL(compare_text.find_last_of(STR("Zf"), position),     text.find_last_of(STR("Zf"), position));
+        CHECK_EQUAL(compare_text.find_first_not_of(STR("abcdef"), position), text.find_first_not_of(STR("abcdef"), position));
+        CHECK_EQUAL(compare_text.find_last_not_of(STR("bcdefgZ"), position), text.find_last_not_of(STR("bcdefgZ"), position));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_hash)
     {
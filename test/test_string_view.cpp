@@ -853,6 +853,33 @@ namespace
       CHECK_EQUAL(View::npos, view.find_last_not_of(s6, 10, 8));
     }
 
+    //*************************************************************************
+    TEST(test_find_long_view)
+    {
+      // Long enough to exercise the vectorised search blocks and tails.
+      std::string compare_text;
+
+      for (size_t i = 0; i < 199; ++i)
+      {
+        compare_text.push_back(char('a' + (i % 7)));
+      }
+
+      compare_text.push_back('Z');
+
+      View view(compare_text.data(), compare_text.size());
+
+      for (size_t position = 0; position <= view.size(); ++position)
+      {
+        CHECK_EQUAL(compare_text.find('Z', position),                   view.find('Z', position));
+        CHECK_EQUAL(compare_text.find("gaZ", position),                 view.find(View("gaZ"), position));
+        CHECK_EQUAL(compare_text.find("cdefgab", position),             view.find(View("cdefgab"), position));
+        CHECK_EQUAL(compare_text.find_first_of("Zf", position),         view.find_first_of(View("Zf"), position));
+        CHECK_EQUAL(compare_text.find_last_of("Zf", position),          view.find_last_of(View("Zf"), position));
+        CHECK_EQUAL(compare_text.find_first_not_of("abcdef", position), view.find_first_not_of(View("abcdef"), position));
+        CHECK_EQUAL(compare_text.find_last_not_of("bcdefgZ", position), view.find_last_not_of(View("bcdefgZ"), position));
+      }
+    }
+
     //*************************************************************************
     TEST(test_hash)
     {
@@ -35,6 +35,12 @@ SOFTWARE.
 #include "etl/task.h"
 #include "etl/scheduler.h"
 #include "etl/container.h"
+#include "etl/task_statistics.h"
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 typedef std::vector<std::string> WorkList_t;
 
@@ -156,6 +162,76 @@ typedef etl::scheduler<etl::scheduler_policy_sequencial_multiple, sizeof(etl::ar
 typedef etl::scheduler<etl::scheduler_policy_highest_priority,    sizeof(etl::array_size(taskList))> SchedulerHighestPriority;
 typedef etl::scheduler<etl::scheduler_policy_most_work,           sizeof(etl::array_size(taskList))> SchedulerMostWork;
 
+typedef etl::ready_scheduler<etl::scheduler_policy_sequencial_single, sizeof(etl::array_size(taskList))> ReadySchedulerSequencialSingle;
+
+//*****************************************************************************
+// A task that counts how often it is polled.
+//*****************************************************************************
+class ReadyTask : public etl::task
+{
+public:
+
+  ReadyTask(etl::task_priority_t priority_)
+    : task(priority_),
+      pending(0),
+      polls(0),
+      processed(0)
+  {
+  }
+
+  uint32_t task_request_work() const
+  {
+    ++polls;
+    return pending.load();
+  }
+
+  void task_process_work()
+  {
+    --pending;
+    ++processed;
+  }
+
+  std::atomic<uint32_t> pending;
+  mutable int polls;
+  int processed;
+};
+
+//*****************************************************************************
+// A task with a fixed cost per call, measured by a fake clock.
+//*****************************************************************************
+uint32_t fake_time = 0;
+
+uint32_t FakeClock()
+{
+  return fake_time;
+}
+
+class TimedTask : public etl::task
+{
+public:
+
+  TimedTask(etl::task_priority_t priority_, uint32_t pending_, uint32_t cost_)
+    : task(priority_),
+      pending(pending_),
+      cost(cost_)
+  {
+  }
+
+  uint32_t task_request_work() const
+  {
+    return pending;
+  }
+
+  void task_process_work()
+  {
+    fake_time += cost;
+    --pending;
+  }
+
+  uint32_t pending;
+  uint32_t cost;
+};
+
 namespace
 {
   SUITE(test_task_scheduler)
@@ -259,5 +335,184 @@ namespace
       CHECK(expected == common.workList);
       CHECK(common.watchdog_called);
     }
+
+    //=========================================================================
+    TEST(test_task_statistics)
+    {
+      fake_time = 0;
+
+      TimedTask fast(2, 3, 5);
+      TimedTask slow(1, 2, 100);
+      TimedTask untimed(0, 1, 1);
+
+      etl::task_statistics fast_statistics(FakeClock);
+      etl::task_statistics slow_statistics(FakeClock);
+
+      fast.set_task_statistics(&fast_statistics);
+      slow.set_task_statistics(&slow_statistics);
+
+      SchedulerSequencialSingle s;
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.add_task(fast);
+      s.add_task(slow);
+      s.add_task(untimed);
+      s.start();
+
+      etl::task_statistics_snapshot snapshot;
+
+      fast_statistics.snapshot(snapshot);
+      CHECK_EQUAL(3U,  snapshot.invocations);
+      CHECK_EQUAL(15U, snapshot.total_run_time);
+      CHECK_EQUAL(5U,  snapshot.max_run_time);
+      CHECK_EQUAL(3U,  snapshot.run_time_histogram[etl::task_statistics::bucket(5)]);
+      CHECK_EQUAL(3U,  snapshot.latency_histogram[0]);
+
+      slow_statistics.snapshot(snapshot);
+      CHECK_EQUAL(2U,   snapshot.invocations);
+      CHECK_EQUAL(200U, snapshot.total_run_time);
+      CHECK_EQUAL(100U, snapshot.max_run_time);
+      CHECK_EQUAL(2U,   snapshot.run_time_histogram[etl::task_statistics::bucket(100)]);
+
+      slow_statistics.clear();
+      slow_statistics.snapshot(snapshot);
+      CHECK_EQUAL(0U, snapshot.invocations);
+      CHECK_EQUAL(0U, snapshot.total_run_time);
+    }
+
+    //=========================================================================
+    TEST(test_task_statistics_latency)
+    {
+      etl::task_statistics statistics(FakeClock);
+      etl::task_statistics_snapshot snapshot;
+
+      CHECK_EQUAL(0U,  etl::task_statistics::bucket(0));
+      CHECK_EQUAL(1U,  etl::task_statistics::bucket(1));
+      CHECK_EQUAL(5U,  etl::task_statistics::bucket(16));
+      CHECK_EQUAL(5U,  etl::task_statistics::bucket(31));
+      CHECK_EQUAL(15U, etl::task_statistics::bucket(0xFFFFFFFFUL));
+
+      fake_time = 10;
+      statistics.work_available();
+      fake_time = 20;
+      statistics.work_available(); // Not the first, so ignored.
+      fake_time = 30;
+      statistics.begin_run();
+      fake_time = 35;
+      statistics.end_run();
+
+      statistics.snapshot(snapshot);
+      CHECK_EQUAL(1U,  snapshot.invocations);
+      CHECK_EQUAL(5U,  snapshot.total_run_time);
+      CHECK_EQUAL(20U, snapshot.max_latency);
+      CHECK_EQUAL(1U,  snapshot.latency_histogram[etl::task_statistics::bucket(20)]);
+
+      // No work recorded as available, so no latency.
+      statistics.begin_run();
+      statistics.end_run();
+
+      statistics.snapshot(snapshot);
+      CHECK_EQUAL(2U, snapshot.invocations);
+      CHECK_EQUAL(1U, snapshot.latency_histogram[etl::task_statistics::bucket(20)]);
+      CHECK_EQUAL(0U, snapshot.latency_histogram[0]);
+    }
+
+    //=========================================================================
+    TEST(test_ready_scheduler_sequencial_single)
+    {
+      ReadySchedulerSequencialSingle s;
+
+      task1.Reset();
+      task2.Reset();
+      task3.Reset();
+
+      task2.WorkToAdd(2, "T3W3", task3);
+
+      common.Clear();
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, etl::size(taskList));
+      s.start(); // If 'start' returns then the idle callback was sucessfully called.
+
+      WorkList_t expected = { "T3W1", "T2W1", "T1W1", "T3W2", "T2W2", "T1W2", "T3W3", "T2W3", "T1W3", "T2W4" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
+
+    //=========================================================================
+    TEST(test_ready_scheduler_signalled_from_thread)
+    {
+      etl::ready_scheduler<etl::scheduler_policy_highest_priority, 3> s;
+
+      ReadyTask signalled1(1);
+      ReadyTask signalled2(2);
+      ReadyTask never_signalled(3);
+
+      std::mutex              mutex;
+      std::condition_variable cv;
+      const int               SIGNALS = 100;
+
+      struct Callbacks
+      {
+        void Idle()
+        {
+          if ((p1->processed + p2->processed) == SIGNALS)
+          {
+            ps->exit_scheduler();
+          }
+          else
+          {
+            // Sleep until a task is signalled.
+            std::unique_lock<std::mutex> lock(*pm);
+            pcv->wait(lock, [this] { return ps->has_ready_tasks(); });
+          }
+        }
+
+        void Wake()
+        {
+          std::lock_guard<std::mutex> lock(*pm);
+          pcv->notify_one();
+        }
+
+        etl::ready_scheduler<etl::scheduler_policy_highest_priority, 3>* ps;
+        ReadyTask* p1;
+        ReadyTask* p2;
+        std::mutex* pm;
+        std::condition_variable* pcv;
+      };
+
+      Callbacks callbacks = { &s, &signalled1, &signalled2, &mutex, &cv };
+      etl::function<Callbacks, void> idle_callback(callbacks, &Callbacks::Idle);
+      etl::function<Callbacks, void> wake_callback(callbacks, &Callbacks::Wake);
+
+      s.set_idle_callback(idle_callback);
+      s.set_wake_callback(wake_callback);
+      s.add_task(signalled1);
+      s.add_task(signalled2);
+      s.add_task(never_signalled);
+
+      std::thread producer([&]()
+      {
+        for (int i = 0; i < SIGNALS; ++i)
+        {
+          ReadyTask& task = ((i % 2) == 0) ? signalled1 : signalled2;
+          ++task.pending;
+          s.signal_task(task);
+        }
+      });
+
+      s.start();
+      producer.join();
+
+      CHECK_EQUAL(SIGNALS / 2, signalled1.processed);
+      CHECK_EQUAL(SIGNALS / 2, signalled2.processed);
+
+      // Only polled by the policy and the ready check of the first pass.
+      CHECK_EQUAL(2, never_signalled.polls);
+    }
   };
 }
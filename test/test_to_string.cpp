@@ -31,6 +31,10 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <string>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 #include "etl/to_string.h"
 #include "etl/cstring.h"
@@ -254,6 +258,56 @@ namespace
       CHECK_EQUAL(etl::string<17>(STR("1E240")),              etl::to_string(123456, str, Format().hex()));
     }
 
+    //*************************************************************************
+    TEST(test_decimal_digit_pairs)
+    {
+      etl::string<20> str;
+
+      for (int32_t i = -100000; i <= 100000; i += 7)
+      {
+        std::string expected = std::to_string(i);
+        CHECK_EQUAL(etl::string<20>(expected.c_str()), etl::to_string(i, str));
+      }
+
+      CHECK_EQUAL(etl::string<20>(STR("0")),                    etl::to_string(0, str));
+      CHECK_EQUAL(etl::string<20>(STR("9")),                    etl::to_string(9, str));
+      CHECK_EQUAL(etl::string<20>(STR("10")),                   etl::to_string(10, str));
+      CHECK_EQUAL(etl::string<20>(STR("99")),                   etl::to_string(99, str));
+      CHECK_EQUAL(etl::string<20>(STR("100")),                  etl::to_string(100, str));
+      CHECK_EQUAL(etl::string<20>(STR("4294967295")),           etl::to_string(uint32_t(4294967295ul), str));
+      CHECK_EQUAL(etl::string<20>(STR("-2147483648")),          etl::to_string(int32_t(-2147483647l - 1), str));
+      CHECK_EQUAL(etl::string<20>(STR("18446744073709551615")), etl::to_string(uint64_t(18446744073709551615ull), str));
+      CHECK_EQUAL(etl::string<20>(STR("9223372036854775807")),  etl::to_string(int64_t(9223372036854775807ll), str));
+      CHECK_EQUAL(etl::string<20>(STR("-9223372036854775808")), etl::to_string(int64_t(-9223372036854775807ll - 1), str));
+    }
+
+    //*************************************************************************
+    TEST(test_hex_lower_case_and_other_bases)
+    {
+      etl::string<20> str;
+
+      CHECK_EQUAL(etl::string<20>(STR("deadbeef")),         etl::to_string(uint32_t(0xDEADBEEFul), str, Format().hex().upper_case(false)));
+      CHECK_EQUAL(etl::string<20>(STR("DEADBEEF")),         etl::to_string(uint32_t(0xDEADBEEFul), str, Format().hex().upper_case(true)));
+      CHECK_EQUAL(etl::string<20>(STR("123456789ABCDEF0")), etl::to_string(uint64_t(0x123456789ABCDEF0ull), str, Format().hex()));
+      CHECK_EQUAL(etl::string<20>(STR("11120")),            etl::to_string(123, str, Format().base(3)));
+      CHECK_EQUAL(etl::string<20>(STR("3F")),               etl::to_string(123, str, Format().base(36)));
+    }
+
+    //*************************************************************************
+    TEST(test_integral_truncated)
+    {
+      etl::string<5> str;
+
+      etl::to_string(-1234567, str);
+      CHECK_EQUAL(etl::string<5>(STR("-1234")), str);
+      CHECK(str.truncated());
+
+      str.assign(STR("ab"));
+      etl::to_string(uint32_t(0xABCDEFul), str, Format().hex(), true);
+      CHECK_EQUAL(etl::string<5>(STR("abABC")), str);
+      CHECK(str.truncated());
+    }
+
     //*************************************************************************
     TEST(test_floating_point_no_append)
     {
@@ -313,6 +367,78 @@ namespace
       CHECK_EQUAL(etl::string<20>(STR("20.0")),    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<32> str;
+
+      Format format = Format().shortest(true);
+
+      CHECK_EQUAL(etl::string<32>(STR("0")),                       etl::to_string(0.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("-0")),                      etl::to_string(-0.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1")),                       etl::to_string(1.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("0.1")),                     etl::to_string(0.1, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("0.3")),                     etl::to_string(0.3, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("-2.5")),                    etl::to_string(-2.5, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("123456.789")),              etl::to_string(123456.789, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("0.0001")),                  etl::to_string(0.0001, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1e-05")),                   etl::to_string(0.00001, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1e+21")),                   etl::to_string(1e21, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("12345678901234568")),       etl::to_string(12345678901234567.0, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("5e-324")),                  etl::to_string(5e-324, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("1.7976931348623157e+308")), etl::to_string(1.7976931348623157e308, str, format));
+
+      CHECK_EQUAL(etl::string<32>(STR("0.1")),                     etl::to_string(0.1f, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("3.14159")),                 etl::to_string(3.14159f, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("16777216")),                etl::to_string(16777216.0f, str, format));
+      CHECK_EQUAL(etl::string<32>(STR("3.4028235e+38")),           etl::to_string(3.4028235e38f, str, format));
+
+      CHECK_EQUAL(etl::string<32>(STR("  0.5")),                   etl::to_string(0.5, str, Format().shortest(true).width(5)));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      etl::string<32> str;
+
+      Format format = Format().shortest(true);
+
+      uint64_t bits = 0x123456789ABCDEF0ULL;
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        // xorshift64
+        bits ^= bits << 13;
+        bits ^= bits >> 7;
+        bits ^= bits << 17;
+
+        double value;
+        memcpy(&value, &bits, sizeof(value));
+
+        if (std::isfinite(value))
+        {
+          etl::to_string(value, str, format);
+          std::string text(str.begin(), str.end());
+          double result = strtod(text.c_str(), nullptr);
+
+          CHECK(memcmp(&value, &result, sizeof(value)) == 0);
+        }
+
+        float valuef;
+        uint32_t bitsf = uint32_t(bits);
+        memcpy(&valuef, &bitsf, sizeof(valuef));
+
+        if (std::isfinite(valuef))
+        {
+          etl::to_string(valuef, str, format);
+          std::string text(str.begin(), str.end());
+          float result = strtof(text.c_str(), nullptr);
+
+          CHECK(memcmp(&valuef, &result, sizeof(valuef)) == 0);
+        }
+      }
+    }
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
@@ -312,6 +312,15 @@ namespace
       CHECK_EQUAL(etl::wstring<20>(STR("20.0")),    etl::to_string(19.999999, str, Format().precision(1).width(4).right()));
     }
 
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::wstring<32> str;
+
+      CHECK_EQUAL(etl::wstring<32>(STR("-0.1")),                    etl::to_string(-0.1, str, Format().shortest(true)));
+      CHECK_EQUAL(etl::wstring<32>(STR("1.7976931348623157e+308")), etl::to_string(1.7976931348623157e308, str, Format().shortest(true)));
+    }
+
     //*************************************************************************
     TEST(test_bool_no_append)
     {
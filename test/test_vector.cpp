@@ -35,6 +35,61 @@ SOFTWARE.
 
 #include "etl/vector.h"
 
+namespace
+{
+  //***************************************************************************
+  // Owns a value on the heap, so copies are not trivial, but it may be moved
+  // by copying its bytes.
+  //***************************************************************************
+  struct Relocatable
+  {
+    explicit Relocatable(int value)
+      : p_value(new int(value))
+    {
+      ++instances;
+    }
+
+    Relocatable(const Relocatable& other)
+      : p_value(new int(*other.p_value))
+    {
+      ++instances;
+    }
+
+    Relocatable& operator =(const Relocatable& other)
+    {
+      *p_value = *other.p_value;
+      return *this;
+    }
+
+    ~Relocatable()
+    {
+      delete p_value;
+      --instances;
+    }
+
+    int* p_value;
+
+    static int instances;
+  };
+
+  int Relocatable::instances = 0;
+
+  //***************************************************************************
+  struct Large
+  {
+    int value;
+    char padding[60];
+  };
+}
+
+namespace etl
+{
+  template <>
+  struct is_trivially_relocatable<Relocatable> : etl::true_type
+  {
+  };
+}
+
 namespace
 {
   SUITE(test_vector)
@@ -1124,5 +1179,132 @@ namespace
       CHECK_EQUAL(raw[4].i, dest[6].i);
       CHECK_EQUAL(raw[5].i, dest[7].i);
     }
+
+    //*************************************************************************
+    TEST(test_is_trivially_relocatable)
+    {
+      struct Virtual
+      {
+        virtual ~Virtual()
+        {
+        }
+      };
+
+      CHECK(etl::is_trivially_relocatable<int>::value);
+      CHECK(etl::is_trivially_relocatable<int*>::value);
+      CHECK(etl::is_trivially_relocatable<Large>::value);
+      CHECK(etl::is_trivially_relocatable<Relocatable>::value);
+      CHECK(!etl::is_trivially_relocatable<Virtual>::value);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_relocatable)
+    {
+      {
+        etl::vector<Relocatable, 20> data;
+
+        for (int i = 0; i < 5; ++i)
+        {
+          data.push_back(Relocatable(i));
+        }
+
+        data.insert(data.begin() + 2, Relocatable(10));
+        data.insert(data.begin() + 1, size_t(2), Relocatable(11));
+        data.emplace(data.begin() + 4, 12);
+
+        const Relocatable range[] = { Relocatable(13), Relocatable(14) };
+        data.insert(data.begin(), etl::begin(range), etl::end(range));
+
+        const int expected1[] = { 13, 14, 0, 11, 11, 1, 12, 10, 2, 3, 4 };
+        CHECK_EQUAL(ETL_ARRAY_SIZE(expected1), data.size());
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          CHECK_EQUAL(expected1[i], *data[i].p_value);
+        }
+
+        CHECK_EQUAL(int(data.size()) + 2, Relocatable::instances);
+
+        data.erase(data.begin() + 3);
+        data.erase(data.begin() + 5, data.begin() + 8);
+        data.erase(data.end() - 1);
+
+        const int expected2[] = { 13, 14, 0, 11, 1, 3 };
+        CHECK_EQUAL(ETL_ARRAY_SIZE(expected2), data.size());
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          CHECK_EQUAL(expected2[i], *data[i].p_value);
+        }
+
+        CHECK_EQUAL(int(data.size()) + 2, Relocatable::instances);
+      }
+
+      CHECK_EQUAL(0, Relocatable::instances);
+    }
+
+    //*************************************************************************
+    TEST(test_insert_erase_large_pod)
+    {
+      etl::vector<Large, 10> data;
+      std::vector<Large> compare;
+
+      for (int i = 0; i < 6; ++i)
+      {
+        Large large = { i, { 0 } };
+        data.push_back(large);
+        compare.push_back(large);
+      }
+
+      Large large = { 10, { 0 } };
+      data.insert(data.begin() + 3, large);
+      compare.insert(compare.begin() + 3, large);
+
+      data.erase(data.begin() + 1, data.begin() + 3);
+      compare.erase(compare.begin() + 1, compare.begin() + 3);
+
+      CHECK_EQUAL(compare.size(), data.size());
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        CHECK_EQUAL(compare[i].value, data[i].value);
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_insert_own_element)
+    {
+      Compare_Data compare_data(initial_data.begin(), initial_data.begin() + 5);
+      Data data(initial_data.begin(), initial_data.begin() + 5);
+
+      data.insert(data.begin(), data[3]);
+      compare_data.insert(compare_data.begin(), compare_data[3]);
+
+      data.insert(data.begin() + 1, size_t(2), data[4]);
+      compare_data.insert(compare_data.begin() + 1, size_t(2), compare_data[4]);
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      bool is_equal = std::equal(data.begin(), data.end(), compare_data.begin());
+      CHECK(is_equal);
+
+      etl::vector<Relocatable, 10> relocatables;
+      relocatables.push_back(Relocatable(1));
+      relocatables.push_back(Relocatable(2));
+
+      relocatables.insert(relocatables.begin(), relocatables[1]);
+
+      CHECK_EQUAL(2, *relocatables[0].p_value);
+      CHECK_EQUAL(1, *relocatables[1].p_value);
+      CHECK_EQUAL(2, *relocatables[2].p_value);
+
+      relocatables.insert(relocatables.begin(), size_t(2), relocatables[1]);
+
+      CHECK_EQUAL(5U, relocatables.size());
+      CHECK_EQUAL(1, *relocatables[0].p_value);
+      CHECK_EQUAL(1, *relocatables[1].p_value);
+      CHECK_EQUAL(2, *relocatables[2].p_value);
+      CHECK_EQUAL(1, *relocatables[3].p_value);
+    }
   };
 }
@@ -0,0 +1,106 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2014 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include "etl/platform.h"
+
+// The unit test profile checks push and pop. These tests cover a full vector
+// when the checks are off.
+#undef ETL_CHECK_PUSH_POP
+
+#include "etl/vector.h"
+
+namespace
+{
+  //***************************************************************************
+  /// A type that is only used in this file, as the vector code here is
+  /// compiled without ETL_CHECK_PUSH_POP.
+  //***************************************************************************
+  struct Item
+  {
+    Item(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  SUITE(test_vector_no_check_push_pop)
+  {
+    static const size_t SIZE = 4;
+
+    typedef etl::vector<Item, SIZE> Data;
+    typedef etl::ivector<Item>      IData;
+
+    //*************************************************************************
+    TEST(test_push_back_full_does_not_add)
+    {
+      struct Guarded
+      {
+        Data data;
+        int  after;
+      };
+
+      Guarded guarded;
+      guarded.after = 123;
+
+      IData& data = guarded.data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.push_back(Item(i));
+      }
+
+      data.push_back(Item(10));
+      data.push_back(data.front());
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(0, data.front().value);
+      CHECK_EQUAL(3, data.back().value);
+      CHECK_EQUAL(123, guarded.after);
+    }
+
+    //*************************************************************************
+    TEST(test_emplace_back_full_does_not_add)
+    {
+      Data data;
+
+      for (int i = 0; i < int(SIZE); ++i)
+      {
+        data.emplace_back(i);
+      }
+
+      data.emplace_back(10);
+
+      CHECK_EQUAL(SIZE, data.size());
+      CHECK_EQUAL(3, data.back().value);
+    }
+  };
+}
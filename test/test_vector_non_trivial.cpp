@@ -1284,5 +1284,36 @@ namespace
       const DataNDC initial2(initial_data.begin(), initial_data.end());
       CHECK((initial >= initial2) == (initial_data >= initial_data));
     }
+
+    //*************************************************************************
+    TEST(test_emplace_back_non_movable)
+    {
+      struct NonMovable
+      {
+        NonMovable(int value_)
+          : value(value_)
+        {
+        }
+
+        NonMovable(const NonMovable&) = delete;
+        NonMovable(NonMovable&&) = delete;
+
+        int value;
+      };
+
+      etl::vector<NonMovable, 4> data;
+
+      data.emplace_back(1);
+      data.emplace_back(2);
+      data.emplace_back(3);
+      data.emplace_back(4);
+
+      CHECK_EQUAL(4U, data.size());
+      CHECK_EQUAL(1, data[0].value);
+      CHECK_EQUAL(4, data[3].value);
+
+      CHECK_THROW(data.emplace_back(5), etl::vector_full);
+      CHECK_EQUAL(4U, data.size());
+    }
   };
 }
@@ -0,0 +1,230 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+
+#include "etl/work_stealing_scheduler.h"
+#include "etl/function.h"
+
+namespace
+{
+  typedef std::vector<std::string> WorkList_t;
+
+  //***************************************************************************
+  struct Common
+  {
+    Common()
+      : idle_callback(*this, &Common::IdleCallback),
+        watchdog_callback(*this, &Common::WatchdogCallback),
+        pScheduler(nullptr),
+        remaining(0),
+        watchdog_called(false)
+    {
+    }
+
+    void IdleCallback()
+    {
+      if (remaining.load() == 0)
+      {
+        pScheduler->exit_scheduler();
+      }
+    }
+
+    void WatchdogCallback()
+    {
+      watchdog_called = true;
+    }
+
+    void Record(const std::string& work)
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      workList.push_back(work);
+      --remaining;
+    }
+
+    WorkList_t workList;
+    std::mutex mutex;
+    etl::function<Common, void> idle_callback;
+    etl::function<Common, void> watchdog_callback;
+    etl::ischeduler* pScheduler;
+    std::atomic<int> remaining;
+    std::atomic<bool> watchdog_called;
+  };
+
+  //***************************************************************************
+  class Task : public etl::task
+  {
+  public:
+
+    Task(etl::task_priority_t priority_, const WorkList_t& work_, Common& common_)
+      : task(priority_),
+        work(work_),
+        common(common_),
+        workIndex(0),
+        running(false),
+        overlapped(false)
+    {
+      common.remaining += int(work.size());
+    }
+
+    uint32_t task_request_work() const
+    {
+      return uint32_t(work.size() - workIndex);
+    }
+
+    void task_process_work()
+    {
+      if (running.exchange(true))
+      {
+        overlapped = true;
+      }
+
+      common.Record(work[workIndex]);
+      ++workIndex;
+
+      running = false;
+    }
+
+    WorkList_t        work;
+    Common&           common;
+    size_t            workIndex;
+    std::atomic<bool> running;
+    bool              overlapped;
+  };
+
+  SUITE(test_work_stealing_scheduler)
+  {
+    //=========================================================================
+    TEST(test_single_worker_runs_in_priority_order)
+    {
+      typedef etl::work_stealing_scheduler<3, 1> Scheduler;
+
+      Common common;
+      Task task1(1, { "T1W1", "T1W2", "T1W3" }, common);
+      Task task2(2, { "T2W1", "T2W2", "T2W3", "T2W4" }, common);
+      Task task3(3, { "T3W1", "T3W2" }, common);
+
+      etl::task* taskList[] = { &task1, &task2, &task3 };
+
+      Scheduler s;
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+      s.set_watchdog_callback(common.watchdog_callback);
+      s.add_task_list(taskList, 3);
+      s.start(); // If 'start' returns then the idle callback was sucessfully called.
+
+      WorkList_t expected = { "T3W1", "T2W1", "T1W1", "T3W2", "T2W2", "T1W2", "T2W3", "T1W3", "T2W4" };
+
+      CHECK(expected == common.workList);
+      CHECK(common.watchdog_called);
+    }
+
+    //=========================================================================
+    TEST(test_multiple_workers)
+    {
+      const size_t N_TASKS   = 16;
+      const size_t N_WORKERS = 4;
+      const size_t N_WORK    = 100;
+
+      typedef etl::work_stealing_scheduler<N_TASKS, N_WORKERS> Scheduler;
+
+      Common common;
+      std::vector<Task*> tasks;
+
+      for (size_t t = 0; t < N_TASKS; ++t)
+      {
+        WorkList_t work;
+
+        // Uneven amounts of work so that the workers have to steal.
+        for (size_t w = 0; w < ((t % N_WORKERS) == 0 ? N_WORK : 1); ++w)
+        {
+          work.push_back(std::to_string(t) + ":" + std::to_string(w));
+        }
+
+        tasks.push_back(new Task(etl::task_priority_t(t), work, common));
+      }
+
+      Scheduler s;
+      common.pScheduler = &s;
+
+      s.set_idle_callback(common.idle_callback);
+
+      for (size_t t = 0; t < N_TASKS; ++t)
+      {
+        s.add_task(*tasks[t]);
+      }
+
+      CHECK_THROW(s.start(N_WORKERS), etl::work_stealing_scheduler_worker_id_exception);
+
+      std::vector<std::thread> workers;
+
+      for (size_t w = 1; w < N_WORKERS; ++w)
+      {
+        workers.push_back(std::thread([&s, w]() { s.start(w); }));
+      }
+
+      s.start(0);
+
+      for (size_t w = 0; w < workers.size(); ++w)
+      {
+        workers[w].join();
+      }
+
+      CHECK_EQUAL(0, common.remaining.load());
+
+      for (size_t t = 0; t < N_TASKS; ++t)
+      {
+        CHECK_EQUAL(tasks[t]->work.size(), tasks[t]->workIndex);
+        CHECK(!tasks[t]->overlapped);
+
+        // Each task's work is done in order.
+        std::vector<std::string> done;
+
+        for (size_t i = 0; i < common.workList.size(); ++i)
+        {
+          if (common.workList[i].compare(0, std::to_string(t).size() + 1, std::to_string(t) + ":") == 0)
+          {
+            done.push_back(common.workList[i]);
+          }
+        }
+
+        CHECK(done == tasks[t]->work);
+
+        delete tasks[t];
+      }
+    }
+  };
+}